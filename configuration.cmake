@@ -1,5 +1,6 @@
 set_property(GLOBAL PROPERTY USE_FOLDERS ON)
 option(EON_INLINE_TESTS "Include inline unit tests in build?" ON)
+option(EON_BENCHMARKS "Build benchmark executables?" OFF)
 option(EON_BUILD_FILESYS "Include the File System package" ON)
 option(EON_BUILD_TYPESYSTEM "Include the Type System package" ON)
 #option(EON_BUILD_EDT "Build the Eon Data Tuple package")
@@ -0,0 +1,66 @@
+#include "Benchmark.h"
+
+
+namespace eonbench
+{
+	std::list<_EonBenchmark::BenchRef>* _EonBenchmark::_EonBenchmarks_{ nullptr };
+
+
+	bool _EonBenchmark::_registerEonBenchmark_(
+		const std::string& bench_class, const std::string& bench_name, FactoryMain* bench )
+	{
+		if( _EonBenchmarks_ == nullptr )
+			_EonBenchmarks_ = new std::list<BenchRef>();
+		_EonBenchmarks_->push_back( BenchRef( bench_class, bench_name, bench ) );
+		return true;
+	}
+
+	void _EonBenchmark::_resetEon_() noexcept
+	{
+		if( _EonBenchmarks_ )
+		{
+			for( auto& bench : *_EonBenchmarks_ )
+				delete bench.Factory;
+			delete _EonBenchmarks_;
+			_EonBenchmarks_ = nullptr;
+		}
+	}
+
+
+	static eon::string _fixed( double value, int decimals )
+	{
+		std::ostringstream strm;
+		strm << std::fixed << std::setprecision( decimals ) << value;
+		return eon::string( strm.str() );
+	}
+
+	static eon::string _duration( double ns )
+	{
+		if( ns < 1000.0 )
+			return _fixed( ns, 1 ) + " ns";
+		else if( ns < 1000000.0 )
+			return _fixed( ns / 1000.0, 2 ) + " us";
+		else if( ns < 1000000000.0 )
+			return _fixed( ns / 1000000.0, 2 ) + " ms";
+		else
+			return _fixed( ns / 1000000000.0, 2 ) + " s";
+	}
+
+	void _EonBenchmark::report( const eon::string& label, const eon::string& value )
+	{
+		eon::term << "   " << label.padRight( 56 ) << eon::style::blue << value << eon::style::normal << "\n";
+	}
+
+	void _EonBenchmark::_reportMeasurement( const eon::string& label, double ns_per_run, size_t bytes_per_run )
+	{
+		eon::term << "   " << label.padRight( 56 ) << eon::style::blue << _duration( ns_per_run ).padLeft( 12 )
+			<< eon::style::normal;
+		if( bytes_per_run > 0 )
+		{
+			auto mb_per_s = static_cast<double>( bytes_per_run ) / ns_per_run * 1000.0;
+			eon::term << "  " << eon::style::green << ( _fixed( mb_per_s, 1 ) + " MB/s" ).padLeft( 14 )
+				<< eon::style::normal;
+		}
+		eon::term << "\n";
+	}
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <list>
+#include <chrono>
+#include <eonstring/String.h>
+#include <eonterminal/Terminal.h>
+
+
+
+/******************************************************************************
+  The 'eonbench' namespace encloses all public benchmark functionality
+******************************************************************************/
+namespace eonbench
+{
+	// General macros
+#define BENCH_NAME( bench_class, bench_name ) bench_class##_##bench_name##_bench
+
+	// Create a benchmark
+	// Specify a benchmark class name and the name of the benchmark
+#define BENCHMARK( bench_class, bench_name )\
+	class BENCH_NAME( bench_class, bench_name ) : public bench_class {\
+	public:\
+		BENCH_NAME( bench_class, bench_name )() noexcept {}\
+	private:\
+		void bench_body() override;\
+	};\
+	bool bench_class##_##bench_name##_bench_dummy{\
+		::eonbench::_EonBenchmark::_registerEonBenchmark_( #bench_class, #bench_name,\
+		new ::eonbench::BenchmarkFactory<BENCH_NAME( bench_class, bench_name )>() ) };\
+	void BENCH_NAME( bench_class, bench_name )::bench_body()
+
+
+	class _EonBenchmark;
+
+	// Factory class for creating benchmark objects
+	class FactoryMain
+	{
+	public:
+		FactoryMain() = default;
+		virtual ~FactoryMain() = default;
+		virtual _EonBenchmark* createBenchmark() = 0;
+	};
+	template<typename T>
+	class BenchmarkFactory : public FactoryMain
+	{
+	public:
+		BenchmarkFactory() = default;
+		_EonBenchmark* createBenchmark() override { return new T(); }
+	};
+
+
+	// Make sure the optimizer doesn't remove the computation of a value we never use
+	template<typename T>
+	inline void keep( const T& value ) noexcept
+	{
+#if defined( __GNUC__ ) || defined( __clang__ )
+		asm volatile( "" : : "g"( &value ) : "memory" );
+#else
+		static const void* volatile sink{ nullptr };
+		sink = &value;
+#endif
+	}
+
+
+	// Super-class for benchmarks
+	class _EonBenchmark
+	{
+	public:
+		_EonBenchmark() = default;
+		virtual ~_EonBenchmark() = default;
+
+		void _runEonBenchmark_( std::chrono::milliseconds min_time ) { MinTime = min_time; prepare(); bench_body(); }
+
+	protected:
+		virtual void bench_body() = 0;
+
+		virtual void prepare() {}
+
+
+		// Run 'operation' repeatedly for at least the minimum measurement time
+		// and report the average time per run. If 'bytes_per_run' is not zero,
+		// the throughput is reported as well.
+		// Returns average time per run in nanoseconds.
+		template<typename Operation>
+		double measure( const eon::string& label, size_t bytes_per_run, Operation operation )
+		{
+			using clock = std::chrono::steady_clock;
+			operation();	// Warm up caches (and get a first estimate)
+			size_t runs = 0, batch = 1;
+			auto start = clock::now();
+			auto elapsed = clock::duration::zero();
+			while( elapsed < MinTime )
+			{
+				for( size_t i = 0; i < batch; ++i )
+					operation();
+				runs += batch;
+				batch *= 2;
+				elapsed = clock::now() - start;
+			}
+			auto ns = static_cast<double>(
+				std::chrono::duration_cast<std::chrono::nanoseconds>( elapsed ).count() ) / runs;
+			_reportMeasurement( label, ns, bytes_per_run );
+			return ns;
+		}
+
+		// Report a named value that isn't a time measurement (memory use, ratios, etc.).
+		void report( const eon::string& label, const eon::string& value );
+
+		// Get the minimum measurement time, for benchmarks that time themselves.
+		inline std::chrono::milliseconds minTime() const noexcept { return MinTime; }
+
+	private:
+		void _reportMeasurement( const eon::string& label, double ns_per_run, size_t bytes_per_run );
+
+	public:
+		struct BenchRef
+		{
+			std::string BenchClass;
+			std::string BenchName;
+			FactoryMain* Factory{ nullptr };
+			BenchRef() = default;
+			inline BenchRef( const std::string& bench_class, const std::string& bench_name, FactoryMain* factory ) {
+				BenchClass = bench_class; BenchName = bench_name; Factory = factory; }
+		};
+		static std::list<BenchRef>* _EonBenchmarks_;
+
+		// Register a new benchmark
+		static bool _registerEonBenchmark_(
+			const std::string& bench_class, const std::string& bench_name, FactoryMain* bench );
+
+		// Reset everything
+		static void _resetEon_() noexcept;
+
+	private:
+		std::chrono::milliseconds MinTime{ 250 };
+	};
+
+
+	// Standard benchmark class
+	class EonBenchmark : public _EonBenchmark {};
+}
@@ -0,0 +1,93 @@
+#include <iostream>
+#include <regex>
+#include "Benchmark.h"
+
+
+
+void usage( const std::string& prog )
+{
+	eon::term << "Usage: " << prog.c_str() << " [--eonfilter=<regex>] [--mintime=<milliseconds>]\n";
+	eon::term << "If run with filter, only benchmarks matching that filter regex pattern will be run.\n";
+	eon::term << "Each measurement runs for at least 'mintime' milliseconds (default is 250).\n";
+}
+
+class Args
+{
+public:
+	std::string Exe;
+	std::string Filter;
+	long MinTime{ 250 };
+	int Result = 0;
+};
+Args processArgs( int argc, const char* argv[] )
+{
+	if( argc == 0 )
+		exit( 4 );
+
+	Args args;
+	args.Exe = argv[ 0 ];
+	for( int i = 1; i < argc; ++i )
+	{
+		std::string arg( argv[ i ] );
+		if( arg == "--help" )
+		{
+			usage( args.Exe );
+			args.Result = -1;
+			break;
+		}
+		else if( arg.compare( 0, 12, "--eonfilter=" ) == 0 )
+			args.Filter = arg.substr( 12 );
+		else if( arg.compare( 0, 10, "--mintime=" ) == 0 )
+			args.MinTime = std::stol( arg.substr( 10 ) );
+	}
+
+	return args;
+}
+
+size_t runBenchmarks( const Args& args )
+{
+	using namespace eonbench;
+	if( !EonBenchmark::_EonBenchmarks_ )
+		return 0;
+
+	std::regex pattern( args.Filter );
+	size_t total = 0;
+	for( auto& bench : *EonBenchmark::_EonBenchmarks_ )
+	{
+		if( !args.Filter.empty() && !std::regex_match( bench.BenchClass + "." + bench.BenchName, pattern ) )
+			continue;
+		++total;
+		eon::string bench_name{ bench.BenchClass + "." + bench.BenchName };
+		eon::term << eon::style::note << "-- " << bench_name << " "
+			<< eon::string().padRight( 84 - bench_name.numChars(), '-' ) << eon::style::normal << "\n";
+		auto bench_obj = bench.Factory->createBenchmark();
+		try
+		{
+			bench_obj->_runEonBenchmark_( std::chrono::milliseconds( args.MinTime ) );
+		}
+		catch( std::exception& e )
+		{
+			eon::term << eon::style::error << " ERROR " << eon::style::normal << " std::exception: " << e.what() << "\n";
+		}
+		delete bench_obj;
+		eon::term << "\n";
+	}
+	return total;
+}
+
+
+int main( int argc, const char* argv[] )
+{
+	auto args = processArgs( argc, argv );
+	if( args.Result != 0 )
+		return args.Result < 0 ? 0 : args.Result;
+
+	auto total = runBenchmarks( args );
+	eonbench::EonBenchmark::_resetEon_();
+	if( total == 0 )
+	{
+		eon::term << eon::style::error << " No benchmarks have been defined! " << eon::style::normal << "\n";
+		return 4;
+	}
+	return 0;
+}
@@ -2,6 +2,7 @@
 #include <eoninlinetest/InlineTest.h>
 
 #include <fcntl.h>
+#include <cstring>
 #ifdef EON_WINDOWS
 #	include <io.h>
 #else
@@ -155,6 +156,26 @@ namespace eon
 		}
 		return false;
 	}
+	size_t filebuffer::read( char* bytes, size_t max_bytes )
+	{
+		size_t num{ 0 };
+		while( num < max_bytes )
+		{
+			if( BufPos == BufferSize )
+			{
+				if( BufferSize > 0 && BufferSize < BufferCapacity )
+					break;
+				_readBuffer();
+				if( BufferSize == 0 )
+					break;
+			}
+			auto size = std::min( max_bytes - num, BufferSize - BufPos );
+			std::memcpy( bytes + num, Buffer + BufPos, size );
+			BufPos += size;
+			num += size;
+		}
+		return num;
+	}
 
 
 
@@ -102,6 +102,10 @@ namespace eon
 		//* Returns false if end of file.
 		bool read( char_t& chr );
 
+		//* Read up to 'max_bytes' raw bytes into 'bytes'
+		//* Returns number of bytes read, 0 if end of file.
+		size_t read( char* bytes, size_t max_bytes );
+
 
 
 		/**********************************************************************
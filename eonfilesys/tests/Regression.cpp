@@ -286,4 +286,17 @@ namespace eon
 		auto str = string( ";" ).join( lines );
 		WANT_EQ( "Line 1;Second line;Third", str.stdstr() );
 	}
+	TEST( FileTest, buffer_read )
+	{
+		file f = path( sandbox() ) / "alpha";
+		REQUIRE_NO_EXCEPT( f.save( string( "Line 1\nSecond line\nThird" ) ) );
+		filebuffer buffer( f.fpath(), filesys::mode::input, 8 );
+		REQUIRE_NO_EXCEPT( buffer.open() ) << "Failed to open";
+		char bytes[ 16 ];
+		WANT_EQ( 16, buffer.read( bytes, 16 ) ) << "Wrong number of bytes in first read";
+		WANT_EQ( "Line 1\nSecond li", std::string( bytes, 16 ) ) << "Wrong bytes in first read";
+		WANT_EQ( 8, buffer.read( bytes, 16 ) ) << "Wrong number of bytes in last read";
+		WANT_EQ( "ne\nThird", std::string( bytes, 8 ) ) << "Wrong bytes in last read";
+		WANT_EQ( 0, buffer.read( bytes, 16 ) ) << "Read past end";
+	}
 }
@@ -85,7 +85,7 @@ namespace eon
 			void _parseBytesValue( EdfData& data );
 			void _parseStringValue( EdfData& data );
 			inline void _parseRegexValue( EdfData& data ) {
-				data.tuple().add( data.attributeName(), regex( data.tokens().viewed().str() ) ); }
+				data.tuple().add( data.attributeName(), regex::cached( data.tokens().viewed().str() ) ); }
 			inline void _parseNamepathValue( EdfData& data ) {
 				data.tuple().add( data.attributeName(), namepath( data.tokens().viewed().str() ) ); }
 			inline void _parsePathValue( EdfData& data ) {
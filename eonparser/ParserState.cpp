@@ -5,84 +5,104 @@ namespace eon
 {
 	namespace parser
 	{
-		void State::_initialize( source::Reporter& reporter )
+		Tokenizers::Tokenizers()
 		{
-			Tokenizer tokenizer;
-			_prepTokenizer( tokenizer );
-			ReTokenizer retokenizer;
-			_prepReTokenizer( retokenizer );
+			_prepTokenizer();
+			_prepReTokenizer();
+		}
 
-			TokenParser temp( tokenizer( *Source ) );
-			Tokens = TokenParser( retokenizer( temp ) );
-			Report = &reporter;
+		std::shared_ptr<const Tokenizers> Tokenizers::shared()
+		{
+			static const std::shared_ptr<const Tokenizers> tokenizers = std::make_shared<const Tokenizers>();
+			return tokenizers;
+		}
+
+		std::vector<Token> Tokenizers::operator()( source::Raw& source ) const
+		{
+			TokenParser raw( Tok( source ) );
+			return ReTok( raw );
 		}
 
-		void State::_prepTokenizer( Tokenizer& tokenizer )
+		void Tokenizers::_prepTokenizer()
 		{
-			tokenizer.registerEonNamesAsTokens();
-			tokenizer.registerSingleCharSequenceAsToken( ' ', name_space );
+			Tok.registerEonNamesAsTokens();
+			Tok.registerSingleCharSequenceAsToken( ' ', name_space );
 
-			tokenizer.registerSingleCharAsToken( '"', name_doublequote );
-			tokenizer.registerSingleCharAsToken( '\'', name_singlequote );
-			tokenizer.registerCharSequenceAsToken( charcat::number_ascii_digit, name_digits );
-			tokenizer.registerSingleCharAsToken( '_', name_underscore );
-			tokenizer.registerCharSequenceAsToken( charcat::letter_lowercase, name_letters );
-			tokenizer.registerCharSequenceAsToken( charcat::letter_uppercase, name_letters );
-			tokenizer.registerCharSequenceAsToken( charcat::letter_titlecase, name_letters );
-			tokenizer.registerCharSequenceAsToken( charcat::letter_modifier, name_letters );
-			tokenizer.registerCharSequenceAsToken( charcat::letter_other, name_letters );
-			tokenizer.registerSingleCharAsToken( '(', symbol_open_round );
-			tokenizer.registerSingleCharAsToken( ')', symbol_close_round );
-			tokenizer.registerSingleCharAsToken( '@', name_at );
-			tokenizer.registerSingleCharAsToken( '\\', name_backslash );
-			tokenizer.registerSingleCharAsToken( '=', symbol_assign );
-			tokenizer.registerSingleCharAsToken( '-', symbol_minus );
-			tokenizer.registerSingleCharSequenceAsToken( '.', symbol_point );
-			tokenizer.registerSingleCharSequenceAsToken( ':', symbol_colon );
-			tokenizer.registerSingleCharAsToken( ',', symbol_comma );
-			tokenizer.registerCharSequenceAsToken( "//", name( "line_comment" ) );
-			tokenizer.registerCharSequenceAsToken( "/-", name( "comment_start" ) );
-			tokenizer.registerCharSequenceAsToken( "-/", name( "comment_end" ) );
-			tokenizer.registerSingleCharAsToken( '/', symbol_divide );
-			tokenizer.registerSingleCharAsToken( ';', symbol_semicolon );
-			tokenizer.registerAnySingleCharAsToken( "+*~&|^<>[]", name_operator );
-			tokenizer.registerCharSequenceAsToken( "==", symbol_eq );
-			tokenizer.registerCharSequenceAsToken( "!=", symbol_ne );
-			tokenizer.registerCharSequenceAsToken( ">=", symbol_ge );
-			tokenizer.registerCharSequenceAsToken( "<=", symbol_le );
-			tokenizer.registerCharSequenceAsToken( "+=", symbol_plus_assign );
-			tokenizer.registerCharSequenceAsToken( "-=", symbol_minus_assign );
-			tokenizer.registerCharSequenceAsToken( "*=", symbol_multiply_assign );
-			tokenizer.registerCharSequenceAsToken( "/=", symbol_divide_assign );
-			tokenizer.registerCharSequenceAsToken( "'s", symbol_member );
-			tokenizer.registerCharSequenceAsToken( "<<", symbol_push );
-			tokenizer.registerCharSequenceAsToken( ">>", symbol_pull );
-			tokenizer.registerCharSequenceAsToken( "<=>", symbol_cmp );
-			tokenizer.registerCharSequenceAsToken( "T(", name_typetuple );
-			tokenizer.registerCharSequenceAsToken( "static(", name_static );
-			tokenizer.registerCharSequenceAsToken( "optional(", name_optional );
-			tokenizer.registerCharSequenceAsToken( "dynamic(", name_dynamic );
-			tokenizer.registerCharSequenceAsToken( "data(", name_data );
-			tokenizer.registerCharSequenceAsToken( "ex(", name_expression );
-			tokenizer.registerSingleCharAsToken( '#', name_hash );
+			Tok.registerSingleCharAsToken( '"', name_doublequote );
+			Tok.registerSingleCharAsToken( '\'', name_singlequote );
+			Tok.registerCharSequenceAsToken( charcat::number_ascii_digit, name_digits );
+			Tok.registerSingleCharAsToken( '_', name_underscore );
+			Tok.registerCharSequenceAsToken( charcat::letter_lowercase, name_letters );
+			Tok.registerCharSequenceAsToken( charcat::letter_uppercase, name_letters );
+			Tok.registerCharSequenceAsToken( charcat::letter_titlecase, name_letters );
+			Tok.registerCharSequenceAsToken( charcat::letter_modifier, name_letters );
+			Tok.registerCharSequenceAsToken( charcat::letter_other, name_letters );
+			Tok.registerSingleCharAsToken( '(', symbol_open_round );
+			Tok.registerSingleCharAsToken( ')', symbol_close_round );
+			Tok.registerSingleCharAsToken( '@', name_at );
+			Tok.registerSingleCharAsToken( '\\', name_backslash );
+			Tok.registerSingleCharAsToken( '=', symbol_assign );
+			Tok.registerSingleCharAsToken( '-', symbol_minus );
+			Tok.registerSingleCharSequenceAsToken( '.', symbol_point );
+			Tok.registerSingleCharSequenceAsToken( ':', symbol_colon );
+			Tok.registerSingleCharAsToken( ',', symbol_comma );
+			Tok.registerCharSequenceAsToken( "//", name( "line_comment" ) );
+			Tok.registerCharSequenceAsToken( "/-", name( "comment_start" ) );
+			Tok.registerCharSequenceAsToken( "-/", name( "comment_end" ) );
+			Tok.registerSingleCharAsToken( '/', symbol_divide );
+			Tok.registerSingleCharAsToken( ';', symbol_semicolon );
+			Tok.registerAnySingleCharAsToken( "+*~&|^<>[]", name_operator );
+			Tok.registerCharSequenceAsToken( "==", symbol_eq );
+			Tok.registerCharSequenceAsToken( "!=", symbol_ne );
+			Tok.registerCharSequenceAsToken( ">=", symbol_ge );
+			Tok.registerCharSequenceAsToken( "<=", symbol_le );
+			Tok.registerCharSequenceAsToken( "+=", symbol_plus_assign );
+			Tok.registerCharSequenceAsToken( "-=", symbol_minus_assign );
+			Tok.registerCharSequenceAsToken( "*=", symbol_multiply_assign );
+			Tok.registerCharSequenceAsToken( "/=", symbol_divide_assign );
+			Tok.registerCharSequenceAsToken( "'s", symbol_member );
+			Tok.registerCharSequenceAsToken( "<<", symbol_push );
+			Tok.registerCharSequenceAsToken( ">>", symbol_pull );
+			Tok.registerCharSequenceAsToken( "<=>", symbol_cmp );
+			Tok.registerCharSequenceAsToken( "T(", name_typetuple );
+			Tok.registerCharSequenceAsToken( "static(", name_static );
+			Tok.registerCharSequenceAsToken( "optional(", name_optional );
+			Tok.registerCharSequenceAsToken( "dynamic(", name_dynamic );
+			Tok.registerCharSequenceAsToken( "data(", name_data );
+			Tok.registerCharSequenceAsToken( "ex(", name_expression );
+			Tok.registerSingleCharAsToken( '#', name_hash );
 		}
-		void State::_prepReTokenizer( ReTokenizer& retokenizer )
+		void Tokenizers::_prepReTokenizer()
 		{
-			retokenizer.addRule( new ReTokenizer::EncloseRule( name_string, name_doublequote, name_backslash ) );
-			retokenizer.addRule( new ReTokenizer::PrefixEncloseRule( name_bytes, "B", name_doublequote, name_backslash ) );
-			retokenizer.addRule( new ReTokenizer::PrefixEncloseRule( name_path, "p", name_doublequote, name_backslash ) );
-			retokenizer.addRule( new ReTokenizer::EncloseRule( name_char, name_singlequote, name_backslash ) );
-			retokenizer.addRule( new ReTokenizer::PrefixEncloseRule( name_byte, "B", name_singlequote, name_backslash ) );
-			retokenizer.addRule( new ReTokenizer::PrefixEncloseRule( name_regex, "r", name_doublequote, name_backslash ) );
-			retokenizer.addRule( new ReTokenizer::LinestartRule( name_indentation, name_space ) );
-			retokenizer.addRule( new ReTokenizer::LiteralNameRule( name_bool, { "true", "false" } ) );
-			retokenizer.addRule( new ReTokenizer::SequenceRule( name_float, { name_digits, symbol_point, name_digits } ) );
-			retokenizer.addRule( new ReTokenizer::SequenceRule( name_literal, { name_hash, name_name } ) );
-			retokenizer.addRule( new ReTokenizer::PrefixAlternatingRule( name_namepath, "@", name_name, symbol_divide ) );
-			retokenizer.addRule( new ReTokenizer::EncloseRule( name_comment, name( "linecomment" ), name_newline ) );
-			retokenizer.addRule(
-				new ReTokenizer::EncloseRule( name_comment, name( "commentstart" ), name( "commentend" ) ) );
-			retokenizer.addRule( new ReTokenizer::RemoveRule( { name_space } ) );
+			ReTok.addRule( std::make_shared<ReTokenizer::EncloseRule>( name_string, name_doublequote, name_backslash ) );
+			ReTok.addRule(
+				std::make_shared<ReTokenizer::PrefixEncloseRule>( name_bytes, "B", name_doublequote, name_backslash ) );
+			ReTok.addRule(
+				std::make_shared<ReTokenizer::PrefixEncloseRule>( name_path, "p", name_doublequote, name_backslash ) );
+			ReTok.addRule( std::make_shared<ReTokenizer::EncloseRule>( name_char, name_singlequote, name_backslash ) );
+			ReTok.addRule(
+				std::make_shared<ReTokenizer::PrefixEncloseRule>( name_byte, "B", name_singlequote, name_backslash ) );
+			ReTok.addRule(
+				std::make_shared<ReTokenizer::PrefixEncloseRule>( name_regex, "r", name_doublequote, name_backslash ) );
+			ReTok.addRule( std::make_shared<ReTokenizer::LinestartRule>( name_indentation, name_space ) );
+			ReTok.addRule( std::make_shared<ReTokenizer::LiteralNameRule>( name_bool, std::set<string>{ "true", "false" } ) );
+			ReTok.addRule( std::make_shared<ReTokenizer::SequenceRule>(
+				name_float, std::vector<name_t>{ name_digits, symbol_point, name_digits } ) );
+			ReTok.addRule(
+				std::make_shared<ReTokenizer::SequenceRule>( name_literal, std::vector<name_t>{ name_hash, name_name } ) );
+			ReTok.addRule(
+				std::make_shared<ReTokenizer::PrefixAlternatingRule>( name_namepath, "@", name_name, symbol_divide ) );
+			ReTok.addRule(
+				std::make_shared<ReTokenizer::EncloseRule>( name_comment, name( "linecomment" ), name_newline ) );
+			ReTok.addRule(
+				std::make_shared<ReTokenizer::EncloseRule>( name_comment, name( "commentstart" ), name( "commentend" ) ) );
+			ReTok.addRule( std::make_shared<ReTokenizer::RemoveRule>( std::set<name_t>{ name_space } ) );
+		}
+
+		void State::_initialize( source::Reporter& reporter, const Tokenizers& tokenizers )
+		{
+			Tokens = TokenParser( tokenizers( *Source ) );
+			Report = &reporter;
 		}
 	}
 }
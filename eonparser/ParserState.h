@@ -40,6 +40,45 @@ namespace eon
 	//
 	namespace parser
 	{
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Eon Parser Tokenizers class - eon::parser::Tokenizers.
+		//
+		// The tokenizer and re-tokenizer configured for parsing.
+		// Configuring them costs more than tokenizing a small document, so
+		// this is done only once. The configuration is immutable, and the
+		// same object is shared by all [eon::parser::State]s, in all
+		// threads.
+		//
+		class Tokenizers
+		{
+		public:
+
+			// Configure for parsing
+			Tokenizers();
+
+			Tokenizers( const Tokenizers& ) = delete;
+			Tokenizers( Tokenizers&& ) = delete;
+
+			// Get the configuration shared by all states, made on first use
+			static std::shared_ptr<const Tokenizers> shared();
+
+
+			// Get re-tokenized tokens for a 'source'
+			std::vector<Token> operator()( source::Raw& source ) const;
+
+		private:
+			void _prepTokenizer();
+			void _prepReTokenizer();
+
+		private:
+			Tokenizer Tok;
+			ReTokenizer ReTok;
+		};
+
+
+
+
 		///////////////////////////////////////////////////////////////////////
 		//
 		// Eon Parser State class - eon::parser::State.
@@ -56,10 +95,15 @@ namespace eon
 
 			State() = default;
 
-			inline explicit State( string&& input_string, source::Reporter& reporter ) {
-				Source = std::make_shared<source::String>( "string", std::move( input_string ) ); _initialize( reporter ); }
-			inline explicit State( path input_file, source::Reporter& reporter ) {
-				Source = std::make_shared<source::File>( input_file.str() ); _initialize( reporter ); }
+			// Construct for an input string or file, using the shared
+			// tokenizers unless other 'tokenizers' are specified
+			inline explicit State( string&& input_string, source::Reporter& reporter,
+				const Tokenizers& tokenizers = *Tokenizers::shared() ) {
+				Source = std::make_shared<source::String>( "string", std::move( input_string ) );
+				_initialize( reporter, tokenizers ); }
+			inline explicit State( path input_file, source::Reporter& reporter,
+				const Tokenizers& tokenizers = *Tokenizers::shared() ) {
+				Source = std::make_shared<source::File>( input_file.str() ); _initialize( reporter, tokenizers ); }
 
 
 
@@ -70,9 +114,7 @@ namespace eon
 			//
 		private:
 
-			void _initialize( source::Reporter& reporter );
-			void _prepTokenizer( Tokenizer& tokenizer );
-			void _prepReTokenizer( ReTokenizer& retokenizer );
+			void _initialize( source::Reporter& reporter, const Tokenizers& tokenizers );
 
 
 
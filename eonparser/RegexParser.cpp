@@ -9,7 +9,7 @@ namespace eon
 		{
 			return expression::Node::newValue(
 				Attribute::newExplicit(
-					regex( state.Tokens.viewed().str() ),
+					regex::cached( state.Tokens.viewed().str() ),
 					name_regex,
 					type::Qualifier::_literal | type::Qualifier::_rvalue,
 					state.Tokens.viewed().source() ) );
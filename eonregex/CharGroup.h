@@ -61,9 +61,17 @@ namespace eon
 			inline CharGroup& operator=( CharGroup&& other ) noexcept {
 				*static_cast<Node*>( this ) = std::move( other ); Value = std::move( other.Value ); return *this; }
 
+			// Check if character 'c' is matched by the group, optionally
+			// ignoring case
+			bool matchChar( char_t c, bool icase ) const;
+
+			inline const CharGrp& value() const noexcept { return Value; }
+
 		private:
-			bool _match( RxData& data, index_t steps ) override;
-			bool _match( char_t chr );
+			bool _match( RxData& data, index_t steps ) const override;
+			bool _match( char_t chr ) const;
+			inline bool _compile( Program& program ) const override {
+				program.emitGroup( *this ); return true; }
 
 			inline string _strStruct() const override { return Value.str(); }
 
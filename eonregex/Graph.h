@@ -5,6 +5,7 @@
 #include "Node.h"
 #include "CharGroup.h"
 #include "OpOr.h"
+#include "Program.h"
 
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -31,7 +32,8 @@ namespace eon
 			Graph& operator=( const Graph& other );
 			Graph& operator=( Graph&& other ) noexcept;
 
-			inline void clear() noexcept { if( Head != nullptr ) { delete Head; Head = nullptr; } }
+			inline void clear() noexcept {
+				if( Head != nullptr ) { delete Head; Head = nullptr; } NumNodes = 0; Groups.clear(); Compiled.clear(); }
 
 			void parse( substring source, substring flags );
 
@@ -39,11 +41,33 @@ namespace eon
 
 			inline bool empty() const noexcept { return Head == nullptr; }
 
-			inline bool match( RxData& param ) const {
-				if( Head ) { Head->_unmatch(); return Head->match( param ); } else return false; }
+			// Get number of nodes, the [eon::rx::MatchState] must be reset for
+			// this number before matching.
+			inline index_t numNodes() const noexcept { return NumNodes; }
+
+			// Check if compiled into an [eon::rx::Program] for linear-time
+			// matching (if not, matching is done by backtracking the graph)
+			inline bool compiled() const noexcept { return !Compiled.empty(); }
+			inline const Program& program() const noexcept { return Compiled; }
+
+			// Check if matches can only start at the start of the input
+			inline bool startAnchored() const noexcept {
+				return Head != nullptr && !( MyFlags & Flag::no_prefilter ) && ( Head->PreAnchoring & Anchor::input ); }
+
+			// Match from the start of 'param', using the match state of
+			// 'param', and set captures in 'result'
+			bool match( RxData& param, rx::match& result ) const;
+
+			// Search for the first match in 'param' (must be compiled), and
+			// set captures in 'result'
+			inline bool search( RxData& param, rx::match& result ) const {
+				return !Head->_missingFixedEnd( param ) && Compiled.search( param, result ); }
 
 			inline const substring& source() const noexcept { return Source; }
 
+			// Get names of the capture groups, in order of appearance
+			inline const std::vector<name_t>& groups() const noexcept { return Groups; }
+
 			inline string strStruct() const { return Head ? Head->strStruct() : string(); }
 
 		private:
@@ -129,6 +153,9 @@ namespace eon
 			void _removeSuperfluousGroups() noexcept;
 			void _exposeLiterals();
 			void _failFastFixedEnd();
+			void _index() noexcept;
+			void _listGroups();
+			void _compile();
 
 
 
@@ -136,6 +163,9 @@ namespace eon
 		private:
 			substring Source;
 			Node* Head{ nullptr };
+			index_t NumNodes{ 0 };
+			std::vector<name_t> Groups;
+			Program Compiled;
 			Flag MyFlags{ Flag::none };
 		};
 	}
@@ -21,9 +21,32 @@ namespace eon
 		//
 		// The result of a regular expressions match or search.
 		//
+		// Captures are kept as positions in the source, in a fixed layout
+		// (the entire match first, then each named group of the expression).
+		// Up to 'NumInline' captures are stored inside the object, so that
+		// matching needs no heap allocations and a match object can be
+		// reused for the next match (see [eon::regex::matchInto]).
+		//
 		class match
 		{
 		public:
+			// Number of captures (including the entire match) stored inside
+			// the object, more than this are allocated
+			static const index_t NumInline{ 6 };
+
+			// A single capture
+			struct capture
+			{
+				name_t Name{ no_name };
+				const char* Begin{ nullptr };		// nullptr if not captured
+				const char* End{ nullptr };
+				index_t BeginChar{ 0 };
+				index_t EndChar{ 0 };
+			};
+
+
+
+
 			///////////////////////////////////////////////////////////////////
 			//
 			// Construction
@@ -33,15 +56,12 @@ namespace eon
 			match() = default;
 
 			// Copy the 'other' match
-			inline match( const match& other ) { *this = other; }
+			match( const match& other ) = default;
 
 			// Take ownership of the 'other' match
 			inline match( match&& other ) noexcept { *this = std::move( other ); }
 
-			// Construct from a map of [eon::name_t] to [eon::substring]
-			inline match( captures_t* captures ) noexcept { Captures = captures; }
-
-			inline virtual ~match() { clear(); }
+			virtual ~match() = default;
 
 
 
@@ -52,16 +72,14 @@ namespace eon
 			//
 
 			// Copy the 'other' match
-			inline match& operator=( const match& other ) {
-				clear(); if( other.Captures ) Captures = new captures_t( *other.Captures ); return *this; }
+			match& operator=( const match& other ) = default;
 
 			// Take ownership of the details of the 'other' match
-			inline match& operator=( match&& other ) noexcept {
-				clear(); if( other.Captures ) { Captures = other.Captures; other.Captures = nullptr; } return *this; }
+			match& operator=( match&& other ) noexcept;
 
 
 			// Clear this match
-			inline void clear() noexcept { if( Captures ) { delete Captures; Captures = nullptr; } }
+			inline void clear() noexcept { NumCaptures = 0; Overflow.clear(); }
 
 
 
@@ -72,29 +90,94 @@ namespace eon
 			//
 
 			// Check if there was a match
-			inline operator bool() const noexcept { return Captures; }
+			inline operator bool() const noexcept { return NumCaptures > 0 && _at( 0 ).Begin != nullptr; }
 
 			// Get number of captures (including the entire match)
-			inline index_t size() const noexcept { return Captures ? Captures->size() : 0; }
+			index_t size() const noexcept;
 
 			// Get the entire match
 			inline substring all() const noexcept { return group( name_complete ); }
 
 			// Get a capture
-			inline substring group( const name_t name ) const noexcept { if( !Captures ) return substring();
-				auto found = Captures->find( name ); return found != Captures->end() ? found->second : substring(); }
+			substring group( const name_t name ) const noexcept;
+
+
+			// Iterate over captures (including the entire match), as pairs
+			// of [eon::name_t] and [eon::substring]
+			class iterator
+			{
+			public:
+				iterator() = default;
+				inline iterator( const match& owner, index_t pos ) noexcept : Owner( &owner ), Pos( pos ) {
+					_skipUncaptured(); }
 
-			using iterator = captures_t::const_iterator;
-			inline iterator begin() const noexcept { return Captures ? Captures->begin() : iterator(); }
-			inline iterator end() const noexcept { return Captures ? Captures->end() : iterator(); }
+				inline std::pair<name_t, substring> operator*() const {
+					return std::make_pair( Owner->_at( Pos ).Name, Owner->_substr( Owner->_at( Pos ) ) ); }
+				inline iterator& operator++() noexcept { ++Pos; _skipUncaptured(); return *this; }
 
+				inline bool operator==( const iterator& other ) const noexcept { return Pos == other.Pos; }
+				inline bool operator!=( const iterator& other ) const noexcept { return Pos != other.Pos; }
 
+			private:
+				inline void _skipUncaptured() noexcept {
+					while( Owner && Pos < Owner->NumCaptures && Owner->_at( Pos ).Begin == nullptr ) ++Pos; }
 
+				const match* Owner{ nullptr };
+				index_t Pos{ 0 };
+			};
+			inline iterator begin() const noexcept { return iterator( *this, 0 ); }
+			inline iterator end() const noexcept { return iterator( *this, NumCaptures ); }
+
+
+
+
+			///////////////////////////////////////////////////////////////////
+			//
+			// Building (by the regular expression)
+			//
+		public:
 
+			// Prepare for matching in 'source' with captures for 'names'
+			// (in addition to the entire match, which is always first)
+			void layout( const string_iterator& source, const std::vector<name_t>& names );
+
+			// Set capture number 'num' (in the layout)
+			inline void set( index_t num, const char* begin, index_t begin_char, const char* end, index_t end_char ) noexcept {
+				auto& capt = _at( num ); capt.Begin = begin; capt.BeginChar = begin_char; capt.End = end;
+				capt.EndChar = end_char; }
+
+			// Set capture 'name' (adding it if not in the layout)
+			void set( name_t name, const substring& captured );
+
+
+
+
+			///////////////////////////////////////////////////////////////////
+			//
+			// Helpers
+			//
 		private:
-			captures_t* Captures{ nullptr };
+			inline capture& _at( index_t num ) noexcept {
+				return num < NumInline ? Inline[ num ] : Overflow[ num - NumInline ]; }
+			inline const capture& _at( index_t num ) const noexcept {
+				return num < NumInline ? Inline[ num ] : Overflow[ num - NumInline ]; }
+			capture& _add( name_t name );
+			inline substring _substr( const capture& capt ) const noexcept {
+				return substring( string_iterator( Source, capt.Begin, capt.BeginChar ),
+					string_iterator( Source, capt.End, capt.EndChar ) ); }
+
+
+
 
-			friend class RegEx;
+			///////////////////////////////////////////////////////////////////
+			//
+			// Attributes
+			//
+		private:
+			string_iterator Source;
+			index_t NumCaptures{ 0 };
+			capture Inline[ NumInline ];
+			std::vector<capture> Overflow;
 		};
 	}
 }
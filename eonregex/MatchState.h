@@ -0,0 +1,183 @@
+#pragma once
+
+#include "RxDefs.h"
+#include "RxData.h"
+#include "Program.h"
+#include <eoncontainers/Stack.h>
+#include <deque>
+#include <memory>
+
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// The 'eon' namespace encloses all public functionality
+//
+namespace eon
+{
+	///////////////////////////////////////////////////////////////////////////
+	//
+	// The 'eon::rx' namespace enclosed special elements for Eon regular
+	// expressions
+	//
+	namespace rx
+	{
+		class Dfa;
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Eon Regular Expression Match State Class - eon::rx::MatchState
+		//
+		// Everything that changes while matching an [eon::rx::Graph], kept
+		// apart from the graph so that the graph (and the [eon::regex]
+		// owning it) is never modified by matching. One state can be used
+		// with any number of graphs, but only by one thread at a time.
+		//
+		// The state is reused from one match to the next, so once it has
+		// grown to fit the graph, matching doesn't allocate any memory for
+		// it.
+		//
+		// The state also holds the scratch space of the Pike VM and the lazy
+		// DFAs of the most recently used [eon::rx::Program]s, so that DFA
+		// states built by one match are reused by the next.
+		//
+		class MatchState
+		{
+		public:
+			using Stack = stack<RxData>;
+
+			// Match-time details of a single node
+			struct NodeState
+			{
+				RxData Matched;				// Set while the node has a successful match
+				RecordedPos PrevPos;		// For loop detection in greedy ranges
+				string_iterator Start;		// Start of capture, for capture groups
+				bool Captured{ false };		// If capture was registered, for capture groups
+			};
+
+			// Scratch stack borrowed from the state for the lifetime of the
+			// object. Stacks must be returned in the reverse order of
+			// borrowing, which is ensured when used as local variables.
+			class ScratchStack
+			{
+			public:
+				ScratchStack() = delete;
+				inline ScratchStack( MatchState& state ) : State( state ), Data( state._borrowStack() ) {}
+				ScratchStack( const ScratchStack& ) = delete;
+				inline ~ScratchStack() { State._returnStack(); }
+
+				inline Stack& operator*() noexcept { return Data; }
+
+			private:
+				MatchState& State;
+				Stack& Data;
+			};
+
+			// Scratch space for one run of the Pike VM
+			struct Vm
+			{
+				// Thread list, as a sparse set of visited instructions and
+				// the threads at consuming (or match) instructions in
+				// priority order, each with its own slots
+				struct Threads
+				{
+					void prepare( index_t num_instructions, index_t num_slots );
+					inline void clear() noexcept { NumVisited = 0; NumThreads = 0; }
+
+					inline bool visited( uint32_t pc ) const noexcept {
+						return Sparse[ pc ] < NumVisited && Dense[ Sparse[ pc ] ] == pc; }
+					inline void visit( uint32_t pc ) noexcept { Sparse[ pc ] = NumVisited; Dense[ NumVisited++ ] = pc; }
+
+					inline void add( uint32_t pc, const SlotPos* slots, index_t num_slots ) noexcept {
+						Pcs[ NumThreads ] = pc; std::copy( slots, slots + num_slots, Slots.data() + NumThreads * num_slots );
+						++NumThreads; }
+
+					std::vector<uint32_t> Sparse, Dense;
+					index_t NumVisited{ 0 };
+					std::vector<uint32_t> Pcs;
+					std::vector<SlotPos> Slots;
+					index_t NumThreads{ 0 };
+				};
+
+				// Closure job, follow instruction 'Pc' or restore slot 'Slot'
+				// to 'Old'
+				struct Job
+				{
+					uint32_t Pc{ 0 };
+					uint32_t Slot{ 0 };
+					SlotPos Old;
+					bool Restore{ false };
+				};
+
+				Threads Lists[ 2 ];
+				std::vector<Job> Jobs;
+				std::vector<SlotPos> Slots;		// Slots of the thread being followed
+				std::vector<SlotPos> Matched;	// Slots of the (so far) best match
+				index_t Steps{ 0 };				// Instructions followed, for profiling
+			};
+
+			// Scratch VM borrowed from the state for the lifetime of the
+			// object, like [eon::rx::MatchState::ScratchStack]
+			class ScratchVm
+			{
+			public:
+				ScratchVm() = delete;
+				inline ScratchVm( MatchState& state ) : State( state ), Data( state._borrowVm() ) {}
+				ScratchVm( const ScratchVm& ) = delete;
+				inline ~ScratchVm() { --State.VmsInUse; }
+
+				inline Vm& operator*() noexcept { return Data; }
+
+			private:
+				MatchState& State;
+				Vm& Data;
+			};
+
+		public:
+			MatchState();
+			MatchState( const MatchState& ) = delete;
+			MatchState( MatchState&& ) = delete;
+			~MatchState();
+
+			MatchState& operator=( const MatchState& ) = delete;
+			MatchState& operator=( MatchState&& ) = delete;
+
+			// Get the state of the calling thread, used by [eon::regex] and
+			// [eon::regexset] when the caller doesn't provide one
+			static MatchState& forThread();
+
+
+			// Prepare for a new match using a graph with 'num_nodes' nodes
+			void reset( index_t num_nodes );
+
+			// Get state of node with the specified id
+			inline NodeState& node( index_t id ) noexcept { return Nodes[ id ]; }
+
+			// Get marker for a new match attempt
+			inline uint16_t nextMarker() noexcept { return ++Marker; }
+
+			// Get the lazy DFA of 'program'
+			// A limited number of DFAs are kept, the least recently used is
+			// discarded when the limit is reached.
+			Dfa& dfa( const Program& program );
+
+			// Get number of instructions followed by the Pike VM using this
+			// state, since it was created
+			index_t vmSteps() const noexcept;
+
+		private:
+			Stack& _borrowStack();
+			void _returnStack() noexcept;
+			Vm& _borrowVm();
+
+		private:
+			std::vector<NodeState> Nodes;
+			std::deque<Stack> Stacks;		// Deque so that borrowed stacks stay put when adding more
+			index_t StacksInUse{ 0 };
+			uint16_t Marker{ 0 };
+			std::deque<Vm> Vms;					// Deque for the same reason as 'Stacks'
+			index_t VmsInUse{ 0 };
+			std::vector<std::unique_ptr<Dfa>> Dfas;		// Most recently used first
+		};
+	}
+}
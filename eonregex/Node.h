@@ -2,8 +2,8 @@
 
 #include "RxDefs.h"
 #include "RxData.h"
+#include "MatchState.h"
 #include "Quantifier.h"
-#include <eoncontainers/Stack.h>
 
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -20,6 +20,9 @@ namespace eon
 	namespace rx
 	{
 		// Super-class for all operators, locations and values
+		// Nodes are not modified by matching, all match-time details are kept
+		// in the [eon::rx::MatchState] of the [eon::rx::RxData] (indexed by
+		// node id).
 		class Node
 		{
 		protected:
@@ -39,7 +42,15 @@ namespace eon
 			inline NodeType type() const noexcept { return Type; }
 			inline bool open() const noexcept { return Open; }
 
-			bool match( RxData& data, index_t steps = nsize );
+			bool match( RxData& data, index_t steps = nsize ) const;
+
+			// Compile this and all following nodes into 'program'
+			// Returns false if not possible.
+			bool compile( Program& program ) const;
+
+			// Get the longest literal that every match of this and all
+			// following nodes must contain (empty if none)
+			string requiredLiteral() const;
 
 
 			// Get node structure as a string
@@ -72,7 +83,16 @@ namespace eon
 			void combineFixed();
 
 		protected:
-			virtual bool _match( RxData& data, index_t steps ) = 0;
+			virtual bool _match( RxData& data, index_t steps ) const = 0;
+
+			// Compile a single occurrence of this node (the quantifier,
+			// anchoring, and name qualifier are taken care of by 'compile')
+			// Nodes that cannot be compiled return false.
+			virtual bool _compile( Program& program ) const { return false; }
+
+			// Get the longest literal that a single occurrence of this node
+			// must contain
+			virtual string _requiredLiteral() const { return string(); }
 
 			virtual string _strStruct() const { return string(); }
 
@@ -80,8 +100,8 @@ namespace eon
 			virtual void _removeDuplicates() {}
 			virtual void _combinedFixed() {}
 
-			using Stack = stack<RxData>;
-			inline Stack _stack() { Stack data; data.reserve( 53 ); return data; }
+			using Stack = MatchState::Stack;
+			inline MatchState::NodeState& _state( const RxData& data ) const noexcept { return data.state().node( Id ); }
 
 		public:
 			virtual index_t _countMinCharsRemaining() noexcept = 0;
@@ -89,32 +109,51 @@ namespace eon
 				if( Next ) Next = Next->_removeSuperfluousGroups(); return this; }
 			virtual Node* _exposeLiterals() { if( Next ) Next = Next->_exposeLiterals(); return this; }
 			virtual void _failFastFixedEnd( Node& head );
-			inline bool _matched() const noexcept { return static_cast<bool>( Matched.source() ); }
-			virtual void _unmatch() noexcept { if( _matched() ) { Matched = RxData(); if( Next ) Next->_unmatch(); } }
-			virtual void _capture( RxData& data ) {}
+
+			// Number this and all following (and contained) nodes, and link
+			// the last node of each group to the group.
+			// Must be done after all optimizations.
+			virtual void _index( index_t& num_nodes ) noexcept {
+				Id = num_nodes++; if( Next ) Next->_index( num_nodes ); }
+
+			// Add names of capture groups in this and all following (and
+			// contained) nodes to 'names', in order of appearance
+			virtual void _groups( std::vector<name_t>& names ) const { if( Next ) Next->_groups( names ); }
+
+			inline bool _matched( MatchState& state ) const noexcept {
+				return static_cast<bool>( state.node( Id ).Matched.source() ); }
+			virtual void _unmatch( MatchState& state ) const noexcept {
+				if( _matched( state ) ) { state.node( Id ).Matched = RxData(); if( Next ) Next->_unmatch( state ); } }
+			virtual void _capture( RxData& data ) const {}
+
+			// Check if there is a fixed end that is missing from the end of
+			// the input (for failing fast)
+			bool _missingFixedEnd( const RxData& data ) const;
 
 
 		private:
-			bool _matchSingle( RxData& data, index_t steps );
-			bool _matchOneOrZero( RxData& data, index_t steps );
-			bool _matchRangeGreedy( RxData& data, index_t steps );
-			void _matchMax( Stack& matches, index_t steps );
-			bool _matchSpecialCase( Stack& matches );
-			void _matchAny( Stack& matches );
-			bool _noNext( RxData& data, Stack& matches );
-			bool _matchNext( RxData& data, Stack& matches );
-			bool _matchRangeNongreedy( RxData& data, index_t steps );
+			bool _matchSingle( RxData& data, index_t steps ) const;
+			bool _matchOneOrZero( RxData& data, index_t steps ) const;
+			bool _matchRangeGreedy( RxData& data, index_t steps ) const;
+			void _matchMax( Stack& matches, index_t steps ) const;
+			bool _matchSpecialCase( Stack& matches ) const;
+			void _matchAny( Stack& matches ) const;
+			bool _noNext( RxData& data, Stack& matches ) const;
+			bool _matchNext( RxData& data, Stack& matches ) const;
+			bool _matchRangeNongreedy( RxData& data, index_t steps ) const;
+
+			bool _matchNext( RxData& data, index_t steps ) const;
 
-			bool _matchNext( RxData& data, index_t steps );
+			bool _preAnchorMatch( RxData& data ) const;
 
-			bool _preAnchorMatch( RxData& data );
+			bool _compileQuantified( Program& program ) const;
 
 			inline void _setGroup( Node* node ) noexcept {
 				if( Next ) Next->_setGroup( node ); else Group = node; }
 			inline Node* _next() const noexcept { return Group ? Group->Next : Next; }
 
 		protected:
-			RxData Matched;
+			index_t Id{ 0 };
 			Node* Next{ nullptr };
 			Node* Group{ nullptr };
 			Node* FixedEnd{ nullptr };
@@ -125,7 +164,6 @@ namespace eon
 			substring Source;
 			NodeType Type{ NodeType::undef };
 			Anchor PreAnchoring{ Anchor::none };
-			RecordedPos PrevPos;
 
 			friend class Graph;
 			friend class NodeGroup;
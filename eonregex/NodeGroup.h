@@ -38,7 +38,9 @@ namespace eon
 				Head = other.Head; other.Head = nullptr; return *this; }
 
 		protected:
-			bool _match( RxData& data, index_t steps ) override;
+			bool _match( RxData& data, index_t steps ) const override;
+			inline bool _compile( Program& program ) const override { return Head == nullptr || Head->compile( program ); }
+			inline string _requiredLiteral() const override { return Head ? Head->requiredLiteral() : string(); }
 
 			inline string _strStruct() const override { return Head ? "(" + Head->strStruct() + ")" : "()"; }
 
@@ -53,7 +55,12 @@ namespace eon
 					+ ( Next ? Next->_countMinCharsRemaining() : 0 ); }
 			virtual Node* _removeSuperfluousGroups() noexcept override;
 			void _failFastFixedEnd( Node& head ) override;
-			void _unmatch() noexcept override { if( Head->_matched() ) Head->_unmatch(); Node::_unmatch(); }
+			inline void _index( index_t& num_nodes ) noexcept override {
+				if( Head ) { Head->_setGroup( this ); Head->_index( num_nodes ); } Node::_index( num_nodes ); }
+			inline void _groups( std::vector<name_t>& names ) const override {
+				if( Head ) Head->_groups( names ); Node::_groups( names ); }
+			void _unmatch( MatchState& state ) const noexcept override {
+				if( Head->_matched( state ) ) Head->_unmatch( state ); Node::_unmatch( state ); }
 
 			void _append( Node* node ) noexcept;
 			inline bool _locked() const noexcept { return _Cur == nullptr; }
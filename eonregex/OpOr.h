@@ -35,7 +35,8 @@ namespace eon
 				*static_cast<Node*>( this ) = std::move( other ); Optionals = std::move( other.Optionals ); return *this; }
 
 		private:
-			bool _match( RxData& param, index_t steps ) override;
+			bool _match( RxData& param, index_t steps ) const override;
+			bool _compile( Program& program ) const override;
 			inline string _strStruct() const override {
 				string s; for( auto& opt : Optionals ) { if( !s.empty() ) s += "|"; s += opt->strStruct(); } return s; }
 			index_t _countMinCharsRemaining() noexcept override;
@@ -43,8 +44,12 @@ namespace eon
 			inline void _combinedFixed() override { for( auto node : Optionals ) node->combineFixed(); }
 			Node* _removeSuperfluousGroups() noexcept override;
 			void _failFastFixedEnd( Node& head ) override;
-			void _unmatch() noexcept override {
-				for( auto node : Optionals ) { if( node->_matched() ) node->_unmatch(); } Node::_unmatch(); }
+			inline void _index( index_t& num_nodes ) noexcept override {
+				for( auto node : Optionals ) node->_index( num_nodes ); Node::_index( num_nodes ); }
+			inline void _groups( std::vector<name_t>& names ) const override {
+				for( auto node : Optionals ) node->_groups( names ); Node::_groups( names ); }
+			void _unmatch( MatchState& state ) const noexcept override {
+				for( auto node : Optionals ) { if( node->_matched( state ) ) node->_unmatch( state ); } Node::_unmatch( state ); }
 
 		private:
 			std::vector<Node*> Optionals;
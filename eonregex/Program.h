@@ -0,0 +1,396 @@
+#pragma once
+
+#include "RxDefs.h"
+#include "Match.h"
+#include <eonstring/String.h>
+#include <bitset>
+
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// The 'eon' namespace encloses all public functionality
+//
+namespace eon
+{
+	///////////////////////////////////////////////////////////////////////////
+	//
+	// The 'eon::rx' namespace enclosed special elements for Eon regular
+	// expressions
+	//
+	namespace rx
+	{
+		class Node;
+		class CharGroup;
+		class RxData;
+		class MatchState;
+
+
+		class CharGroup;
+
+
+		// Character classes, for [eon::rx::Program::emitClass]
+		enum class CharClass : uint8_t
+		{
+			letter,				// \l
+			not_letter,			// \L
+			lower,				// \u
+			upper,				// \U
+			digit,				// \d
+			not_digit,			// \D
+			space,				// \s
+			not_space,			// \S
+			punctuation,		// \p
+			not_punctuation,	// \P
+			word,				// \w
+			not_word			// \W
+		};
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// A single instruction of an [eon::rx::Program]
+		//
+		struct Instruction
+		{
+			enum class op : uint8_t
+			{
+				// Consuming instructions, never match at end of input
+				chr,		// Consume 'Char'
+				chr_icase,	// Consume 'Char' (which is lower case), ignoring case
+				any,		// Consume any character
+				set,		// Consume character in character set 'X'
+
+				// Non-consuming instructions
+				split,		// Continue at 'X' and, with lower priority, at 'Y'
+				jump,		// Continue at 'X'
+				save,		// Record current position in slot 'X'
+				anchor,		// Fail unless pre-anchoring 'Anchoring' holds
+				word_end,	// Fail unless at end of word (\B)
+				end,		// Fail unless at end of input ($)
+				not_ahead,	// Fail if sub-program at 'X' matches here, otherwise continue at 'Y'
+				name,		// Fail unless input from position in slot 'X' is a valid name
+
+				match		// Matched!
+			};
+
+			Instruction() = default;
+			inline Instruction( op code, uint32_t x = 0, uint32_t y = 0 ) noexcept { Op = code; X = x; Y = y; }
+
+			inline bool consuming() const noexcept { return Op <= op::set; }
+
+			// 16 bytes, four instructions to a cache line
+			op Op{ op::match };
+			Anchor Anchoring{ Anchor::none };
+			char_t Char{ 0 };
+			uint32_t X{ 0 };
+			uint32_t Y{ 0 };
+		};
+
+
+		// Set of characters, for [eon::rx::Instruction::op::set]
+		// Characters below 256 are looked up in a bitmap. Others are looked
+		// up in a sorted table of ranges if that is exact, otherwise by the
+		// class or group the set was made from (for Unicode categories, and
+		// ignoring case).
+		struct CharSet
+		{
+			inline bool low( char_t c ) const noexcept { return ( Low[ c >> 6 ] >> ( c & 63 ) ) & 1; }
+			inline void addLow( char_t c ) noexcept { Low[ c >> 6 ] |= uint64_t( 1 ) << ( c & 63 ); }
+
+			uint64_t Low[ 4 ]{ 0, 0, 0, 0 };					// Characters 0-255
+			std::vector<std::pair<char_t, char_t>> Ranges;		// From 256, sorted and not overlapping
+			bool Negate{ false };								// If the ranges are of characters not in the set
+			bool Exact{ true };									// If the ranges (and 'Negate') are exact
+			CharClass Class{ CharClass::letter };
+			const CharGroup* Group{ nullptr };
+		};
+
+
+		// Position in the input, as recorded in a slot
+		struct SlotPos
+		{
+			const char* Byte{ nullptr };
+			index_t Char{ 0 };
+		};
+
+
+		// Characters around a position in the input, for zero-width
+		// assertions
+		struct Context
+		{
+			// Character details
+			static const uint8_t null{ 0x01 };
+			static const uint8_t newline{ 0x02 };
+			static const uint8_t space{ 0x04 };			// Separator space
+			static const uint8_t separator{ 0x08 };
+			static const uint8_t punctuation{ 0x10 };
+			static const uint8_t all{ 0x1F };
+
+			// Get details for character 'c'
+			static uint8_t details( char_t c ) noexcept;
+
+			uint8_t Prev{ 0 };		// Details of previous character (null if none)
+			uint8_t Cur{ 0 };		// Details of current character (none if at end)
+			bool AtEnd{ false };	// If at end of input
+			bool Start{ false };	// If at start of the (underlying) input
+		};
+
+		// Result of running the lazy DFA
+		enum class DfaResult : uint8_t
+		{
+			no_match,
+			match,
+			unknown,	// Gave up, too many states
+			partial		// Ran out of input, more is needed (when streaming)
+		};
+
+		// Details from feeding input to the lazy DFA, piece by piece, when
+		// streaming
+		// Positions are absolute, counted from the start of the stream.
+		struct StreamScan
+		{
+			int32_t State{ -1 };			// DFA state to continue from (negative to start anew)
+			bool Found{ false };			// If a match has been seen
+			index_t ResumeByte{ 0 };		// Where to continue from
+			index_t ResumeChar{ 0 };
+			index_t IdleByte{ 0 };			// Last position before the match with nothing in progress
+			index_t IdleChar{ 0 };
+			index_t EndByte{ 0 };			// End of the match
+			index_t EndChar{ 0 };
+
+			// Start anew from 'byte', 'chr'
+			inline void restart( index_t byte, index_t chr ) noexcept {
+				State = -1; Found = false; ResumeByte = IdleByte = byte; ResumeChar = IdleChar = chr; }
+		};
+
+		// Details from running a set of programs on the lazy DFA
+		struct SetScan
+		{
+			bool Collect{ false };			// Collect all matching patterns in 'Patterns'
+			bool FirstOnly{ false };		// Stop at the first match
+			std::vector<index_t> Patterns;
+			std::vector<bool> Seen;
+			index_t Longest{ no_index };	// Lowest numbered pattern of the last match seen
+			string_iterator End;			// End of the last match seen
+			string_iterator Idle;			// Last position before the first match with nothing in progress
+
+			inline void clear() noexcept {
+				Patterns.clear(); Seen.clear(); Longest = no_index; End = string_iterator(); Idle = string_iterator(); }
+		};
+
+
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Eon Regular Expression Program Class - eon::rx::Program
+		//
+		// An [eon::rx::Graph] compiled into a sequence of NFA instructions,
+		// for matching in time linear to the size of the input (for a given
+		// expression). All alternatives are followed in parallel by a Pike
+		// VM that records captures, or by a lazily built DFA when no
+		// captures are needed.
+		//
+		// Backreferences cannot be compiled, graphs with those must be
+		// matched by backtracking.
+		//
+		// The program is immutable once compiled, everything that changes
+		// while matching is in the [eon::rx::MatchState].
+		//
+		class Program
+		{
+		public:
+			// Programs are limited in size, larger graphs are backtracked
+			static const index_t MaxSize{ 10000 };
+
+			// Sets of programs are limited in (total) size
+			static const index_t MaxSetSize{ 1000000 };
+
+			// Character sets with more (ASCII) characters than this are too
+			// broad to skip ahead by
+			static const index_t MaxFirstSet{ 16 };
+
+			Program() = default;
+			Program( const Program& ) = delete;
+			inline Program( Program&& other ) noexcept { *this = std::move( other ); }
+			~Program() = default;
+
+			Program& operator=( const Program& ) = delete;
+			Program& operator=( Program&& other ) noexcept;
+
+
+			// Compile the nodes starting at 'head' to be matched using
+			// 'flags'
+			// Returns false (leaving the program empty) if the nodes cannot be
+			// compiled.
+			bool compile( const Node& head, Flag flags );
+
+			// Add the (compiled) 'program' to this set of programs, matching
+			// as pattern number [eon::rx::Program::setSize()] (before adding)
+			// All programs in a set must have the same flags, and the set can
+			// only be run on the lazy DFA (see [eon::regexset]).
+			// Returns false (leaving the set as is) if the program cannot be
+			// run on the lazy DFA, or the set would grow too large.
+			bool addToSet( const Program& program );
+
+			inline void clear() noexcept {
+				Code.clear(); Sets.clear(); Captures.clear(); Groups.clear(); NumSlots = 0; DfaCompatible = false; UsesContext = false; Serial = 0;
+				StartAnchored = false; Prefix.clear(); Required.clear(); FirstBytes.reset(); SkipByFirstByte = false;
+				SetSize = 0; SetTail = 0; }
+
+
+			inline bool empty() const noexcept { return Code.empty(); }
+			inline index_t size() const noexcept { return Code.size(); }
+			inline const Instruction& operator[]( uint32_t pc ) const noexcept { return Code[ pc ]; }
+
+			inline Flag flags() const noexcept { return Flags; }
+
+			// Get number of slots (two for the complete match, two for each
+			// capture, and one for each '{name}' qualifier)
+			inline index_t numSlots() const noexcept { return NumSlots; }
+
+			// Check if there are any capture groups
+			inline bool hasCaptures() const noexcept { return !Captures.empty(); }
+
+			// Check if the program can be run on the lazy DFA (no 'not' and
+			// no '{name}')
+			inline bool dfaCompatible() const noexcept { return DfaCompatible; }
+
+			// Check if the program depends on the characters around the
+			// position (anchors and boundaries)
+			inline bool context() const noexcept { return UsesContext; }
+
+			// Check if matches can only start at the start of the input
+			inline bool startAnchored() const noexcept { return StartAnchored; }
+
+			// Check if there are literals to skip ahead to where a match can
+			// start
+			inline bool skips() const noexcept { return !Prefix.empty() || SkipByFirstByte; }
+
+			// Get size (in bytes) of the literal prefix every match starts
+			// with (0 if none)
+			inline index_t prefixSize() const noexcept { return Prefix.size(); }
+
+			// Check if a set of programs, and get the number of programs in it
+			inline bool isSet() const noexcept { return SetSize > 0; }
+			inline index_t setSize() const noexcept { return SetSize; }
+
+			// Unique identity of the compiled program, for caching
+			inline uint64_t serial() const noexcept { return Serial; }
+
+
+			// Get names of capture groups, in the layout used for
+			// [eon::rx::match] (after the entire match)
+			inline const std::vector<name_t>& groups() const noexcept { return Groups; }
+
+
+			// Match from the position of 'data', advance past the match and
+			// set all captures in 'result'
+			bool match( RxData& data, rx::match& result ) const;
+
+			// Search for the first match from the position of 'data' to the
+			// end of its source
+			// Advances past the match and sets all captures in 'result'.
+			bool search( RxData& data, rx::match& result ) const;
+
+
+
+
+			///////////////////////////////////////////////////////////////////
+			//
+			// Building (by the nodes)
+			//
+		public:
+
+			// Add instruction, get its position
+			inline uint32_t emit( const Instruction& instruction ) {
+				Code.push_back( instruction ); return static_cast<uint32_t>( Code.size() - 1 ); }
+
+			// Add instruction consuming a character of class 'char_class',
+			// get its position
+			uint32_t emitClass( CharClass char_class );
+
+			// Add instruction consuming a character matched by 'group',
+			// get its position
+			uint32_t emitGroup( const CharGroup& group );
+
+			// Get position of the next instruction to be added
+			inline uint32_t pc() const noexcept { return static_cast<uint32_t>( Code.size() ); }
+
+			// Get instruction for patching
+			inline Instruction& at( uint32_t pc ) noexcept { return Code[ pc ]; }
+
+			// Check if the program has grown too large
+			inline bool full() const noexcept { return Code.size() > MaxSize; }
+
+			// Get a new slot
+			inline uint32_t newSlot() noexcept { return static_cast<uint32_t>( NumSlots++ ); }
+
+			// Get the first of two new slots for a capture named 'name'
+			uint32_t newCapture( name_t name );
+
+
+
+
+			///////////////////////////////////////////////////////////////////
+			//
+			// Helpers
+			//
+		public:
+
+			// Check if a consuming 'instruction' matches character 'c'
+			bool consumes( const Instruction& instruction, char_t c ) const noexcept;
+
+			// Check if a zero-width assertion (anchor, word_end, or end)
+			// holds in 'context'
+			bool holds( const Instruction& instruction, const Context& context ) const noexcept;
+
+			// Skip 'pos' ahead to the next position (before 'end', a byte
+			// position) where a match can start, using the literal prefix or
+			// the possible first bytes
+			// Returns false if there is no such position.
+			bool skip( string_iterator& pos, const char* end ) const noexcept;
+
+		private:
+			class Vm;
+
+			// Find literals, anchoring and first bytes for skipping
+			void _analyze( const Node& head );
+
+			// Add the possible first bytes of a match to 'bytes'
+			// Returns false if not known.
+			bool _firstBytes( std::bitset<256>& bytes ) const noexcept;
+
+			// Check if character 'c' is of class 'char_class'
+			static bool _inClass( CharClass char_class, char_t c ) noexcept;
+
+			// Add 'set' and get an instruction consuming from it
+			uint32_t _emitSet( CharSet&& set );
+
+			void _registerCaptures( RxData& data, const SlotPos* slots, rx::match& result ) const;
+			DfaResult _dfa( RxData& data, bool anchored, string_iterator& end, string_iterator* start = nullptr ) const;
+
+		private:
+			std::vector<Instruction> Code;
+			std::vector<CharSet> Sets;
+			std::vector<std::pair<index_t, uint32_t>> Captures;		// Group number (in layout) and first slot
+			std::vector<name_t> Groups;
+			index_t NumSlots{ 0 };
+			Flag Flags{ Flag::none };
+			bool DfaCompatible{ false };
+			bool UsesContext{ false };
+			uint64_t Serial{ 0 };
+
+			// Prefilter details
+			bool StartAnchored{ false };
+			std::string Prefix;				// Bytes (UTF-8) every match starts with
+			std::string Required;			// Literal (UTF-8) every match contains
+			std::bitset<256> FirstBytes;	// Possible first bytes of a match
+			bool SkipByFirstByte{ false };
+
+			// Set details
+			index_t SetSize{ 0 };
+			uint32_t SetTail{ 0 };			// Jump to the last program in the set
+		};
+	}
+}
@@ -1,68 +1,373 @@
 #include "RegEx.h"
+#include "sources/Cache.h"
+#include "sources/Pool.h"
+#include <algorithm>
+#include <iterator>
+#include <exception>
+#include <string_view>
 
 
 namespace eon
 {
-	rx::match regex::match( const substring& str ) const
+	// Part of a replacement, literal text followed by a capture (if not
+	// 'no_name')
+	struct ReplacementPart
 	{
-		if( str.empty() || Graph.empty() )
-			return rx::match();
+		std::string Literal;
+		name_t Group{ no_name };
+	};
 
-		rx::RxData data( str, Graph.flags(), ++((regex*)this)->Marker );
-		string::iterator start = data.pos();
-		if( Graph.match( data ) )
+	// Split 'replacement' into parts, resolving references to 'groups'
+	static std::vector<ReplacementPart> _replacementParts( const string& replacement, const std::vector<name_t>& groups )
+	{
+		std::vector<ReplacementPart> parts( 1 );
+		auto& bytes = replacement.stdstr();
+		auto unknown = [&]( const std::string& ref ) {
+			throw rx::InvalidExpression( "Replacement refers to unknown group: " + ref ); };
+		for( size_t i = 0; i < bytes.size(); )
 		{
-			data.registerCapture( name_complete, substring( start, data.pos() ) );
-			return rx::match( data.claimCaptures() );
+			if( bytes[ i ] != '@' || i + 1 == bytes.size() || ( bytes[ i + 1 ] != '@' && bytes[ i + 1 ] != ':' ) )
+			{
+				parts.back().Literal += bytes[ i++ ];
+				continue;
+			}
+			if( bytes[ i + 1 ] == '@' )
+			{
+				parts.back().Literal += '@';
+				i += 2;
+				continue;
+			}
+
+			name_t group{ no_name };
+			size_t end{ i + 2 };
+			if( end < bytes.size() && bytes[ end ] == '<' )
+			{
+				end = bytes.find( '>', end );
+				if( end == std::string::npos )
+					unknown( bytes.substr( i ) );
+				++end;
+				group = name( std::string( bytes, i + 3, end - i - 4 ) );
+				if( group != name_complete && std::find( groups.begin(), groups.end(), group ) == groups.end() )
+					unknown( bytes.substr( i, end - i ) );
+			}
+			else if( end < bytes.size() && bytes[ end ] >= '0' && bytes[ end ] <= '9' )
+			{
+				size_t num{ 0 };
+				for( ; end < bytes.size() && bytes[ end ] >= '0' && bytes[ end ] <= '9'; ++end )
+					num = num * 10 + ( bytes[ end ] - '0' );
+				if( num > groups.size() )
+					unknown( bytes.substr( i, end - i ) );
+				group = num == 0 ? name_complete : groups[ num - 1 ];
+			}
+			else
+			{
+				parts.back().Literal += '@';
+				++i;
+				continue;
+			}
+			parts.back().Group = group;
+			parts.emplace_back();
+			i = end;
 		}
-		else
-			return rx::match();
+		return parts;
+	}
+
+
+	regex regex::cached( const string& pattern, const string& flags )
+	{
+		auto& cache = rx::Cache::instance();
+		auto key = rx::Cache::key( pattern, flags );
+		regex expression;
+		if( cache.find( key, expression ) )
+			return expression;
+
+		// Parse without holding the cache, another thread may add the same
+		// expression at the same time (and one of them will be kept)
+		expression = regex( pattern, flags );
+		cache.add( std::move( key ), expression );
+		return expression;
+	}
+
+
+	rx::match regex::match( const substring& str ) const
+	{
+		return match( str, rx::MatchState::forThread() );
+	}
+	rx::match regex::match( const substring& str, rx::MatchState& state ) const
+	{
+		rx::match result;
+		matchInto( str, result, state );
+		return result;
+	}
+	bool regex::matchInto( const substring& str, rx::match& result ) const
+	{
+		return matchInto( str, result, rx::MatchState::forThread() );
+	}
+	bool regex::matchInto( const substring& str, rx::match& result, rx::MatchState& state ) const
+	{
+		result.clear();
+		if( str.empty() || _empty() )
+			return false;
+
+		state.reset( Graph->numNodes() );
+		rx::RxData data( str, Graph->flags(), state );
+		if( Graph->match( data, result ) )
+			return true;
+		result.clear();
+		return false;
 	}
 
 	rx::match regex::findFirst( const substring& str ) const
 	{
-		if( str.empty() || Graph.empty() )
-			return rx::match();
+		return findFirst( str, rx::MatchState::forThread() );
+	}
+	rx::match regex::findFirst( const substring& str, rx::MatchState& state ) const
+	{
+		rx::match result;
+		findFirstInto( str, result, state );
+		return result;
+	}
+	bool regex::findFirstInto( const substring& str, rx::match& result ) const
+	{
+		return findFirstInto( str, result, rx::MatchState::forThread() );
+	}
+	bool regex::findFirstInto( const substring& str, rx::match& result, rx::MatchState& state ) const
+	{
+		result.clear();
+		if( str.empty() || _empty() )
+			return false;
 
+		state.reset( Graph->numNodes() );
+		if( Graph->compiled() )
+		{
+			rx::RxData data( str, Graph->flags(), state );
+			if( Graph->search( data, result ) )
+				return true;
+			result.clear();
+			return false;
+		}
 		for( auto pos = str.begin(); pos != str.end(); ++pos )
 		{
-			rx::RxData data( substring( pos, str.end() ), Graph.flags(), ++( (regex*)this )->Marker );
-			if( Graph.match( data ) )
-			{
-				data.registerCapture( name_complete, substring( pos, data.pos() ) );
-				return rx::match( data.claimCaptures() );
-			}
+			// Only one place to try if anchored at the start
+			if( pos.numChar() > 0 && Graph->startAnchored() )
+				break;
+			rx::RxData data( substring( pos, str.end() ), Graph->flags(), state );
+			if( Graph->match( data, result ) )
+				return true;
 		}
-		return rx::match();
+		result.clear();
+		return false;
 	}
+
 	rx::match regex::findLast( const substring& str ) const
 	{
-		if( str.empty() || Graph.empty() )
-			return rx::match();
+		return findLast( str, rx::MatchState::forThread() );
+	}
+	rx::match regex::findLast( const substring& str, rx::MatchState& state ) const
+	{
+		rx::match result;
+		if( str.empty() || _empty() )
+			return result;
 
+		state.reset( Graph->numNodes() );
 		for( auto pos = str.last(); pos; --pos )
 		{
-			rx::RxData data( substring( pos, str.end() ), Graph.flags(), ++( (regex*)this )->Marker );
-			if( Graph.match( data ) )
+			rx::RxData data( substring( pos, str.end() ), Graph->flags(), state );
+			if( Graph->match( data, result ) )
 			{
-				data.registerCapture( name_complete, substring( pos - 1, data.pos() ) );
-				return rx::match( data.claimCaptures() );
+				result.set( name_complete, substring( pos - 1, data.pos() ) );
+				return result;
 			}
 		}
-		return rx::match();
+		result.clear();
+		return result;
 	}
+
 	std::vector<rx::match> regex::findAll( const substring& str ) const
+	{
+		return findAll( str, rx::MatchState::forThread() );
+	}
+	std::vector<rx::match> regex::findAll( const substring& str, rx::MatchState& state ) const
 	{
 		std::vector<rx::match> matches;
 		string::iterator pos = str.begin();
 		while( pos )
 		{
-			auto found = findFirst( substring( pos, str.end() ) );
-			if( !found )
+			// Find straight into the result, no need to copy
+			matches.emplace_back();
+			if( !findFirstInto( substring( pos, str.end() ), matches.back(), state ) )
+			{
+				matches.pop_back();
 				break;
-			matches.push_back( found );
-			pos = found.group( name_complete ).end();
+			}
+			pos = matches.back().group( name_complete ).end();
 		}
 		return matches;
 	}
+
+
+
+
+	// Size of the pieces searched by findAllParallel (before adjusting to
+	// the delimiter)
+	static const index_t PieceSize{ 4 * 1024 * 1024 };
+
+	std::vector<rx::match> regex::findAllParallel( const substring& str, char_t delimiter, index_t num_threads ) const
+	{
+		std::vector<rx::match> matches;
+		if( str.empty() || _empty() )
+			return matches;
+		auto& pool = rx::Pool::instance();
+		if( num_threads == 0 )
+			num_threads = pool.maxThreads();
+
+		// Split after delimiters, into at least a few pieces per thread
+		auto piece_size = std::min( PieceSize, str.numBytes() / ( 4 * num_threads ) + 1 );
+		auto delim = string( delimiter ).stdstr();
+		std::string_view bytes( str.begin().byteData(), str.numBytes() );
+		std::vector<index_t> ends;
+		for( size_t pos = 0; pos < bytes.size(); )
+		{
+			auto found = pos + piece_size < bytes.size() ? bytes.find( delim, pos + piece_size ) : std::string_view::npos;
+			pos = found != std::string_view::npos ? found + delim.size() : bytes.size();
+			ends.push_back( pos );
+		}
+
+		// The first character of each piece, counted in parallel unless
+		// there are only single byte characters
+		std::vector<index_t> chars( ends.size() + 1, 0 );
+		bool ascii = str.numBytes() == str.numChars();
+		auto start = [&ends]( index_t piece ) { return piece > 0 ? ends[ piece - 1 ] : 0; };
+		if( !ascii )
+		{
+			pool.run( ends.size(), num_threads, [&]( index_t piece ) {
+				index_t count{ 0 };
+				for( auto i = start( piece ); i < ends[ piece ]; ++i )
+				{
+					if( ( bytes[ i ] & 0xC0 ) != 0x80 )
+						++count;
+				}
+				chars[ piece + 1 ] = count; } );
+			for( index_t piece = 1; piece < chars.size(); ++piece )
+				chars[ piece ] += chars[ piece - 1 ];
+		}
+		auto iterator = [&]( index_t byte, index_t piece ) {
+			return string_iterator( str.begin(), bytes.data() + byte, str.begin().numChar()
+				+ ( ascii ? byte : chars[ piece ] ) ); };
+
+		// Search each piece as findAll, but on from the next character after
+		// an empty match
+		std::vector<std::vector<rx::match>> found( ends.size() );
+		std::vector<std::exception_ptr> errors( ends.size() );
+		pool.run( ends.size(), num_threads, [&]( index_t piece ) {
+			try
+			{
+				auto& state = rx::MatchState::forThread();
+				auto end = ends[ piece ] < bytes.size() ? iterator( ends[ piece ], piece + 1 ) : str.end();
+				auto pos = iterator( start( piece ), piece );
+				auto& piece_found = found[ piece ];
+				while( pos != end )
+				{
+					piece_found.emplace_back();
+					if( !findFirstInto( substring( pos, end ), piece_found.back(), state ) )
+					{
+						piece_found.pop_back();
+						break;
+					}
+					auto all = piece_found.back().all();
+					pos = all.end();
+					if( all.empty() )
+					{
+						if( pos == end )
+							break;
+						++pos;
+					}
+				}
+			}
+			catch( ... )
+			{
+				errors[ piece ] = std::current_exception();
+			} } );
+
+		for( index_t piece = 0; piece < found.size(); ++piece )
+		{
+			if( errors[ piece ] )
+				std::rethrow_exception( errors[ piece ] );
+			if( matches.empty() )
+				matches = std::move( found[ piece ] );
+			else
+				std::move( found[ piece ].begin(), found[ piece ].end(), std::back_inserter( matches ) );
+		}
+		return matches;
+	}
+
+	string regex::replace( const substring& str, const string& replacement ) const
+	{
+		auto parts = _replacementParts( replacement, Graph ? Graph->groups() : std::vector<name_t>() );
+		return replace( str, [&parts]( const rx::match& found, std::string& output ) {
+			for( auto& part : parts )
+			{
+				output += part.Literal;
+				if( part.Group != no_name )
+				{
+					auto captured = found.group( part.Group );
+					output.append( captured.begin().byteData(), captured.numBytes() );
+				}
+			} } );
+	}
+
+	string regex::replace( const substring& str, const replacer& replace_with ) const
+	{
+		std::string output;
+		output.reserve( str.numBytes() + str.numBytes() / 8 );
+		auto& state = rx::MatchState::forThread();
+		rx::match found;
+		auto pos = str.begin();
+		while( pos != str.end() && findFirstInto( substring( pos, str.end() ), found, state ) )
+		{
+			auto all = found.all();
+			output.append( pos.byteData(), all.begin().byteData() - pos.byteData() );
+			replace_with( found, output );
+			pos = all.end();
+
+			// Keep the character after an empty match, and search on from
+			// the next
+			if( all.empty() && pos != str.end() )
+			{
+				auto next = pos + 1;
+				output.append( pos.byteData(), next.byteData() - pos.byteData() );
+				pos = next;
+			}
+		}
+		output.append( pos.byteData(), str.end().byteData() - pos.byteData() );
+		return string( std::move( output ) );
+	}
+
+
+
+
+	regex::cachestats regex::cacheStats()
+	{
+		return rx::Cache::instance().stats();
+	}
+
+	void regex::cacheCapacity( index_t capacity )
+	{
+		rx::Cache::instance().capacity( capacity );
+	}
+
+	void regex::clearCache()
+	{
+		rx::Cache::instance().clear();
+	}
+
+
+
+
+	void regex::_parse()
+	{
+		auto graph = std::make_shared<rx::Graph>();
+		graph->parse( Raw.substr(), Flags.substr() );
+		Graph = std::move( graph );
+	}
 }
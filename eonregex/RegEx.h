@@ -2,7 +2,10 @@
 #include "Graph.h"
 #include "Match.h"
 #include "RxData.h"
+#include "MatchState.h"
 #include <eonexcept/Exception.h>
+#include <memory>
+#include <functional>
 
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17,6 +20,15 @@ namespace eon
 	//
 	// Regular expressions on [eon::string]s.
 	//
+	// Matching doesn't modify the expression, so the same regex object can
+	// be used from multiple threads at the same time. The match-time details
+	// are kept in an [eon::rx::MatchState], one per thread unless the caller
+	// provides one.
+	//
+	// The compiled expression is immutable, and shared by copies. Use
+	// [eon::regex::cached] to share it with all expressions using the same
+	// pattern and flags, parsing and compiling only once.
+	//
 	class regex
 	{
 	public:
@@ -38,17 +50,15 @@ namespace eon
 		// WARNING: Will throw InvalidExpression if invalid formatting.
 		//          The exception message will contain details about what's
 		//          wrong with the 'expression' string.
-		inline regex( string expression, string flags = string() ) {
-			Raw = expression; Flags = flags; Graph.parse( Raw.substr(), Flags.substr() ); }
-		inline regex( substring expression, substring flags ) {
-			Raw = expression; Flags = flags; Graph.parse( Raw.substr(), Flags.substr() ); }
+		inline regex( string expression, string flags = string() ) { Raw = expression; Flags = flags; _parse(); }
+		inline regex( substring expression, substring flags ) { Raw = expression; Flags = flags; _parse(); }
 
 		// Construct for an std::string 'expression'
 		// WARNING: Will throw InvalidExpression if invalid formatting.
 		//          The exception message will contain details about what's
 		//          wrong with the 'expression' string.
 		inline regex( const std::string& expression, std::string flags = std::string() ) {
-			Raw = substring( expression ); Flags = substring( flags ); Graph.parse( Raw.substr(), Flags.substr() ); }
+			Raw = substring( expression ); Flags = substring( flags ); _parse(); }
 
 		// Construct for a 'const char*' (C-string)
 		// WARNING: Will throw InvalidExpression if invalid formatting.
@@ -56,11 +66,20 @@ namespace eon
 		//          wrong with the 'expression' string.
 		inline regex( const char* expression, const char* flags = nullptr ) {
 			if( expression ) Raw = substring( expression ); if( flags ) Flags = substring( flags );
-			Graph.parse( Raw.substr(), Flags.substr() ); }
+			_parse(); }
 
 		// Construct for a source
 
 
+		// Get an expression for 'pattern' and 'flags' from a process-wide
+		// cache, parsing and compiling only if not already there
+		// The least recently used expressions are dropped when the cache is
+		// full (which doesn't affect expressions already gotten from it).
+		// WARNING: Will throw InvalidExpression if invalid formatting.
+		//          (Invalid expressions are not cached.)
+		static regex cached( const string& pattern, const string& flags = string() );
+
+
 		// Default destruction
 		virtual ~regex() = default;
 
@@ -72,7 +91,7 @@ namespace eon
 		// Modifier Methods
 		//
 
-		// Copy the 'other' expression
+		// Copy the 'other' expression, sharing the compiled details
 		inline regex& operator=( const regex& other ) {
 			Graph = other.Graph; Raw = other.Raw; Flags = other.Flags; return *this; }
 
@@ -83,7 +102,7 @@ namespace eon
 
 
 		// Clear this expression
-		inline void clear() noexcept { Graph.clear(); Raw.clear(); Flags.clear(); }
+		inline void clear() noexcept { Graph.reset(); Raw.clear(); Flags.clear(); }
 
 
 
@@ -103,7 +122,7 @@ namespace eon
 		inline const string& flags() const noexcept { return Flags; }
 
 		// Get the complete (optimized) pattern
-		inline string strStruct() const { return Graph.strStruct(); }
+		inline string strStruct() const { return Graph ? Graph->strStruct() : string(); }
 
 
 
@@ -126,6 +145,20 @@ namespace eon
 		inline rx::match match( const std::string& str ) const { return match( substring( str ) ); }
 		inline rx::match match( const char* str ) const { return match( substring( str ) ); }
 
+		// Match using a caller-owned match 'state'
+		// (Which must not be used by other threads at the same time.)
+		rx::match match( const substring& str, rx::MatchState& state ) const;
+
+		// Match into a caller-owned 'result', reusing it instead of
+		// returning a new match object
+		// Returns true if matched (and 'result' is then also 'true').
+		bool matchInto( const substring& str, rx::match& result ) const;
+		inline bool matchInto( const string& str, rx::match& result ) const { return matchInto( str.substr(), result ); }
+		inline bool matchInto( const std::string& str, rx::match& result ) const {
+			return matchInto( substring( str ), result ); }
+		inline bool matchInto( const char* str, rx::match& result ) const { return matchInto( substring( str ), result ); }
+		bool matchInto( const substring& str, rx::match& result, rx::MatchState& state ) const;
+
 		// Find the first section of the [eon::substring] that matches
 		// Returns an [eon::rx::match] object that is either 'true' if there
 		// were a match or 'false' if not. If 'true', then use
@@ -137,6 +170,20 @@ namespace eon
 		inline rx::match findFirst( const std::string& str ) const { return findFirst( substring( str ) ); }
 		inline rx::match findFirst( const char* str ) const { return findFirst( substring( str ) ); }
 
+		// Find first match using a caller-owned match 'state'
+		// (Which must not be used by other threads at the same time.)
+		rx::match findFirst( const substring& str, rx::MatchState& state ) const;
+
+		// Find first match into a caller-owned 'result', reusing it instead
+		// of returning a new match object
+		// Returns true if found (and 'result' is then also 'true').
+		bool findFirstInto( const substring& str, rx::match& result ) const;
+		inline bool findFirstInto( const string& str, rx::match& result ) const { return findFirstInto( str.substr(), result ); }
+		inline bool findFirstInto( const std::string& str, rx::match& result ) const {
+			return findFirstInto( substring( str ), result ); }
+		inline bool findFirstInto( const char* str, rx::match& result ) const { return findFirstInto( substring( str ), result ); }
+		bool findFirstInto( const substring& str, rx::match& result, rx::MatchState& state ) const;
+
 		// Find the last section of the [eon::substring that matches]
 		// Returns an [eon::rx::match] object that is either 'true' if there
 		// were a match or 'false' if not. If 'true', then use
@@ -148,6 +195,10 @@ namespace eon
 		inline rx::match findLast( const std::string& str ) const { return findLast( substring( str ) ); }
 		inline rx::match findLast( const char* str ) const { return findLast( substring( str ) ); }
 
+		// Find last match using a caller-owned match 'state'
+		// (Which must not be used by other threads at the same time.)
+		rx::match findLast( const substring& str, rx::MatchState& state ) const;
+
 		// Find all matches of the pattern within the specified string
 		// NOTE: There will be no overlaps! A found item is bypassed completely when searching for the next.
 		// Returns a vector of matches, in order. Empty if none matched.
@@ -156,11 +207,99 @@ namespace eon
 		inline std::vector<rx::match> findAll( const std::string& str ) const { return findAll( substring( str ) ); }
 		inline std::vector<rx::match> findAll( const char* str ) const { return findAll( substring( str ) ); }
 
+		// Find all matches using a caller-owned match 'state'
+		// (Which must not be used by other threads at the same time.)
+		std::vector<rx::match> findAll( const substring& str, rx::MatchState& state ) const;
+
+		// Find all matches, splitting 'str' into pieces that are searched on
+		// up to 'num_threads' threads at the same time (0 for one per core)
+		// Each piece ends after a 'delimiter' character, and the expression
+		// itself must not match it - such as "[^\n]+" (not ".+" or "\s",
+		// which also match newline). The "l" flag is not enough, as it only
+		// changes "^" and "$". Matches spanning two pieces are not found,
+		// and the end of each piece is seen as the end of the input.
+		// Returns a vector of matches, in order, as for findAll.
+		std::vector<rx::match> findAllParallel( const substring& str, char_t delimiter = NewlineChr,
+			index_t num_threads = 0 ) const;
+		inline std::vector<rx::match> findAllParallel( const string& str, char_t delimiter = NewlineChr,
+			index_t num_threads = 0 ) const { return findAllParallel( str.substr(), delimiter, num_threads ); }
+
+
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Replacing
+		//
+
+		// Function appending the replacement for the 'found' match to
+		// 'output' (as UTF-8 bytes)
+		using replacer = std::function<void( const rx::match& found, std::string& output )>;
+
+		// Replace all matches in 'str' with 'replacement'
+		// The replacement can refer to captures of the match: "@:<A>" for
+		// group A, and "@:N" for group number N, where 0 is the entire match
+		// and the named groups are numbered from 1 in the order they appear
+		// in the expression. Use "@@" for a literal "@".
+		// NOTE: As for findAll, matches do not overlap. After an empty
+		//       match, the next character is kept before searching again.
+		// WARNING: Will throw InvalidExpression if 'replacement' refers to a
+		//          group that is not in the expression.
+		string replace( const substring& str, const string& replacement ) const;
+		inline string replace( const string& str, const string& replacement ) const {
+			return replace( str.substr(), replacement ); }
+
+		// Replace all matches in 'str' with whatever 'replace_with' appends
+		// to the output
+		// The output is built in a single buffer, and validated as UTF-8
+		// only once, at the end.
+		// WARNING: Will throw InvalidUTF8 if the output is not valid UTF-8.
+		string replace( const substring& str, const replacer& replace_with ) const;
+		inline string replace( const string& str, const replacer& replace_with ) const {
+			return replace( str.substr(), replace_with ); }
+
+
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Cache
+		//
+
+		// Default max number of expressions in the cache
+		static const index_t DefCacheCapacity{ 1000 };
+
+		// Cache counters
+		struct cachestats
+		{
+			index_t Hits{ 0 };			// Expressions found in the cache
+			index_t Misses{ 0 };		// Expressions not found (and parsed)
+			index_t Size{ 0 };			// Number of expressions in the cache
+			index_t Capacity{ 0 };		// Max number of expressions
+		};
+
+		// Get the cache counters
+		static cachestats cacheStats();
+
+		// Set max number of expressions in the cache, dropping the least
+		// recently used if there are more than that
+		static void cacheCapacity( index_t capacity );
+
+		// Drop all expressions from the cache, and reset the counters
+		static void clearCache();
+
 
 
 	private:
-		rx::Graph Graph;
+		void _parse();
+
+		inline bool _empty() const noexcept { return !Graph || Graph->empty(); }
+
+	private:
+		std::shared_ptr<const rx::Graph> Graph;
 		string Raw, Flags;
-		int Marker{ 0 };
+
+		friend class regexset;
+		friend class regexstream;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,205 @@
+#include "RegExSet.h"
+#include "sources/Dfa.h"
+
+
+namespace eon
+{
+	regexset::regexset( std::initializer_list<string> patterns, string flags )
+	{
+		Flags = std::move( flags );
+		for( auto& pattern : patterns )
+			add( pattern );
+	}
+
+
+	regexset& regexset::operator=( const regexset& other )
+	{
+		// Compiled programs refer to the nodes of the patterns, and must be
+		// combined anew
+		clear();
+		Flags = other.Flags;
+		for( auto& pattern : other.Patterns )
+			add( pattern.str() );
+		return *this;
+	}
+
+	regexset& regexset::operator=( regexset&& other ) noexcept
+	{
+		Patterns = std::move( other.Patterns );
+		Flags = std::move( other.Flags );
+		Combined = std::move( other.Combined );
+		Ids = std::move( other.Ids );
+		Separate = std::move( other.Separate );
+		All = std::move( other.All );
+		other.clear();
+		return *this;
+	}
+
+
+	index_t regexset::add( const string& pattern )
+	{
+		regex expression{ pattern, Flags };
+		auto num = Patterns.size();
+		Patterns.push_back( std::move( expression ) );
+		All.push_back( num );
+		auto& graph = *Patterns.back().Graph;
+		if( graph.compiled() && !( graph.flags() & rx::Flag::no_dfa ) && Combined.addToSet( graph.program() ) )
+			Ids.push_back( num );
+		else
+			Separate.push_back( num );
+		return num;
+	}
+
+
+
+
+	std::vector<index_t> regexset::match( const substring& str ) const
+	{
+		return match( str, rx::MatchState::forThread() );
+	}
+	std::vector<index_t> regexset::match( const substring& str, rx::MatchState& state ) const
+	{
+		std::vector<index_t> found;
+		if( str.empty() )
+			return found;
+		rx::SetScan scan;
+		scan.Collect = true;
+		bool dfa = _scan( str, true, scan, state );
+		if( dfa )
+		{
+			for( auto id : scan.Patterns )
+				found.push_back( Ids[ id ] );
+		}
+		for( auto num : dfa ? Separate : All )
+		{
+			if( Patterns[ num ].match( str, state ) )
+				found.push_back( num );
+		}
+		std::sort( found.begin(), found.end() );
+		return found;
+	}
+
+	std::vector<index_t> regexset::find( const substring& str ) const
+	{
+		return find( str, rx::MatchState::forThread() );
+	}
+	std::vector<index_t> regexset::find( const substring& str, rx::MatchState& state ) const
+	{
+		std::vector<index_t> found;
+		if( str.empty() )
+			return found;
+		rx::SetScan scan;
+		scan.Collect = true;
+		bool dfa = _scan( str, false, scan, state );
+		if( dfa )
+		{
+			for( auto id : scan.Patterns )
+				found.push_back( Ids[ id ] );
+		}
+		for( auto num : dfa ? Separate : All )
+		{
+			if( Patterns[ num ].findFirst( str, state ) )
+				found.push_back( num );
+		}
+		std::sort( found.begin(), found.end() );
+		return found;
+	}
+
+	regexset::hit regexset::matchLongest( const substring& str ) const
+	{
+		return matchLongest( str, rx::MatchState::forThread() );
+	}
+	regexset::hit regexset::matchLongest( const substring& str, rx::MatchState& state ) const
+	{
+		hit best;
+		if( str.empty() )
+			return best;
+		rx::SetScan scan;
+		bool dfa = _scan( str, true, scan, state );
+		if( dfa && scan.Longest != no_index )
+			best = hit{ Ids[ scan.Longest ], substring( str.begin(), scan.End ) };
+		for( auto num : dfa ? Separate : All )
+		{
+			auto found = Patterns[ num ].match( str, state );
+			if( found )
+				_prefer( best, num, found.all() );
+		}
+		return best;
+	}
+
+	regexset::hit regexset::findLongest( const substring& str ) const
+	{
+		return findLongest( str, rx::MatchState::forThread() );
+	}
+	regexset::hit regexset::findLongest( const substring& str, rx::MatchState& state ) const
+	{
+		hit best;
+		if( str.empty() )
+			return best;
+
+		// The leftmost match cannot start after the end of the first match
+		// found, nor before the last position where nothing was in progress.
+		// The first position in between with a longest match has the
+		// leftmost-longest match.
+		rx::SetScan scan;
+		scan.FirstOnly = true;
+		bool dfa = _scan( str, false, scan, state );
+		if( dfa && scan.Longest != no_index )
+		{
+			rx::SetScan longest;
+			for( auto pos = scan.Idle; dfa; ++pos )
+			{
+				dfa = _scan( substring( pos, str.end() ), true, longest, state );
+				if( dfa && longest.Longest != no_index )
+				{
+					best = hit{ Ids[ longest.Longest ], substring( pos, longest.End ) };
+					break;
+				}
+				if( pos.byteData() >= scan.End.byteData() )
+					break;
+			}
+			if( !dfa )
+				best = hit();
+		}
+		for( auto num : dfa ? Separate : All )
+		{
+			auto found = Patterns[ num ].findFirst( str, state );
+			if( found )
+				_prefer( best, num, found.all() );
+		}
+		return best;
+	}
+
+
+
+
+	bool regexset::_scan( const substring& str, bool anchored, rx::SetScan& scan, rx::MatchState& state ) const
+	{
+		if( Combined.empty() )
+			return true;
+		auto& dfa = state.dfa( Combined );
+		for( int attempt = 0; attempt < 2; ++attempt )
+		{
+			scan.clear();
+			if( dfa.runSet( Combined, str.begin(), str.end().byteData(), anchored, scan ) != rx::DfaResult::unknown )
+				return true;
+
+			// Too many states, start over with none
+			dfa.reset( Combined );
+		}
+		return false;
+	}
+
+	void regexset::_prefer( hit& best, index_t pattern, const substring& found ) noexcept
+	{
+		if( best )
+		{
+			auto start = found.begin().byteData(), best_start = best.Match.begin().byteData();
+			auto end = found.end().byteData(), best_end = best.Match.end().byteData();
+			if( start > best_start || ( start == best_start && ( end < best_end
+				|| ( end == best_end && pattern > best.Pattern ) ) ) )
+				return;
+		}
+		best = hit{ pattern, found };
+	}
+}
@@ -0,0 +1,180 @@
+#pragma once
+#include "RegEx.h"
+
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// The 'eon' namespace encloses all public functionality
+//
+namespace eon
+{
+	///////////////////////////////////////////////////////////////////////////
+	//
+	// Eon Regular Expression Set Class - eon::regexset
+	//
+	// A set of regular expressions (patterns), all with the same flags, that
+	// are matched together in a single pass over the input.
+	//
+	// Each pattern is parsed and compiled as for [eon::regex], and the
+	// compiled programs are combined into one that is run on the lazy DFA.
+	// The cost of matching therefore depends on the size of the input more
+	// than on the number of patterns. Patterns that cannot be run on the DFA
+	// (backreferences, 'not' and '{name}') are matched one at a time, using
+	// their ordinary (leftmost-first) matches.
+	//
+	// Patterns are numbered from 0, in the order added.
+	//
+	// Like [eon::regex], the same set can be used from multiple threads at
+	// the same time.
+	//
+	class regexset
+	{
+	public:
+		// Result of a longest match
+		struct hit
+		{
+			index_t Pattern{ no_index };	// Number of the pattern
+			substring Match;				// The entire match
+
+			inline operator bool() const noexcept { return Pattern != no_index; }
+		};
+
+
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Construction
+		//
+
+		// Default constructor for empty set
+		regexset() = default;
+
+		// Copy the 'other' set
+		inline regexset( const regexset& other ) { *this = other; }
+
+		// Take ownership of the 'other' set
+		inline regexset( regexset&& other ) noexcept { *this = std::move( other ); }
+
+		// Construct empty set, for patterns with 'flags'
+		explicit inline regexset( string flags ) { Flags = std::move( flags ); }
+
+		// Construct for 'patterns' with 'flags'
+		// WARNING: Will throw InvalidExpression if any pattern is invalid.
+		regexset( std::initializer_list<string> patterns, string flags = string() );
+
+		// Default destruction
+		virtual ~regexset() = default;
+
+
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Modifier Methods
+		//
+
+		// Copy the 'other' set
+		regexset& operator=( const regexset& other );
+
+		// Take ownership of the details of the 'other' set
+		regexset& operator=( regexset&& other ) noexcept;
+
+
+		// Add a pattern, get its number
+		// WARNING: Will throw InvalidExpression if invalid formatting.
+		index_t add( const string& pattern );
+
+		// Clear all patterns (keeping the flags)
+		inline void clear() noexcept { Patterns.clear(); Combined.clear(); Ids.clear(); Separate.clear(); All.clear(); }
+
+
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Read-only Methods
+		//
+
+		// Check if there are any patterns
+		inline bool empty() const noexcept { return Patterns.empty(); }
+
+		// Get number of patterns
+		inline index_t size() const noexcept { return Patterns.size(); }
+
+		// Get pattern number 'num' as a separate expression
+		inline const regex& operator[]( index_t num ) const noexcept { return Patterns[ num ]; }
+
+		// Get the flags (of all patterns)
+		inline const string& flags() const noexcept { return Flags; }
+
+
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Matching and Searching
+		//
+
+		// Get numbers of all patterns that match from the start of 'str' (as
+		// for [eon::regex::match]), in increasing order
+		std::vector<index_t> match( const substring& str ) const;
+		inline std::vector<index_t> match( const string& str ) const { return match( str.substr() ); }
+		inline std::vector<index_t> match( const char* str ) const { return match( substring( str ) ); }
+		std::vector<index_t> match( const substring& str, rx::MatchState& state ) const;
+
+		// Get numbers of all patterns that match anywhere in 'str' (as for
+		// [eon::regex::findFirst]), in increasing order
+		std::vector<index_t> find( const substring& str ) const;
+		inline std::vector<index_t> find( const string& str ) const { return find( str.substr() ); }
+		inline std::vector<index_t> find( const char* str ) const { return find( substring( str ) ); }
+		std::vector<index_t> find( const substring& str, rx::MatchState& state ) const;
+
+		// Get the longest match from the start of 'str', of any pattern
+		// The lowest numbered pattern wins if several match equally long.
+		hit matchLongest( const substring& str ) const;
+		inline hit matchLongest( const string& str ) const { return matchLongest( str.substr() ); }
+		inline hit matchLongest( const char* str ) const { return matchLongest( substring( str ) ); }
+		hit matchLongest( const substring& str, rx::MatchState& state ) const;
+
+		// Get the leftmost-longest match in 'str', of any pattern
+		// The match that starts first wins, then the longest, then the
+		// lowest numbered pattern.
+		hit findLongest( const substring& str ) const;
+		inline hit findLongest( const string& str ) const { return findLongest( str.substr() ); }
+		inline hit findLongest( const char* str ) const { return findLongest( substring( str ) ); }
+		hit findLongest( const substring& str, rx::MatchState& state ) const;
+
+
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Helpers
+		//
+	private:
+
+		// Run the combined program on 'str'
+		// Returns false if the DFA gave up, the caller must then match all
+		// patterns separately.
+		bool _scan( const substring& str, bool anchored, rx::SetScan& scan, rx::MatchState& state ) const;
+
+		// Keep 'found' (for 'pattern') in 'best' if it is better
+		static void _prefer( hit& best, index_t pattern, const substring& found ) noexcept;
+
+
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Attributes
+		//
+	private:
+		std::vector<regex> Patterns;
+		string Flags;
+		rx::Program Combined;
+		std::vector<index_t> Ids;			// Pattern number of each program in 'Combined'
+		std::vector<index_t> Separate;		// Patterns not in 'Combined'
+		std::vector<index_t> All;			// All pattern numbers, for when the DFA gives up
+	};
+}
@@ -0,0 +1,172 @@
+#include "RegExStream.h"
+#include "sources/Dfa.h"
+
+
+namespace eon
+{
+	regexstream::regexstream( const regex& expression, index_t window_size )
+	{
+		if( expression._empty() || !expression.Graph->compiled() || !expression.Graph->program().dfaCompatible() )
+			throw rx::InvalidExpression( "Expression cannot be streamed: " + expression.str().stdstr() );
+		Expression = &expression;
+		WindowSize = std::max<index_t>( window_size, 2 * ChunkSize );
+	}
+
+
+
+
+	index_t regexstream::scan( const reader& read, const callback& on_match )
+	{
+		auto& program = Expression->Graph->program();
+		auto& dfa = State.dfa( program );
+		Window.clear();
+		BaseByte = 0;
+		BaseChar = 0;
+		rx::StreamScan scan;
+		found match;
+		index_t num_found{ 0 }, last_empty{ no_index };
+		bool at_end{ false };
+		while( true )
+		{
+			auto size = Window.size();
+			Window.resize( size + ChunkSize );
+			auto num_read = read( &Window[ size ], ChunkSize );
+			Window.resize( size + num_read );
+			at_end = num_read == 0;
+
+			// Only complete characters are fed, the rest must wait for the
+			// next piece
+			auto complete = at_end ? Window.size() : _complete();
+			string_iterator source( Window.c_str(), complete );
+			auto at = [&]( index_t byte, index_t chr ) {
+				return string_iterator( source, Window.c_str() + ( byte - BaseByte ), chr - BaseChar ); };
+			const char* end = Window.c_str() + complete;
+			bool failed{ false };
+			while( true )
+			{
+				auto result = dfa.feed( program, at( scan.ResumeByte, scan.ResumeChar ), end, at_end, scan );
+				if( result == rx::DfaResult::partial )
+					break;
+				if( result == rx::DfaResult::no_match )
+					return num_found;
+				if( result == rx::DfaResult::unknown )
+				{
+					// Too many states, start over with none - from the last
+					// idle position, or give up on the match in progress
+					// if that doesn't help
+					dfa.reset( program );
+					if( failed )
+						scan.restart( scan.ResumeByte, scan.ResumeChar );
+					else
+						scan.restart( scan.IdleByte, scan.IdleChar );
+					failed = true;
+					continue;
+				}
+				failed = false;
+
+				// The DFA knows where the match ends, get the captures by
+				// matching from the last idle position (an empty match at
+				// the end of the input has none)
+				auto from = at( scan.IdleByte, scan.IdleChar );
+				auto start_byte = scan.IdleByte;
+				bool extracted{ true };
+				if( from.byteData() < end )
+					extracted = Expression->findFirstInto( substring( from, source.getEnd() ), match.Match, State );
+				else
+				{
+					match.Match.clear();
+					match.Match.set( name_complete, substring( from, from ) );
+				}
+				if( extracted )
+				{
+					auto all = match.Match.all();
+					match.StartByte = BaseByte + ( all.begin().byteData() - Window.c_str() );
+					match.StartChar = BaseChar + all.begin().numChar();
+					match.EndByte = BaseByte + ( all.end().byteData() - Window.c_str() );
+					match.EndChar = BaseChar + all.end().numChar();
+					if( match.StartByte != match.EndByte || match.EndByte != last_empty )
+					{
+						++num_found;
+						if( !on_match( match ) )
+							return num_found;
+					}
+					start_byte = match.StartByte;
+					scan.EndByte = match.EndByte;
+					scan.EndChar = match.EndChar;
+				}
+
+				// Continue after the match, and never twice from the same
+				// empty match
+				if( scan.EndByte == start_byte )
+				{
+					last_empty = scan.EndByte;
+					auto next = at( scan.EndByte, scan.EndChar );
+					if( next.byteData() >= end )
+					{
+						if( at_end )
+							return num_found;
+						scan.restart( scan.EndByte, scan.EndChar );
+						break;
+					}
+					++next;
+					scan.restart( BaseByte + ( next.byteData() - Window.c_str() ), BaseChar + next.numChar() );
+				}
+				else
+					scan.restart( scan.EndByte, scan.EndChar );
+			}
+			if( at_end )
+				return num_found;
+			_trim( scan, source );
+		}
+	}
+
+	index_t regexstream::scan( source::Raw& source, const callback& on_match )
+	{
+		index_t pos{ 0 };
+		return scan( [&]( char* buffer, index_t size ) {
+			auto num = source.read( pos, buffer, size ); pos += num; return num; }, on_match );
+	}
+
+
+
+
+	index_t regexstream::_complete() const noexcept
+	{
+		// Find the start of the last character, and check if all its bytes
+		// are there
+		auto size = Window.size();
+		for( index_t back = 1; back <= 4 && back <= size; ++back )
+		{
+			auto byte = static_cast<unsigned char>( Window[ size - back ] );
+			if( ( byte & 0xC0 ) == 0x80 )
+				continue;
+			index_t length = byte < 0xC0 ? 1 : byte < 0xE0 ? 2 : byte < 0xF0 ? 3 : 4;
+			return length > back ? size - back : size;
+		}
+		return size;
+	}
+
+	void regexstream::_trim( rx::StreamScan& scan, const string_iterator& source )
+	{
+		// Keep one character before where a match can start, for anchors
+		// and word boundaries
+		auto keep_byte = std::min( scan.IdleByte, scan.ResumeByte ), keep_char = std::min( scan.IdleChar, scan.ResumeChar );
+
+		// A match in progress that is too long is given up on
+		if( Window.size() - ( keep_byte - BaseByte ) > WindowSize / 2 )
+		{
+			scan.restart( scan.ResumeByte, scan.ResumeChar );
+			keep_byte = scan.ResumeByte;
+			keep_char = scan.ResumeChar;
+		}
+
+		if( keep_char == BaseChar )
+			return;
+		auto keep = string_iterator( source, Window.c_str() + ( keep_byte - BaseByte ), keep_char - BaseChar );
+		--keep;
+		auto drop = static_cast<index_t>( keep.byteData() - Window.c_str() );
+		Window.erase( 0, drop );
+		BaseByte += drop;
+		BaseChar += keep.numChar();
+	}
+}
@@ -0,0 +1,132 @@
+#pragma once
+#include "RegEx.h"
+#include <eonsource/Raw.h>
+#include <functional>
+
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// The 'eon' namespace encloses all public functionality
+//
+namespace eon
+{
+	///////////////////////////////////////////////////////////////////////////
+	//
+	// Eon Regular Expression Stream Class - eon::regexstream
+	//
+	// Find all matches of an [eon::regex] in input that comes in pieces,
+	// without loading all of it: from an [eon::source::Raw] (such as an
+	// [eon::source::File]), or from a reader function (such as one calling
+	// [eon::filebuffer::read]).
+	//
+	// The state of the lazy DFA is carried from one piece to the next, and
+	// only input from where a match in progress can start is kept. Memory
+	// use is therefore bounded by the window size, regardless of the size
+	// of the input. Matches (including partial matches, such as an
+	// unfinished ".*") longer than half the window are not found.
+	//
+	// Only expressions that can be run on the lazy DFA can be streamed
+	// (not backreferences, 'not', or '{name}').
+	//
+	// A stream object must not be used by multiple threads at the same
+	// time, but the expression can be shared.
+	//
+	class regexstream
+	{
+	public:
+		// Size of pieces read, in bytes
+		static const index_t ChunkSize{ 64 * 1024 };
+
+		// Default maximum size of the window of input kept, in bytes
+		static const index_t DefWindowSize{ 1024 * 1024 };
+
+		// Reader function, reading up to 'size' bytes into 'buffer'
+		// Must return number of bytes read, 0 at end of input.
+		using reader = std::function<index_t( char* buffer, index_t size )>;
+
+		// A match in the stream
+		struct found
+		{
+			rx::match Match;			// Only valid during the callback
+			index_t StartByte{ 0 };		// Positions, counted from the start of the input
+			index_t EndByte{ 0 };
+			index_t StartChar{ 0 };
+			index_t EndChar{ 0 };
+		};
+
+		// Function called for each match
+		// Return false to stop.
+		using callback = std::function<bool( const found& match )>;
+
+
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Construction
+		//
+
+		regexstream() = delete;
+		regexstream( const regexstream& ) = delete;
+
+		// Construct for 'expression', which must be kept while streaming,
+		// with at most 'window_size' bytes of input kept
+		// WARNING: Throws [eon::rx::InvalidExpression] if the expression
+		//          cannot be streamed!
+		explicit regexstream( const regex& expression, index_t window_size = DefWindowSize );
+
+		~regexstream() = default;
+
+		regexstream& operator=( const regexstream& ) = delete;
+
+
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Scanning
+		//
+
+		// Find all matches in the input from 'read', calling 'on_match'
+		// for each, in order
+		// NOTE: There will be no overlaps, as for [eon::regex::findAll].
+		// Returns number of matches.
+		index_t scan( const reader& read, const callback& on_match );
+
+		// Find all matches in 'source', calling 'on_match' for each, in
+		// order
+		// Returns number of matches.
+		index_t scan( source::Raw& source, const callback& on_match );
+
+
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Helpers
+		//
+	private:
+
+		// Get number of bytes in the window that are complete UTF-8
+		// characters (the rest must wait for the next piece)
+		index_t _complete() const noexcept;
+
+		// Drop input from the window that cannot be part of a match
+		void _trim( rx::StreamScan& scan, const string_iterator& source );
+
+
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Attributes
+		//
+	private:
+		const regex* Expression{ nullptr };
+		index_t WindowSize{ DefWindowSize };
+		std::string Window;
+		index_t BaseByte{ 0 };		// Position of the start of the window
+		index_t BaseChar{ 0 };
+		rx::MatchState State;
+	};
+}
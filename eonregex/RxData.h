@@ -19,6 +19,7 @@ namespace eon
 	namespace rx
 	{
 		using captures_t = std::unordered_map<name_t, substring>;
+		class MatchState;
 
 		class RxData
 		{
@@ -26,23 +27,26 @@ namespace eon
 			RxData() = default;
 			inline RxData( const RxData& other ) {
 				if( other.Captures ) { Captures = new captures_t( *other.Captures ); }
-				Src = other.Src; CmpFlags = other.CmpFlags; Pos = other.Pos; Marker = other.Marker; }
+				Src = other.Src; CmpFlags = other.CmpFlags; Pos = other.Pos; State = other.State; Marker = other.Marker; }
 			inline RxData( RxData&& other ) noexcept { *this = std::move( other ); }
-			inline RxData( const substring& source, Flag flags, uint16_t marker ) noexcept {
-				Src = source; Pos = Src.begin(); CmpFlags = flags; Marker = marker; }
+
+			// Start a new match attempt on 'source', using 'state' for match-time node details
+			RxData( const substring& source, Flag flags, MatchState& state ) noexcept;
 			virtual ~RxData() { reset(); }
 
 			inline void reset() noexcept { if( Captures ) { delete Captures; Captures = nullptr; } }
 
 			inline RxData& operator=( const RxData& other ) {
 				reset(); if( other.Captures ) { Captures = new captures_t( *other.Captures ); }
-				Src = other.Src; CmpFlags = other.CmpFlags; Pos = other.Pos; Marker = other.Marker; return *this; }
+				Src = other.Src; CmpFlags = other.CmpFlags; Pos = other.Pos; State = other.State; Marker = other.Marker;
+				return *this; }
 			inline RxData& operator=( RxData&& other ) noexcept { reset(); if( other.Captures ) {
 				Captures = other.Captures; other.Captures = nullptr; } Src = other.Src; CmpFlags = other.CmpFlags;
-				other.CmpFlags = Flag::none; Pos = other.Pos; Marker = other.Marker; return *this; }
+				other.CmpFlags = Flag::none; Pos = other.Pos; State = other.State; Marker = other.Marker; return *this; }
 
 			inline const substring& source() const noexcept { return Src; }
 			inline const string::iterator& pos() const noexcept { return Pos; }
+			inline void pos( const string::iterator& pos ) noexcept { Pos = pos; }
 			inline bool valid() const noexcept { return Pos && Pos < Src.end(); }
 			inline char_t operator()() const noexcept { return valid() ? *Pos : NullChr; }
 			inline bool prev( char_t c ) const noexcept { return Pos && Pos > Src.begin() && *( Pos - 1 ) == c; }
@@ -67,6 +71,7 @@ namespace eon
 				return ( CmpFlags & Flag::accuracy ) && !( CmpFlags & Flag::speed ); }
 
 			inline uint16_t marker() const noexcept { return Marker; }
+			inline MatchState& state() const noexcept { return *State; }
 
 
 			// Captures
@@ -85,6 +90,7 @@ namespace eon
 			string_iterator Pos;
 			Flag CmpFlags{ Flag::none };
 			captures_t* Captures{ nullptr };
+			MatchState* State{ nullptr };
 			uint16_t Marker{ 0 };
 		};
 	}
@@ -37,7 +37,7 @@ namespace eon
 			val_backref
 		};
 
-		enum class Anchor
+		enum class Anchor : uint8_t
 		{
 			none = 0x00,
 			input = 0x01,
@@ -66,6 +66,10 @@ namespace eon
 			no_exposing = 0x0040,			// Do not expose literal characters
 			
 			failfast_fixed_end = 0x0080,	// When <fixed>$ at the end and not 'lines', check end of input first
+
+			no_vm = 0x0100,			// Do not compile for linear-time matching, always backtrack
+			no_dfa = 0x0200,		// Do not use the lazy DFA, only the Pike VM
+			no_prefilter = 0x0400	// Do not use literals and anchoring to skip ahead when searching
 		};
 		inline bool operator&( Flag a, Flag b ) noexcept { return static_cast<int>( a ) & static_cast<int>( b ); }
 		inline Flag& operator|=( Flag& a, Flag b ) noexcept {
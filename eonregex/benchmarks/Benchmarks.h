@@ -0,0 +1,111 @@
+#pragma once
+
+#include <eonbenchmark/Benchmark.h>
+#include <eonregex/RegEx.h>
+
+
+namespace eon
+{
+	class SharedRegex : public eonbench::EonBenchmark
+	{
+	protected:
+		void prepare() override;
+
+		// Run 'operation' on all lines from 1, 2, 4, ... threads, up to the number of cores (at least 4).
+		// The operation gets the thread number and the line.
+		template<typename Operation>
+		void threads( const eon::string& label, Operation operation );
+
+	protected:
+		std::vector<string> Lines;
+	};
+
+	class Pathological : public eonbench::EonBenchmark
+	{
+	protected:
+		// Time 'pattern' with 'flags' on runs of 'a' of growing length, up to 'max_length'
+		void grow( const eon::string& label, const eon::string& pattern, const eon::string& flags,
+			index_t max_length );
+	};
+
+	class Grep : public eonbench::EonBenchmark
+	{
+	protected:
+		void prepare() override;
+
+		// Time finding 'pattern' in each line of the log, with prefiltering turned off and on
+		void lines( const eon::string& label, const eon::string& pattern );
+
+	protected:
+		string Log;
+	};
+
+	class RegexSet : public eonbench::EonBenchmark
+	{
+	protected:
+		void prepare() override;
+
+		// Time routing all lines with 'count' rules, one expression at a
+		// time and as a set, using 'find' (or else match from the start)
+		void route( index_t count, bool find );
+
+	protected:
+		std::vector<string> Lines;
+		index_t NumBytes{ 0 };
+	};
+
+	class RegexCache : public eonbench::EonBenchmark
+	{
+	protected:
+		void prepare() override;
+
+	protected:
+		std::vector<string> Values;
+	};
+
+	class CharSets : public eonbench::EonBenchmark
+	{
+	protected:
+		// Generate source code like text, with some non-ASCII identifiers and comments
+		void prepare() override;
+
+		// Time matching every line against 'pattern' on the Pike VM and the DFA
+		void scan( const eon::string& label, const eon::string& pattern );
+
+	protected:
+		string Text;
+	};
+
+	class ParallelFind : public eonbench::EonBenchmark
+	{
+	protected:
+		// Generate a 256 MB log
+		void prepare() override;
+
+	protected:
+		string Log;
+	};
+
+	class Replace : public eonbench::EonBenchmark
+	{
+	protected:
+		// Generate a 100 MB log
+		void prepare() override;
+
+	protected:
+		string Log;
+	};
+
+	class Stream : public eonbench::EonBenchmark
+	{
+	public:
+		~Stream() override;
+
+	protected:
+		// Generate a small and a large (multi-GiB) log file
+		void prepare() override;
+
+	protected:
+		std::string SmallFile, LargeFile;
+	};
+}
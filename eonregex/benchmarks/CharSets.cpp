@@ -0,0 +1,59 @@
+#include "Benchmarks.h"
+
+
+namespace eon
+{
+	static const size_t TextBytes{ 4 * 1024 * 1024 };
+
+	void CharSets::prepare()
+	{
+		std::string text;
+		text.reserve( TextBytes + 256 );
+		for( size_t i = 0; text.size() < TextBytes; ++i )
+		{
+			auto num = std::to_string( i );
+			text += "\tauto value_" + num + " = compute( item[" + num + "], 0x" + std::to_string( i % 4096 ) + " );\n";
+			if( i % 8 == 0 )
+				text += "\t// Størrelse på område " + num + " - ÆØÅ æøå, Ελληνικά, δοκιμή\n";
+		}
+		Text = std::move( text );
+	}
+
+	void CharSets::scan( const eon::string& label, const eon::string& pattern )
+	{
+		auto lines = Text.splitView( char_t( '\n' ) );
+		for( auto flags : { "!d", "" } )
+		{
+			regex rx{ pattern, flags };
+			rx::match result;
+			rx::MatchState state;
+			auto run = [&]() {
+				index_t matched{ 0 };
+				for( auto& line : lines )
+				{
+					if( rx.matchInto( line, result, state ) )
+						++matched;
+				}
+				return matched; };
+			measure( label + " '" + pattern + ( *flags ? "' (VM)" : "' (DFA)" ), Text.numBytes(), [&]() {
+				eonbench::keep( run() ); } );
+			if( *flags )
+			{
+				auto steps = state.vmSteps();
+				run();
+				report( "  VM instructions per input byte",
+					string( static_cast<double>( state.vmSteps() - steps ) / Text.numBytes() ) );
+			}
+		}
+	}
+
+	BENCHMARK( CharSets, lines )
+	{
+		// Whole lines, character by character through sets
+		report( "Instruction size", string( sizeof( rx::Instruction ) ) + " bytes" );
+		scan( "Ranges", R"(\s*[a-zA-Z_][a-zA-Z_0-9]*[^;]*)" );
+		scan( "Classes", R"(\s*(\w|\p|\s)+)" );
+		scan( "Negated", R"([^;]+)" );
+		scan( "Non-ASCII", R"(\s*[ /a-zA-Z0-9æøåÆØÅα-ωΑ-Ω,_=]+)" );
+	}
+}
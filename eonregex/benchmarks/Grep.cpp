@@ -0,0 +1,92 @@
+#include "Benchmarks.h"
+
+
+namespace eon
+{
+	static const size_t LogBytes{ 100 * 1024 * 1024 };
+
+	void Grep::prepare()
+	{
+		// Mostly INFO lines, with the occasional warning and error
+		std::string log;
+		log.reserve( LogBytes + 256 );
+		for( size_t i = 0; log.size() < LogBytes; ++i )
+		{
+			auto num = std::to_string( i );
+			auto worker = std::to_string( i % 8 );
+			if( i % 97 == 0 )
+				log += "2024-05-01T12:00:00Z ERROR [worker-" + worker + "] request id=" + num + " status=503 took="
+					+ std::to_string( i % 1000 ) + "ms\n";
+			else if( i % 31 == 0 )
+				log += "2024-05-01T12:00:00Z WARN [worker-" + worker + "] request id=" + num + " status=429 took="
+					+ std::to_string( i % 1000 ) + "ms\n";
+			else
+				log += "2024-05-01T12:00:00Z INFO [worker-" + worker + "] request id=" + num + " status=200 path=/api/v1/items/"
+					+ num + " took=12ms\n";
+		}
+		Log = std::move( log );
+	}
+
+	void Grep::lines( const eon::string& label, const eon::string& pattern )
+	{
+		for( bool prefilter : { false, true } )
+		{
+			regex rx{ pattern, prefilter ? "" : "!p" };
+			measure( label + " '" + pattern + ( prefilter ? "'" : "' (before)" ), Log.numBytes(), [&]() {
+				index_t found{ 0 };
+				for( auto& line : Log.splitView( char_t( '\n' ) ) )
+				{
+					if( rx.findFirst( line ) )
+						++found;
+				}
+				eonbench::keep( found ); } );
+		}
+	}
+
+	BENCHMARK( Grep, lines )
+	{
+		lines( "Prefix", R"(ERROR \[@<worker>(worker-\d)\])" );
+		lines( "Required literal", R"(\d+ status=503)" );
+		lines( "First bytes", R"((WARN)|(ERROR))" );
+		lines( "No literals", R"(\d{3}\s)" );
+	}
+
+	BENCHMARK( Grep, findAll )
+	{
+		for( bool prefilter : { false, true } )
+		{
+			regex rx{ R"(status=503 took=@<took>(\d+))", prefilter ? "" : "!p" };
+			measure( string( "findAll" ) + ( prefilter ? "" : " (before)" ), Log.numBytes(), [&]() {
+				eonbench::keep( rx.findAll( Log ).size() ); } );
+		}
+	}
+
+	BENCHMARK( Grep, matchResults )
+	{
+		// Many small matches with captures, where the cost of the result matters
+		regex rx{ R"(id=@<id>(\d+) status=@<status>(\d+))" };
+		measure( "findAll", Log.numBytes(), [&]() {
+			eonbench::keep( rx.findAll( Log ).size() ); } );
+		measure( "findFirstInto, reused result", Log.numBytes(), [&]() {
+			index_t found{ 0 };
+			rx::match result;
+			substring rest{ Log.substr() };
+			while( rx.findFirstInto( rest, result ) )
+			{
+				++found;
+				rest = substring( result.all().end(), rest.end() );
+			}
+			eonbench::keep( found ); } );
+	}
+
+	BENCHMARK( Grep, anchored )
+	{
+		// Fails at the start of the input, which used to mean trying everywhere else as well
+		for( bool prefilter : { false, true } )
+		{
+			regex rx{ R"(^\d+ ERROR)", prefilter ? "" : "!p" };
+			measure( string( "findFirst, anchored" ) + ( prefilter ? "" : " (before)" ), Log.numBytes(), [&]() {
+				eonbench::keep( rx.findFirst( Log ) ); } );
+		}
+	}
+}
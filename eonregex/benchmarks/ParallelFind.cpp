@@ -0,0 +1,42 @@
+#include "Benchmarks.h"
+#include <thread>
+
+
+namespace eon
+{
+	static const size_t LogBytes{ 256 * 1024 * 1024 };
+
+	void ParallelFind::prepare()
+	{
+		std::string log;
+		log.reserve( LogBytes + 256 );
+		for( size_t i = 0; log.size() < LogBytes; ++i )
+		{
+			auto num = std::to_string( i );
+			log += "2024-05-01T12:00:00Z " + std::string( i % 97 == 0 ? "ERROR" : "INFO" ) + " [worker-"
+				+ std::to_string( i % 8 ) + "] request id=" + num + " status=" + ( i % 97 == 0 ? "503" : "200" )
+				+ " took=" + std::to_string( i % 1000 ) + "ms\n";
+		}
+		Log = std::move( log );
+	}
+
+	BENCHMARK( ParallelFind, scaling )
+	{
+		regex rx{ R"(ERROR \[@<worker>(worker-\d)\] request id=\d+ status=\d+ took=@<took>(\d+)ms$)", "l" };
+		index_t expected{ 0 };
+		measure( "findAll (sequential)", Log.numBytes(), [&]() {
+			eonbench::keep( expected = rx.findAll( Log ).size() ); } );
+
+		auto max_threads = std::max( 4u, std::thread::hardware_concurrency() );
+		for( unsigned num_threads = 1; num_threads <= max_threads; num_threads *= 2 )
+		{
+			index_t found{ 0 };
+			measure( "findAllParallel, " + string( static_cast<index_t>( num_threads ) ) + " threads", Log.numBytes(),
+				[&]() {
+					eonbench::keep( found = rx.findAllParallel( Log, NewlineChr, num_threads ).size() ); } );
+			if( found != expected )
+				report( "  MISMATCH", string( found ) + " matches, expected " + string( expected ) );
+		}
+		report( "Cores", string( static_cast<index_t>( std::thread::hardware_concurrency() ) ) );
+	}
+}
@@ -0,0 +1,39 @@
+#include "Benchmarks.h"
+
+
+namespace eon
+{
+	// Patterns that make a backtracker try every way of dividing the input between nested quantifiers before
+	// failing on the missing last character
+	static const char* Patterns[]{ "(a*)*b", "(a+a+)+b", "@<x>(a|aa)+b", "(\\w+\\s?)+$" };
+
+	void Pathological::grow( const eon::string& label, const eon::string& pattern, const eon::string& flags,
+		index_t max_length )
+	{
+		regex rx{ pattern, flags };
+		for( index_t length = 8; length <= max_length; length *= 2 )
+		{
+			// End with something that can never match, for patterns anchored at the end
+			string input{ string( length, 'a' ) + "!" };
+			measure( label + " '" + pattern + "', " + string( length ) + " chars", input.numBytes(), [&]() {
+				eonbench::keep( rx.findFirst( input ) ); } );
+		}
+	}
+
+	BENCHMARK( Pathological, backtracking )
+	{
+		// Full backtracking, as with the "a" flag, grows exponentially so only short inputs are feasible
+		for( auto pattern : Patterns )
+			grow( "Backtracking (before)", pattern, "a!v", 16 );
+		for( auto pattern : Patterns )
+			grow( "Limited backtracking (before)", pattern, "!v", 1024 );
+	}
+
+	BENCHMARK( Pathological, linear )
+	{
+		for( auto pattern : Patterns )
+			grow( "Pike VM", pattern, "!d", 65536 );
+		for( auto pattern : Patterns )
+			grow( "Lazy DFA", pattern, "", 65536 );
+	}
+}
@@ -0,0 +1,46 @@
+#include "Benchmarks.h"
+
+
+namespace eon
+{
+	static const index_t NumValues{ 5000 };
+
+	void RegexCache::prepare()
+	{
+		// The regex values of a configuration document, where a few dozen
+		// validation patterns are repeated for every entry
+		std::vector<string> patterns{
+			R"(^\d{4}-\d{2}-\d{2}$)", R"(^@<user>(\w+)@@<domain>(\w+(\.\w+)+)$)", R"(^[A-Z]{2}\d{2}[A-Z0-9]{10,30}$)",
+			R"(^\+?\d{1,3}[ -]?\d{3,4}[ -]?\d{4}$)", R"(^(GET)|(POST)|(PUT)|(DELETE)$)", R"(^/api/v\d+/\w+(/\d+)?$)",
+			R"(^#[0-9a-fA-F]{6}$)", R"(^\d+(\.\d+)?(ms)|(s)$)", R"(^@<key>(\w+)=@<value>([^;]+)$)" };
+		for( index_t i = 0; i < 40; ++i )
+			patterns.push_back( R"(^field)" + string( i ) + R"(_\w+:\s*\d+(\.\d+)?$)" );
+		for( index_t i = 0; i < NumValues; ++i )
+			Values.push_back( patterns[ ( i * 7 ) % patterns.size() ] );
+	}
+
+	BENCHMARK( RegexCache, reload )
+	{
+		// Load the document's regex values (once per run), as the parser does
+		std::vector<regex> document;
+		document.reserve( NumValues );
+		measure( "Reload " + string( NumValues ) + " values (before, parsing each)", 0, [&]() {
+			document.clear();
+			for( auto& value : Values )
+				document.push_back( regex( value ) );
+			eonbench::keep( document.size() ); } );
+		regex::clearCache();
+		measure( "Reload " + string( NumValues ) + " values (cached)", 0, [&]() {
+			document.clear();
+			for( auto& value : Values )
+				document.push_back( regex::cached( value ) );
+			eonbench::keep( document.size() ); } );
+		auto stats = regex::cacheStats();
+		report( "Cache hit ratio", string( static_cast<double>( stats.Hits ) / ( stats.Hits + stats.Misses ) ) );
+
+		// Attribute values are copied around
+		measure( "Copy " + string( NumValues ) + " values", 0, [&]() {
+			auto copy = document;
+			eonbench::keep( copy.size() ); } );
+	}
+}
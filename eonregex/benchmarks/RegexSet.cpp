@@ -0,0 +1,61 @@
+#include "Benchmarks.h"
+#include <eonregex/RegExSet.h>
+
+
+namespace eon
+{
+	static const index_t NumLines{ 2000 };
+
+	void RegexSet::prepare()
+	{
+		// Requests for resources, some of which have rules
+		for( index_t i = 0; i < NumLines; ++i )
+		{
+			Lines.push_back( string( i % 3 == 0 ? "POST" : "GET" ) + " /api/v" + string( i % 4 ) + "/items"
+				+ string( ( i * 7919 ) % 2000 ) + "/" + string( i ) + " HTTP/1.1" );
+			NumBytes += Lines.back().numBytes();
+		}
+	}
+
+	void RegexSet::route( index_t count, bool find )
+	{
+		std::vector<regex> rules;
+		regexset set;
+		for( index_t i = 0; i < count; ++i )
+		{
+			string rule = string( i % 2 == 0 ? "GET" : "POST" ) + " /api/v\\d+/items" + string( i ) + "/\\d+";
+			rules.push_back( regex( rule ) );
+			set.add( rule );
+		}
+
+		auto label = string( count ) + " rules, " + ( find ? "find" : "match" );
+		measure( label + " (one at a time)", NumBytes, [&]() {
+			index_t routed{ 0 };
+			for( auto& line : Lines )
+			{
+				for( auto& rule : rules )
+				{
+					if( find ? static_cast<bool>( rule.findFirst( line ) ) : static_cast<bool>( rule.match( line ) ) )
+						++routed;
+				}
+			}
+			eonbench::keep( routed ); } );
+		measure( label + " (set)", NumBytes, [&]() {
+			index_t routed{ 0 };
+			for( auto& line : Lines )
+				routed += find ? set.find( line ).size() : set.match( line ).size();
+			eonbench::keep( routed ); } );
+	}
+
+	BENCHMARK( RegexSet, match )
+	{
+		for( index_t count : { 10, 100, 1000 } )
+			route( count, false );
+	}
+
+	BENCHMARK( RegexSet, find )
+	{
+		for( index_t count : { 10, 100, 1000 } )
+			route( count, true );
+	}
+}
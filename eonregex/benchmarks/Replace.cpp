@@ -0,0 +1,48 @@
+#include "Benchmarks.h"
+
+
+namespace eon
+{
+	static const size_t LogBytes{ 100 * 1024 * 1024 };
+
+	void Replace::prepare()
+	{
+		std::string log;
+		log.reserve( LogBytes + 256 );
+		for( size_t i = 0; log.size() < LogBytes; ++i )
+		{
+			auto num = std::to_string( i );
+			log += "2024-05-01T12:00:00Z INFO [worker-" + std::to_string( i % 8 ) + "] bruker=" + num
+				+ " søk id=" + num + " status=200 took=" + std::to_string( i % 1000 ) + "ms\n";
+		}
+		Log = std::move( log );
+	}
+
+	BENCHMARK( Replace, rewrite )
+	{
+		// Mark every id, about one match per 100 bytes
+		regex rx{ R"(id=@<id>(\d+))" };
+		auto id = name( "id" );
+		index_t size{ 0 };
+		measure( "findAll and concatenate (before)", Log.numBytes(), [&]() {
+			string output;
+			auto pos = Log.begin();
+			for( auto& found : rx.findAll( Log ) )
+			{
+				output += substring( pos, found.all().begin() );
+				output += "id=#";
+				output += found.group( id );
+				pos = found.all().end();
+			}
+			output += substring( pos, Log.end() );
+			eonbench::keep( size = output.numChars() ); } );
+		measure( "replace, template", Log.numBytes(), [&]() {
+			eonbench::keep( rx.replace( Log, "id=#@:<id>" ).numChars() ); } );
+		measure( "replace, callback", Log.numBytes(), [&]() {
+			eonbench::keep( rx.replace( Log, [&id]( const rx::match& found, std::string& output ) {
+				output += "id=#";
+				auto digits = found.group( id );
+				output.append( digits.begin().byteData(), digits.numBytes() ); } ).numChars() ); } );
+		report( "Output characters", string( size ) );
+	}
+}
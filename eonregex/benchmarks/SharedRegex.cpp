@@ -0,0 +1,110 @@
+#include "Benchmarks.h"
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <new>
+
+
+// Count heap allocations while 'CountAllocations' is set
+static std::atomic<bool> CountAllocations{ false };
+static std::atomic<size_t> NumAllocations{ 0 };
+void* operator new( size_t size )
+{
+	if( CountAllocations.load( std::memory_order_relaxed ) )
+		++NumAllocations;
+	if( auto ptr = std::malloc( size > 0 ? size : 1 ) )
+		return ptr;
+	throw std::bad_alloc();
+}
+void operator delete( void* ptr ) noexcept { std::free( ptr ); }
+void operator delete( void* ptr, size_t ) noexcept { std::free( ptr ); }
+
+
+
+namespace eon
+{
+	static const size_t NumLines{ 2000 };
+	static const char* Pattern{ R"(id=@<id>(\d+) status=@<status>(\d+))" };
+
+	void SharedRegex::prepare()
+	{
+		for( size_t i = 0; i < NumLines; ++i )
+		{
+			auto num = std::to_string( i * 7919 );
+			Lines.push_back( string( "2024-05-01 12:00:00 INFO request id=" + num + " status=200 path=/api/items/"
+				+ num ) );
+		}
+	}
+
+	template<typename Operation>
+	void SharedRegex::threads( const eon::string& label, Operation operation )
+	{
+		size_t bytes{ 0 };
+		for( auto& line : Lines )
+			bytes += line.numBytes();
+
+		auto max_threads = std::max( 4u, std::thread::hardware_concurrency() );
+		for( unsigned num_threads = 1; num_threads <= max_threads; num_threads *= 2 )
+		{
+			eon::string thread_label{ label + ", " + string( static_cast<index_t>( num_threads ) ) + " threads" };
+			auto ns = measure( thread_label, bytes * num_threads, [&]() {
+				std::vector<std::thread> threads;
+				for( unsigned t = 0; t < num_threads; ++t )
+				{
+					threads.push_back( std::thread( [&, t]() {
+						size_t found{ 0 };
+						for( auto& line : Lines )
+							found += operation( t, line ) ? 1 : 0;
+						eonbench::keep( found ); } ) );
+				}
+				for( auto& thread : threads )
+					thread.join(); } );
+			report( thread_label + ", matches/s", string( static_cast<index_t>( 1e9 * NumLines * num_threads / ns ) ) );
+		}
+	}
+
+	BENCHMARK( SharedRegex, findFirst )
+	{
+		regex rx{ Pattern };
+		auto max_threads = std::max( 4u, std::thread::hardware_concurrency() );
+
+		// Before the match state was split out, a regex could only be shared by serializing the calls,
+		// or each thread had to have its own copy
+		std::mutex lock;
+		threads( "Mutex-guarded (before)", [&]( unsigned, const string& line ) {
+			std::lock_guard<std::mutex> guard( lock );
+			return static_cast<bool>( rx.findFirst( line ) ); } );
+		std::vector<regex> copies( max_threads, rx );
+		threads( "Copy per thread (before)", [&]( unsigned t, const string& line ) {
+			return static_cast<bool>( copies[ t ].findFirst( line ) ); } );
+
+		threads( "Shared", [&]( unsigned, const string& line ) {
+			return static_cast<bool>( rx.findFirst( line ) ); } );
+		std::vector<std::unique_ptr<rx::MatchState>> states;
+		for( unsigned t = 0; t < max_threads; ++t )
+			states.push_back( std::make_unique<rx::MatchState>() );
+		threads( "Shared, caller state", [&]( unsigned t, const string& line ) {
+			return static_cast<bool>( rx.findFirst( line.substr(), *states[ t ] ) ); } );
+	}
+
+	BENCHMARK( SharedRegex, allocations )
+	{
+		// The match state allocates nothing once warmed up, and captures are
+		// stored inside the result.
+		for( bool captures : { false, true } )
+		{
+			regex rx{ captures ? Pattern : R"(\d+ status=\d+)" };
+			rx::MatchState state;
+			for( bool warm : { false, true } )
+			{
+				NumAllocations = 0;
+				CountAllocations = true;
+				auto found = rx.findFirst( Lines[ 0 ].substr(), state );
+				CountAllocations = false;
+				eonbench::keep( found );
+				report( string( captures ? "Captures" : "No captures" ) + ( warm ? ", warm state" : ", new state" )
+					+ ": allocations", string( static_cast<index_t>( NumAllocations.load() ) ) );
+			}
+		}
+	}
+}
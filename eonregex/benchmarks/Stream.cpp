@@ -0,0 +1,96 @@
+#include "Benchmarks.h"
+#include <eonregex/RegExStream.h>
+#include <eonsource/File.h>
+#include <filesystem>
+#include <fstream>
+#ifndef EON_WINDOWS
+#	include <sys/resource.h>
+#endif
+
+
+namespace eon
+{
+	static const size_t LargeBytes{ size_t( 2 ) * 1024 * 1024 * 1024 };
+	static const size_t SmallBytes{ 256 * 1024 * 1024 };
+
+	// Get peak resident memory of the process, in KiB (0 if unknown)
+	static size_t _peakRss()
+	{
+#ifndef EON_WINDOWS
+		rusage usage;
+		if( getrusage( RUSAGE_SELF, &usage ) == 0 )
+			return static_cast<size_t>( usage.ru_maxrss );
+#endif
+		return 0;
+	}
+
+	// Write a log file of (at least) 'size' bytes
+	static std::string _writeLog( const std::string& name, size_t size )
+	{
+		auto path = ( std::filesystem::temp_directory_path() / name ).string();
+		std::ofstream file( path, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc );
+		std::string block;
+		size_t written{ 0 };
+		for( size_t i = 0; written < size; ++i )
+		{
+			auto num = std::to_string( i );
+			if( i % 97 == 0 )
+				block += "2024-05-01T12:00:00Z ERROR [worker-" + std::to_string( i % 8 ) + "] request id=" + num
+					+ " status=503\n";
+			else
+				block += "2024-05-01T12:00:00Z INFO [worker-" + std::to_string( i % 8 ) + "] request id=" + num
+					+ " status=200 path=/api/v1/items/" + num + " took=12ms\n";
+			if( block.size() >= 1024 * 1024 )
+			{
+				file.write( block.c_str(), block.size() );
+				written += block.size();
+				block.clear();
+			}
+		}
+		return path;
+	}
+
+	void Stream::prepare()
+	{
+		SmallFile = _writeLog( "eonregex_stream_small.log", SmallBytes );
+		LargeFile = _writeLog( "eonregex_stream_large.log", LargeBytes );
+	}
+
+	Stream::~Stream()
+	{
+		std::error_code error;
+		std::filesystem::remove( SmallFile, error );
+		std::filesystem::remove( LargeFile, error );
+	}
+
+	BENCHMARK( Stream, file )
+	{
+		regex expr{ R"(ERROR \[@<worker>(worker-\d)\] request id=\d+)" };
+		regexstream stream{ expr };
+
+		// Streaming first, while the peak memory use of the process is
+		// still low
+		for( auto& path : { SmallFile, LargeFile } )
+		{
+			source::File file{ string( path ) };
+			auto peak = _peakRss();
+			measure( "Stream " + string( file.numBytesInSource() / ( 1024 * 1024 ) ) + " MiB", file.numBytesInSource(),
+				[&]() {
+					index_t found{ 0 };
+					stream.scan( file, [&]( const regexstream::found& ) { ++found; return true; } );
+					eonbench::keep( found ); } );
+			report( "Stream " + string( file.numBytesInSource() / ( 1024 * 1024 ) ) + " MiB, peak RSS growth KiB",
+				string( _peakRss() - peak ) );
+		}
+
+		// Loading all of the input first, for comparison (small file only)
+		auto peak = _peakRss();
+		measure( "Load + findAll " + string( SmallBytes / ( 1024 * 1024 ) ) + " MiB (before)", SmallBytes, [&]() {
+			std::ifstream file( SmallFile, std::ios_base::in | std::ios_base::binary );
+			std::string data( ( std::istreambuf_iterator<char>( file ) ), std::istreambuf_iterator<char>() );
+			string input( std::move( data ) );
+			eonbench::keep( expr.findAll( input ).size() ); } );
+		report( "Load + findAll " + string( SmallBytes / ( 1024 * 1024 ) ) + " MiB, peak RSS growth KiB",
+			string( _peakRss() - peak ) );
+	}
+}
@@ -33,7 +33,9 @@ namespace eon
 				*static_cast<Node*>( this ) = std::move( other ); return *this; }
 
 		private:
-			inline bool _match( RxData& data, index_t step ) override { return data ? data.advance() : false; }
+			inline bool _match( RxData& data, index_t step ) const override { return data ? data.advance() : false; }
+			inline bool _compile( Program& program ) const override {
+				program.emit( Instruction( Instruction::op::any ) ); return true; }
 
 			inline string _strStruct() const override { return "."; }
 
@@ -36,7 +36,7 @@ namespace eon
 				*static_cast<Node*>( this ) = std::move( other ); Name = std::move( other.Name ); return *this; }
 
 		private:
-			bool _match( RxData& data, index_t steps ) override;
+			bool _match( RxData& data, index_t steps ) const override;
 			inline string _strStruct() const override { return "@:<" + str( Name ) + ">"; }
 			inline bool _equal( const Node& other, cmpflag flags ) const noexcept override {
 				return Name == dynamic_cast<const Backreference*>( &other )->Name; }
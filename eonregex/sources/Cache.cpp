@@ -0,0 +1,91 @@
+#include "Cache.h"
+
+
+namespace eon
+{
+	namespace rx
+	{
+		Cache& Cache::instance()
+		{
+			static Cache cache;
+			return cache;
+		}
+
+		std::string Cache::key( const string& pattern, const string& flags )
+		{
+			// Flags first, with the size, so that no two pairs give the
+			// same key
+			std::string key = std::to_string( flags.numBytes() ) + ":";
+			key += flags.stdstr();
+			key += pattern.stdstr();
+			return key;
+		}
+
+
+
+
+		bool Cache::find( const std::string& key, regex& found )
+		{
+			std::lock_guard<std::mutex> lock( Lock );
+			auto entry = Index.find( key );
+			if( entry == Index.end() )
+			{
+				++Misses;
+				return false;
+			}
+			Lru.splice( Lru.begin(), Lru, entry->second );
+			found = entry->second->second;
+			++Hits;
+			return true;
+		}
+
+		void Cache::add( std::string&& key, const regex& expression )
+		{
+			std::lock_guard<std::mutex> lock( Lock );
+			if( Index.find( key ) != Index.end() )
+				return;
+			Lru.emplace_front( std::move( key ), expression );
+			Index[ Lru.front().first ] = Lru.begin();
+			_trim();
+		}
+
+		regex::cachestats Cache::stats()
+		{
+			std::lock_guard<std::mutex> lock( Lock );
+			regex::cachestats stats;
+			stats.Hits = Hits;
+			stats.Misses = Misses;
+			stats.Size = Lru.size();
+			stats.Capacity = Capacity;
+			return stats;
+		}
+
+		void Cache::capacity( index_t capacity )
+		{
+			std::lock_guard<std::mutex> lock( Lock );
+			Capacity = capacity;
+			_trim();
+		}
+
+		void Cache::clear()
+		{
+			std::lock_guard<std::mutex> lock( Lock );
+			Index.clear();
+			Lru.clear();
+			Hits = 0;
+			Misses = 0;
+		}
+
+
+
+
+		void Cache::_trim()
+		{
+			while( Lru.size() > Capacity )
+			{
+				Index.erase( Lru.back().first );
+				Lru.pop_back();
+			}
+		}
+	}
+}
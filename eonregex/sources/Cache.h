@@ -0,0 +1,73 @@
+#pragma once
+
+#include "../RegEx.h"
+#include <list>
+#include <mutex>
+#include <atomic>
+#include <unordered_map>
+
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// The 'eon' namespace encloses all public functionality
+//
+namespace eon
+{
+	///////////////////////////////////////////////////////////////////////////
+	//
+	// The 'eon::rx' namespace enclosed special elements for Eon regular
+	// expressions
+	//
+	namespace rx
+	{
+		// Process-wide cache of parsed and compiled expressions, for
+		// [eon::regex::cached]
+		// Expressions share their compiled details with those gotten from
+		// the cache, so dropping them from the cache only means having to
+		// parse them again the next time.
+		class Cache
+		{
+		public:
+			Cache() = default;
+			Cache( const Cache& ) = delete;
+			Cache( Cache&& ) = delete;
+			~Cache() = default;
+
+			Cache& operator=( const Cache& ) = delete;
+			Cache& operator=( Cache&& ) = delete;
+
+			// Get the cache for the process
+			static Cache& instance();
+
+			// Get cache key for 'pattern' and 'flags'
+			static std::string key( const string& pattern, const string& flags );
+
+			// Find expression for 'key', setting 'found' and making it the
+			// most recently used if there
+			bool find( const std::string& key, regex& found );
+
+			// Add 'expression' for 'key', as the most recently used
+			// (Unless there already, because of another thread.)
+			void add( std::string&& key, const regex& expression );
+
+			regex::cachestats stats();
+
+			void capacity( index_t capacity );
+
+			void clear();
+
+		private:
+			void _trim();
+
+		private:
+			using Entry = std::pair<std::string, regex>;
+
+			std::mutex Lock;
+			std::list<Entry> Lru;		// Most recently used first
+			std::unordered_map<std::string, std::list<Entry>::iterator> Index;
+			index_t Capacity{ regex::DefCacheCapacity };
+			std::atomic<index_t> Hits{ 0 };
+			std::atomic<index_t> Misses{ 0 };
+		};
+	}
+}
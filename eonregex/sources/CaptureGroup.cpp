@@ -5,17 +5,28 @@ namespace eon
 {
 	namespace rx
 	{
-		bool CaptureGroup::_match( RxData& data, index_t steps )
+		bool CaptureGroup::_match( RxData& data, index_t steps ) const
 		{
-			Start = data.pos();
-			Captured = false;
+			auto& state = _state( data );
+			state.Start = data.pos();
+			state.Captured = false;
 			if( NodeGroup::_match( data, steps ) )
 			{
-				if( !Captured )
-					data.registerCapture( Name, substring( Start, data.pos() ) );
+				if( !state.Captured )
+					data.registerCapture( Name, substring( state.Start, data.pos() ) );
 				return true;
 			}
 			return false;
 		}
+	
+		bool CaptureGroup::_compile( Program& program ) const
+		{
+			auto slot = program.newCapture( Name );
+			program.emit( Instruction( Instruction::op::save, slot ) );
+			if( !NodeGroup::_compile( program ) )
+				return false;
+			program.emit( Instruction( Instruction::op::save, slot + 1 ) );
+			return true;
+		}
 	}
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../NodeGroup.h"
+#include <algorithm>
 
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -38,7 +39,8 @@ namespace eon
 				*static_cast<NodeGroup*>( this ) = std::move( other ); Name = std::move( other.Name ); return *this; }
 
 		private:
-			bool _match( RxData& data, index_t steps ) override;
+			bool _match( RxData& data, index_t steps ) const override;
+			bool _compile( Program& program ) const override;
 
 			inline string _strStruct() const override { return "@<" + str( Name ) + ">" + NodeGroup::_strStruct(); }
 
@@ -47,13 +49,14 @@ namespace eon
 
 			inline Node* _removeSuperfluousGroups() noexcept override {
 				if( Next ) Next = Next->_removeSuperfluousGroups(); return this; }
-			inline void _capture( RxData& data ) override {
-				data.registerCapture( Name, substring( Start, data.pos() ) ); Captured = true; }
+			inline void _groups( std::vector<name_t>& names ) const override {
+				if( std::find( names.begin(), names.end(), Name ) == names.end() ) names.push_back( Name );
+				NodeGroup::_groups( names ); }
+			inline void _capture( RxData& data ) const override { auto& state = _state( data );
+				data.registerCapture( Name, substring( state.Start, data.pos() ) ); state.Captured = true; }
 
 		private:
 			name_t Name{ no_name };
-			string::iterator Start;
-			bool Captured{ false };
 		};
 	}
 }
@@ -20,42 +20,34 @@ namespace eon
 		}
 
 
-		bool CharGroup::_match( RxData& data, index_t steps )
+		bool CharGroup::matchChar( char_t c, bool icase ) const
 		{
-			if( data )
+			if( _match( c ) )
+				return !Value.Negate;
+			if( icase )
 			{
-				if( _match( data() ) )
-					return Value.Negate ? false : data.advance();
-				if( data.flags() & Flag::icase )
-				{
-					auto& chars = Characters::get();
-#ifdef EON_APPLE
-					auto l = std::tolower<wchar_t>( static_cast<wchar_t>( data() ), chars.locale() );
-					auto u = std::toupper<wchar_t>( static_cast<wchar_t>( data() ), chars.locale() );
-#else
-					auto l = std::tolower<char_t>( data(), chars.locale() );
-					auto u = std::toupper<char_t>( data(), chars.locale() );
-#endif
-					if( l != u )
-					{
-						if( data() == l )
-						{
-							if( _match( u ) )
-								return Value.Negate ? false : data.advance();
-						}
-						else
-						{
-							if( _match( l ) )
-								return Value.Negate ? false : data.advance();
-						}
-					}
-				}
+				// Using the wchar_t facet of the eon locale, as there is no
+				// std::ctype<char_t> (which would throw std::bad_cast)
+				auto& loc = locale::get();
+				auto l = static_cast<char_t>( loc.toLower( static_cast<wchar_t>( c ) ) );
+				auto u = static_cast<char_t>( loc.toUpper( static_cast<wchar_t>( c ) ) );
+				if( l != u && _match( c == l ? u : l ) )
+					return !Value.Negate;
 			}
+			return Value.Negate;
+		}
+
+		bool CharGroup::_match( RxData& data, index_t steps ) const
+		{
+			if( data )
+				return matchChar( data(), data.flags() & Flag::icase ) ? data.advance() : false;
+
+			// At end of input, a negated group is a match
 			if( Value.Negate )
 				data.advance();
 			return Value.Negate;
 		}
-		bool CharGroup::_match( char_t chr )
+		bool CharGroup::_match( char_t chr ) const
 		{
 			auto found = Value.Chars.find( chr );
 			if( found != Value.Chars.end() )
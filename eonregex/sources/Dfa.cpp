@@ -0,0 +1,480 @@
+#include "Dfa.h"
+
+
+namespace eon
+{
+	namespace rx
+	{
+		// Transition code for giving up
+		static const int32_t GaveUp{ -2 };
+
+		// Count characters from 'begin' to 'end' (all bytes if not 'utf8')
+		static inline index_t _countChars( const char* begin, const char* end, bool utf8 ) noexcept
+		{
+			if( !utf8 )
+				return end - begin;
+			index_t num{ 0 };
+			for( auto c = begin; c < end; ++c )
+			{
+				if( ( *c & 0xC0 ) != 0x80 )
+					++num;
+			}
+			return num;
+		}
+
+
+		Dfa::Dfa( const Program& program )
+		{
+			reset( program );
+		}
+
+		void Dfa::reset( const Program& program )
+		{
+			Serial = program.serial();
+			Failed = false;
+			States.clear();
+			Kernels.clear();
+			Lookup.clear();
+			Direct.clear();
+			Other.clear();
+			for( auto& start : Starts )
+				start = unknown;
+			Visited.assign( program.size() + 1, 0 );
+			Generation = 0;
+
+			// The dead state has no threads and can never match
+			States.push_back( State() );
+			Direct.resize( NumDirect, static_cast<int32_t>( dead ) );
+		}
+
+
+		DfaResult Dfa::run( const Program& program, const string_iterator& pos, const char* end, bool anchored,
+			string_iterator& match_end, string_iterator* match_start )
+		{
+			if( Failed )
+				return DfaResult::unknown;
+			auto state = _start( program, pos, anchored );
+			if( state < 0 )
+				return DfaResult::unknown;
+
+			bool found{ false };
+			bool skips = !anchored && program.skips();
+			const char* idle_byte{ pos.byteData() };
+			index_t idle_char{ pos.numChar() };
+			for( auto it = pos; ; ++it )
+			{
+				int32_t t{ 0 };
+				if( skips && States[ state ].Idle && it && it.byteData() < end )
+				{
+					// Nothing in progress, skip ahead to where a match can
+					// start
+					auto skipped = it;
+					if( !program.skip( skipped, end ) )
+						break;
+					if( skipped.byteData() != it.byteData() )
+					{
+						it = skipped;
+						state = _start( program, it, false );
+						if( state < 0 )
+							return DfaResult::unknown;
+					}
+				}
+				if( match_start != nullptr && States[ state ].Idle )
+				{
+					idle_byte = it.byteData();
+					idle_char = it.numChar();
+				}
+				if( !it || it.byteData() >= end )
+				{
+					t = Direct[ state * NumDirect + 128 ];
+					if( t == unknown )
+						t = _compute( program, state, NullChr, true );
+					if( t < 0 )
+						return DfaResult::unknown;
+					if( t & 1 )
+					{
+						match_end = it;
+						found = true;
+					}
+					break;
+				}
+
+				t = _transition( program, state, *it );
+				if( t < 0 )
+					return DfaResult::unknown;
+				if( t & 1 )
+				{
+					match_end = it;
+					found = true;
+				}
+				state = t >> 1;
+				if( state == dead )
+					break;
+			}
+			if( !found )
+				return DfaResult::no_match;
+			if( match_start != nullptr )
+				*match_start = string_iterator( pos, idle_byte, idle_char );
+			return DfaResult::match;
+		}
+
+
+
+
+		DfaResult Dfa::feed( const Program& program, const string_iterator& pos, const char* end, bool at_end,
+			StreamScan& scan )
+		{
+			if( Failed )
+				return DfaResult::unknown;
+			int32_t state = scan.State;
+			if( state < 0 )
+			{
+				state = _start( program, pos, false );
+				if( state < 0 )
+					return DfaResult::unknown;
+			}
+
+			// Absolute positions
+			auto byte = [&]( const string_iterator& it ) { return scan.ResumeByte + ( it.byteData() - pos.byteData() ); };
+			auto chr = [&]( const string_iterator& it ) { return scan.ResumeChar + ( it.numChar() - pos.numChar() ); };
+
+			bool skips = program.skips();
+			for( auto it = pos; ; ++it )
+			{
+				int32_t t{ 0 };
+				if( skips && States[ state ].Idle && it && it.byteData() < end )
+				{
+					auto skipped = it;
+					if( !program.skip( skipped, end ) )
+					{
+						if( at_end )
+							break;
+
+						// Nothing in this piece, but a prefix can start at
+						// the end of it and continue in the next
+						auto keep = std::min<index_t>( program.prefixSize() > 0 ? program.prefixSize() - 1 : 0,
+							end - it.byteData() );
+						auto from = end - keep;
+						while( from > it.byteData() && ( *from & 0xC0 ) == 0x80 )
+							--from;
+						scan.State = -1;
+						scan.ResumeByte = scan.IdleByte = byte( it ) + ( from - it.byteData() );
+						scan.ResumeChar = scan.IdleChar = chr( it ) + _countChars( it.byteData(), from, it.validUTF8() );
+						return DfaResult::partial;
+					}
+					if( skipped.byteData() != it.byteData() )
+					{
+						it = skipped;
+						state = _start( program, it, false );
+						if( state < 0 )
+							return DfaResult::unknown;
+					}
+				}
+				if( !scan.Found && States[ state ].Idle )
+				{
+					scan.IdleByte = byte( it );
+					scan.IdleChar = chr( it );
+				}
+				if( !it || it.byteData() >= end )
+				{
+					if( !at_end )
+					{
+						scan.State = state;
+						scan.ResumeByte = byte( it );
+						scan.ResumeChar = chr( it );
+						return DfaResult::partial;
+					}
+					t = Direct[ state * NumDirect + 128 ];
+					if( t == unknown )
+						t = _compute( program, state, NullChr, true );
+					if( t < 0 )
+						return DfaResult::unknown;
+					if( t & 1 )
+					{
+						scan.Found = true;
+						scan.EndByte = byte( it );
+						scan.EndChar = chr( it );
+					}
+					break;
+				}
+
+				t = _transition( program, state, *it );
+				if( t < 0 )
+					return DfaResult::unknown;
+				if( t & 1 )
+				{
+					scan.Found = true;
+					scan.EndByte = byte( it );
+					scan.EndChar = chr( it );
+				}
+				state = t >> 1;
+				if( state == dead )
+					break;
+			}
+			scan.State = -1;
+			return scan.Found ? DfaResult::match : DfaResult::no_match;
+		}
+
+		DfaResult Dfa::runSet( const Program& program, const string_iterator& pos, const char* end, bool anchored,
+			SetScan& scan )
+		{
+			if( Failed )
+				return DfaResult::unknown;
+			auto state = _start( program, pos, anchored );
+			if( state < 0 )
+				return DfaResult::unknown;
+
+			bool skips = !anchored && program.skips();
+			scan.Idle = pos;
+			for( auto it = pos; ; ++it )
+			{
+				int32_t t{ 0 };
+				if( skips && States[ state ].Idle && it && it.byteData() < end )
+				{
+					auto skipped = it;
+					if( !program.skip( skipped, end ) )
+						break;
+					if( skipped.byteData() != it.byteData() )
+					{
+						it = skipped;
+						state = _start( program, it, false );
+						if( state < 0 )
+							return DfaResult::unknown;
+					}
+				}
+				if( scan.Longest == no_index && States[ state ].Idle )
+					scan.Idle = it;
+				if( !it || it.byteData() >= end )
+				{
+					t = Direct[ state * NumDirect + 128 ];
+					if( t == unknown )
+						t = _compute( program, state, NullChr, true );
+					if( t < 0 )
+						return DfaResult::unknown;
+					if( t & 1 )
+						_report( scan, t >> 1, it );
+					break;
+				}
+
+				t = _transition( program, state, *it );
+				if( t < 0 )
+					return DfaResult::unknown;
+				if( t & 1 )
+				{
+					_report( scan, t >> 1, it );
+					if( scan.FirstOnly )
+						break;
+				}
+				state = t >> 1;
+				if( state == dead )
+					break;
+			}
+			return scan.Longest != no_index ? DfaResult::match : DfaResult::no_match;
+		}
+
+
+
+
+		int32_t Dfa::_start( const Program& program, const string_iterator& pos, bool anchored )
+		{
+			uint8_t flags = anchored ? Dfa::anchored : 0;
+			if( program.context() )
+			{
+				flags |= Context::details( pos.numByte() > 0 ? *( pos - 1 ) : NullChr );
+				if( pos.numChar() == 0 )
+					flags |= start;
+			}
+			if( Starts[ flags ] != unknown )
+				return Starts[ flags ];
+
+			Kernel.clear();
+			if( anchored )
+				Kernel.push_back( 0 );
+			return Starts[ flags ] = _state( Kernel, flags );
+		}
+
+		int32_t Dfa::_other( int32_t state, char_t c ) const noexcept
+		{
+			auto found = Other.find( ( static_cast<uint64_t>( state ) << 32 ) | c );
+			return found != Other.end() ? found->second : unknown;
+		}
+
+		int32_t Dfa::_compute( const Program& program, int32_t state, char_t c, bool at_end )
+		{
+			// Copy the instructions, adding states may move them
+			auto flags = States[ state ].Flags;
+			Kernel.assign( Kernels.begin() + States[ state ].First,
+				Kernels.begin() + States[ state ].First + States[ state ].Size );
+			if( !( flags & anchored ) && !( flags & matched ) )
+				Kernel.push_back( 0 );		// Lowest priority, a match starting here
+
+			Context context;
+			context.AtEnd = at_end;
+			if( program.context() )
+			{
+				context.Prev = flags & Context::all;
+				context.Cur = at_end ? 0 : Context::details( c );
+				context.Start = flags & start;
+			}
+
+			// Follow all threads, in priority order, to consuming (or match)
+			// instructions
+			if( ++Generation == 0 )
+			{
+				std::fill( Visited.begin(), Visited.end(), 0 );
+				Generation = 1;
+			}
+			Threads.clear();
+			for( auto first : Kernel )
+			{
+				Stack.push_back( first );
+				while( !Stack.empty() )
+				{
+					auto pc = Stack.back();
+					Stack.pop_back();
+					while( Visited[ pc ] != Generation )
+					{
+						Visited[ pc ] = Generation;
+						auto& instruction = program[ pc ];
+						if( instruction.Op == Instruction::op::split )
+						{
+							Stack.push_back( instruction.Y );
+							pc = instruction.X;
+						}
+						else if( instruction.Op == Instruction::op::jump )
+							pc = instruction.X;
+						else if( instruction.Op == Instruction::op::save )
+							++pc;
+						else if( !instruction.consuming() && instruction.Op != Instruction::op::match )
+						{
+							if( !program.holds( instruction, context ) )
+								break;
+							++pc;
+						}
+						else
+						{
+							Threads.push_back( pc );
+							break;
+						}
+					}
+				}
+			}
+
+			// Step all threads, threads of lower priority than a match are
+			// cut off (unless a set, where all matches count)
+			bool match_here{ false };
+			Next.clear();
+			Matched.clear();
+			for( auto pc : Threads )
+			{
+				auto& instruction = program[ pc ];
+				if( instruction.Op == Instruction::op::match )
+				{
+					match_here = true;
+					if( !program.isSet() )
+						break;
+					Matched.push_back( instruction.X );
+				}
+				else if( !at_end && program.consumes( instruction, c ) )
+					Next.push_back( pc + 1 );
+			}
+
+			int32_t next{ dead };
+			if( !at_end )
+			{
+				uint8_t next_flags = flags & anchored;
+				if( !( flags & anchored ) && !program.isSet() && ( match_here || ( flags & matched ) ) )
+					next_flags |= matched;
+				if( program.context() )
+					next_flags |= Context::details( c );
+				if( !Next.empty() || !Matched.empty() || !( next_flags & ( anchored | matched ) ) )
+				{
+					next = _state( Next, next_flags, Matched );
+					if( next < 0 )
+						return next;
+				}
+			}
+			else if( !Matched.empty() )
+			{
+				// Need a state to hold the patterns that matched at the end
+				Next.clear();
+				next = _state( Next, flags & anchored, Matched );
+				if( next < 0 )
+					return next;
+			}
+
+			auto t = ( next << 1 ) | ( match_here ? 1 : 0 );
+			if( at_end )
+				Direct[ state * NumDirect + 128 ] = t;
+			else if( c < 128 )
+				Direct[ state * NumDirect + c ] = t;
+			else
+				Other[ ( static_cast<uint64_t>( state ) << 32 ) | c ] = t;
+			return t;
+		}
+
+		void Dfa::_report( SetScan& scan, int32_t state, const string_iterator& pos )
+		{
+			auto first = Kernels.begin() + States[ state ].First + States[ state ].Size;
+			auto last = first + States[ state ].NumMatched;
+			scan.Longest = *std::min_element( first, last );
+			scan.End = pos;
+			if( scan.Collect )
+			{
+				for( auto id = first; id != last; ++id )
+				{
+					if( scan.Seen.size() <= *id )
+						scan.Seen.resize( *id + 1, false );
+					if( !scan.Seen[ *id ] )
+					{
+						scan.Seen[ *id ] = true;
+						scan.Patterns.push_back( *id );
+					}
+				}
+			}
+		}
+
+		int32_t Dfa::_state( const std::vector<uint32_t>& kernel, uint8_t flags )
+		{
+			Matched.clear();
+			return _state( kernel, flags, Matched );
+		}
+
+		int32_t Dfa::_state( const std::vector<uint32_t>& kernel, uint8_t flags, const std::vector<uint32_t>& patterns )
+		{
+			size_t hash = flags;
+			for( auto pc : kernel )
+				hash = hash * 1000003 + pc;
+			for( auto id : patterns )
+				hash = hash * 1000033 + id;
+			auto range = Lookup.equal_range( hash );
+			for( auto found = range.first; found != range.second; ++found )
+			{
+				auto& state = States[ found->second ];
+				if( state.Flags == flags && state.Size == kernel.size() && state.NumMatched == patterns.size()
+					&& std::equal( kernel.begin(), kernel.end(), Kernels.begin() + state.First )
+					&& std::equal( patterns.begin(), patterns.end(), Kernels.begin() + state.First + state.Size ) )
+					return found->second;
+			}
+
+			if( States.size() >= MaxStates )
+			{
+				Failed = true;
+				return GaveUp;
+			}
+			State state;
+			state.First = Kernels.size();
+			state.Size = kernel.size();
+			state.NumMatched = patterns.size();
+			state.Flags = flags;
+			state.Idle = kernel.empty() && patterns.empty() && !( flags & ( anchored | matched ) );
+			Kernels.insert( Kernels.end(), kernel.begin(), kernel.end() );
+			Kernels.insert( Kernels.end(), patterns.begin(), patterns.end() );
+			States.push_back( state );
+			Direct.resize( Direct.size() + NumDirect, static_cast<int32_t>( unknown ) );
+			auto id = static_cast<int32_t>( States.size() - 1 );
+			Lookup.emplace( hash, id );
+			return id;
+		}
+	}
+}
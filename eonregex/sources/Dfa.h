@@ -0,0 +1,128 @@
+#pragma once
+
+#include "../Program.h"
+#include <unordered_map>
+
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// The 'eon' namespace encloses all public functionality
+//
+namespace eon
+{
+	///////////////////////////////////////////////////////////////////////////
+	//
+	// The 'eon::rx' namespace enclosed special elements for Eon regular
+	// expressions
+	//
+	namespace rx
+	{
+		// Lazily built DFA for an [eon::rx::Program]
+		// A DFA state is the list of instructions (in priority order) that
+		// threads are at after consuming a character, together with
+		// details about that character (for assertions), if at the start of
+		// input, and (when searching) if a match has been seen. States and
+		// transitions are added as they are first needed, and kept for later
+		// runs.
+		// Like the Pike VM, the DFA finds the leftmost-first match, but only
+		// where it ends.
+		// For a set of programs (see [eon::rx::Program::addToSet]), no
+		// threads are cut off by a match, and the states reached by a match
+		// also list the programs (patterns) that matched.
+		class Dfa
+		{
+		public:
+			// States are limited in number, the DFA gives up when exceeded
+			static const index_t MaxStates{ 2000 };
+
+			Dfa() = delete;
+			Dfa( const Program& program );
+			Dfa( const Dfa& ) = delete;
+			~Dfa() = default;
+
+			Dfa& operator=( const Dfa& ) = delete;
+
+			// Prepare for another program, discarding all states
+			void reset( const Program& program );
+
+			inline uint64_t serial() const noexcept { return Serial; }
+
+			// Check if the DFA has given up on the program
+			inline bool failed() const noexcept { return Failed; }
+
+			// Run from 'pos' to 'end' (byte position)
+			// If 'anchored', the match must start at 'pos'. If a match,
+			// 'match_end' is set to where it ends, and 'match_start' (if
+			// not nullptr) to the last position before it where there were
+			// no threads (the match cannot start any earlier).
+			DfaResult run( const Program& program, const string_iterator& pos, const char* end, bool anchored,
+				string_iterator& match_end, string_iterator* match_start = nullptr );
+
+			// Feed the piece of input from 'pos' to 'end' (byte position) to
+			// a search, continuing from where 'scan' left off
+			// 'pos' must be at the resume position of 'scan', which is
+			// absolute. If 'at_end', 'end' is the end of the input.
+			// Returns [eon::rx::DfaResult::partial] if more input is needed,
+			// otherwise if a (leftmost-first) match was found, with 'scan'
+			// having the last idle position before it and where it ends.
+			DfaResult feed( const Program& program, const string_iterator& pos, const char* end, bool at_end,
+				StreamScan& scan );
+
+			// Run a set of programs from 'pos' to 'end' (byte position)
+			// If 'anchored', matches must start at 'pos'.
+			DfaResult runSet( const Program& program, const string_iterator& pos, const char* end, bool anchored,
+				SetScan& scan );
+
+		private:
+			// State flags, in addition to the details of the previous
+			// character
+			static const uint8_t start{ 0x20 };
+			static const uint8_t matched{ 0x40 };
+			static const uint8_t anchored{ 0x80 };
+
+			// Transitions are numbered states shifted up one, with the lowest
+			// bit set if there is a match before the character. Not yet
+			// known transitions are 'unknown'.
+			static const int32_t unknown{ -1 };
+			static const int32_t dead{ 0 };
+
+			// Number of transitions directly indexed, for all ASCII
+			// characters, plus end of input
+			static const index_t NumDirect{ 129 };
+
+			struct State
+			{
+				index_t First{ 0 };		// Position of instructions in 'Kernels'
+				index_t Size{ 0 };
+				index_t NumMatched{ 0 };	// Number of matched patterns, following the instructions
+				uint8_t Flags{ 0 };
+				bool Idle{ false };		// No threads, and no match seen while searching
+			};
+
+			int32_t _start( const Program& program, const string_iterator& pos, bool anchored );
+			inline int32_t _transition( const Program& program, int32_t state, char_t c ) {
+				auto t = c < 128 ? Direct[ state * NumDirect + c ]
+					: _other( state, c ); return t != unknown ? t : _compute( program, state, c, false ); }
+			int32_t _other( int32_t state, char_t c ) const noexcept;
+			int32_t _compute( const Program& program, int32_t state, char_t c, bool at_end );
+			int32_t _state( const std::vector<uint32_t>& kernel, uint8_t flags );
+			int32_t _state( const std::vector<uint32_t>& kernel, uint8_t flags, const std::vector<uint32_t>& patterns );
+			void _report( SetScan& scan, int32_t state, const string_iterator& pos );
+
+		private:
+			uint64_t Serial{ 0 };
+			std::vector<State> States;
+			std::vector<uint32_t> Kernels;
+			std::unordered_multimap<size_t, int32_t> Lookup;
+			std::vector<int32_t> Direct;
+			std::unordered_map<uint64_t, int32_t> Other;
+			int32_t Starts[ 256 ];
+			bool Failed{ false };
+
+			// Scratch space for computing transitions
+			std::vector<uint32_t> Visited;
+			uint32_t Generation{ 0 };
+			std::vector<uint32_t> Stack, Threads, Kernel, Next, Matched;
+		};
+	}
+}
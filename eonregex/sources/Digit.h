@@ -33,8 +33,10 @@ namespace eon
 				*static_cast<Node*>( this ) = std::move( other ); return *this; }
 
 		private:
-			inline bool _match( RxData& data, index_t steps ) override {
+			inline bool _match( RxData& data, index_t steps ) const override {
 				return string::isNumberAsciiDigit( data() ) ? data.advance() : false; }
+			inline bool _compile( Program& program ) const override {
+				program.emitClass( CharClass::digit ); return true; }
 			inline string _strStruct() const override { return "\\d"; }
 			inline index_t _countMinCharsRemaining() noexcept override {
 				return MinCharsRemaining = Quant.minQ() + ( Next ? Next->_countMinCharsRemaining() : 0 ); }
@@ -56,8 +58,10 @@ namespace eon
 				*static_cast<Node*>( this ) = std::move( other ); return *this; }
 
 		private:
-			inline bool _match( RxData& data, index_t steps ) override {
+			inline bool _match( RxData& data, index_t steps ) const override {
 				return data && !string::isNumberDecimalDigit( data() ) ? data.advance() : false; }
+			inline bool _compile( Program& program ) const override {
+				program.emitClass( CharClass::not_digit ); return true; }
 			inline string _strStruct() const override { return "\\D"; }
 			inline index_t _countMinCharsRemaining() noexcept override {
 				return MinCharsRemaining = Quant.minQ() + ( Next ? Next->_countMinCharsRemaining() : 0 );
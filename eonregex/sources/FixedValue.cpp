@@ -5,7 +5,7 @@ namespace eon
 {
 	namespace rx
 	{
-		bool FixedValue::_match( RxData& data, index_t steps )
+		bool FixedValue::_match( RxData& data, index_t steps ) const
 		{
 			RxData param_b{ data };
 
@@ -21,6 +21,18 @@ namespace eon
 			return true;
 		}
 
+		bool FixedValue::_compile( Program& program ) const
+		{
+			bool icase = program.flags() & Flag::icase;
+			for( auto c : Value )
+			{
+				Instruction chr( icase ? Instruction::op::chr_icase : Instruction::op::chr );
+				chr.Char = icase ? static_cast<char_t>( std::tolower( c ) ) : c;
+				program.emit( chr );
+			}
+			return true;
+		}
+
 		string FixedValue::_strStruct() const
 		{
 			static const string special{ R"(|!{}?*+()^$[]\".@)" };
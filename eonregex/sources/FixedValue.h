@@ -40,7 +40,9 @@ namespace eon
 			inline void append( const string& value ) noexcept { Value += value; }
 
 		private:
-			bool _match( RxData& data, index_t steps ) override;
+			bool _match( RxData& data, index_t steps ) const override;
+			bool _compile( Program& program ) const override;
+			inline string _requiredLiteral() const override { return Value; }
 
 			string _strStruct() const override;
 
@@ -24,16 +24,44 @@ namespace eon
 			Source = other.Source;
 			Head = other.Head->copy();
 			MyFlags = other.MyFlags;
+			_index();
+			_listGroups();
+			_compile();
 			return *this;
 		}
 		Graph& Graph::operator=( Graph&& other ) noexcept
 		{
 			Source = std::move( other.Source );
 			Head = other.Head; other.Head = nullptr;
+			NumNodes = other.NumNodes; other.NumNodes = 0;
+			Groups = std::move( other.Groups );
+			Compiled = std::move( other.Compiled );
 			MyFlags = std::move( other.MyFlags );
 			return *this;
 		}
 
+		bool Graph::match( RxData& param, rx::match& result ) const
+		{
+			if( !Compiled.empty() )
+				return !Head->_missingFixedEnd( param ) && Compiled.match( param, result );
+			if( !Head )
+				return false;
+
+			auto start = param.pos();
+			Head->_unmatch( param.state() );
+			if( !Head->match( param ) )
+				return false;
+			result.clear();
+			result.set( name_complete, substring( start, param.pos() ) );
+			if( auto captures = param.captures() )
+			{
+				for( auto& capture : *captures )
+					result.set( capture.first, capture.second );
+			}
+			return true;
+		}
+
+
 		void Graph::parse( substring source, substring flags )
 		{
 			if( source.empty() )
@@ -55,6 +83,9 @@ namespace eon
 				if( !(MyFlags & Flag::lines ) && ( MyFlags & Flag::failfast_fixed_end ) )
 					_failFastFixedEnd();
 				_countMinCharsRemaining();
+				_index();
+				_listGroups();
+				_compile();
 			}
 		}
 
@@ -114,6 +145,15 @@ namespace eon
 						case 'e':
 							MyFlags |= Flag::no_exposing;
 							break;
+						case 'v':
+							MyFlags |= Flag::no_vm;
+							break;
+						case 'd':
+							MyFlags |= Flag::no_dfa;
+							break;
+						case 'p':
+							MyFlags |= Flag::no_prefilter;
+							break;
 						default:
 							invalid.push_back( string( "!" ) << c );
 							break;
@@ -800,5 +840,11 @@ namespace eon
 			Head = Head->_exposeLiterals(); }
 		void Graph::_failFastFixedEnd() {
 			Head->_failFastFixedEnd( *Head ); }
+		void Graph::_index() noexcept {
+			NumNodes = 0; if( Head ) Head->_index( NumNodes ); }
+		void Graph::_listGroups() {
+			Groups.clear(); if( Head ) Head->_groups( Groups ); }
+		void Graph::_compile() {
+			Compiled.clear(); if( Head && !( MyFlags & Flag::no_vm ) ) Compiled.compile( *Head, MyFlags ); }
 	}
 }
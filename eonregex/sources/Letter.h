@@ -34,8 +34,10 @@ namespace eon
 				*static_cast<Node*>( this ) = std::move( other ); return *this; }
 
 		private:
-			inline bool _match( RxData& data, index_t step ) override {
+			inline bool _match( RxData& data, index_t step ) const override {
 				return string::isLetter( data() ) ? data.advance() : false; }
+			inline bool _compile( Program& program ) const override {
+				program.emitClass( CharClass::letter ); return true; }
 			inline string _strStruct() const override { return "\\u"; }
 			inline index_t _countMinCharsRemaining() noexcept override {
 				return MinCharsRemaining = Quant.minQ() + ( Next ? Next->_countMinCharsRemaining() : 0 ); }
@@ -58,8 +60,10 @@ namespace eon
 				*static_cast<Node*>( this ) = std::move( other ); return *this; }
 
 		private:
-			inline bool _match( RxData& data, index_t step ) override {
+			inline bool _match( RxData& data, index_t step ) const override {
 				return !string::isLetter( data() ) ? data.advance() : false; }
+			inline bool _compile( Program& program ) const override {
+				program.emitClass( CharClass::not_letter ); return true; }
 			inline string _strStruct() const override { return "\\U"; }
 			inline index_t _countMinCharsRemaining() noexcept override {
 				return MinCharsRemaining = Quant.minQ() + ( Next ? Next->_countMinCharsRemaining() : 0 ); }
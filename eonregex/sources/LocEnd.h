@@ -33,9 +33,18 @@ namespace eon
 				*static_cast<Node*>( this ) = std::move( other ); return *this; }
 
 		private:
-			inline bool _match( RxData& param, index_t steps ) override {
+			inline bool _match( RxData& param, index_t steps ) const override {
 				return !param ? true : param.pos() == param.source().end() ? true
 					: ( param.lines() && param() == '\n' ) ? param.advance() : false; }
+			inline bool _compile( Program& program ) const override {
+				if( !( program.flags() & Flag::lines ) ) { program.emit( Instruction( Instruction::op::end ) ); return true; }
+				// At end, or consume the newline
+				auto split = program.emit( Instruction( Instruction::op::split ) );
+				auto at_end = program.emit( Instruction( Instruction::op::end ) );
+				auto jump = program.emit( Instruction( Instruction::op::jump ) );
+				Instruction newline( Instruction::op::chr ); newline.Char = NewlineChr; auto at_newline = program.emit( newline );
+				program.at( split ).X = at_end; program.at( split ).Y = at_newline; program.at( jump ).X = program.pc();
+				return true; }
 			inline string _strStruct() const override { return "$"; }
 			inline index_t _countMinCharsRemaining() noexcept override {
 				return MinCharsRemaining = Next ? Next->_countMinCharsRemaining() : 0; }
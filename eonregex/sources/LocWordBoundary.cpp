@@ -5,7 +5,7 @@ namespace eon
 {
 	namespace rx
 	{
-		bool LocWordEnd::_match( RxData& data, index_t steps )
+		bool LocWordEnd::_match( RxData& data, index_t steps ) const
 		{
 			if( data.bounds() )
 			{
@@ -32,7 +32,9 @@ namespace eon
 				*static_cast<Node*>( this ) = std::move( other ); return *this; }
 
 		private:
-			bool _match( RxData& data, index_t steps ) override;
+			bool _match( RxData& data, index_t steps ) const override;
+			inline bool _compile( Program& program ) const override {
+				program.emit( Instruction( Instruction::op::word_end ) ); return true; }
 			inline string _strStruct() const override { return "\\B"; }
 			
 			inline index_t _countMinCharsRemaining() noexcept override {
@@ -0,0 +1,86 @@
+#include "../Match.h"
+
+
+namespace eon
+{
+	namespace rx
+	{
+		match& match::operator=( match&& other ) noexcept
+		{
+			Source = other.Source;
+			NumCaptures = other.NumCaptures;
+			std::copy( other.Inline, other.Inline + ( NumCaptures < NumInline ? NumCaptures : NumInline ), Inline );
+			Overflow = std::move( other.Overflow );
+			other.clear();
+			return *this;
+		}
+
+
+		index_t match::size() const noexcept
+		{
+			index_t size{ 0 };
+			for( index_t i = 0; i < NumCaptures; ++i )
+			{
+				if( _at( i ).Begin != nullptr )
+					++size;
+			}
+			return size;
+		}
+
+		substring match::group( const name_t name ) const noexcept
+		{
+			for( index_t i = 0; i < NumCaptures; ++i )
+			{
+				auto& capt = _at( i );
+				if( capt.Name == name )
+					return capt.Begin != nullptr ? _substr( capt ) : substring();
+			}
+			return substring();
+		}
+
+
+		void match::layout( const string_iterator& source, const std::vector<name_t>& names )
+		{
+			clear();
+			Source = source;
+			_add( name_complete );
+			for( auto name : names )
+				_add( name );
+		}
+
+		void match::set( name_t name, const substring& captured )
+		{
+			if( NumCaptures == 0 )
+				Source = captured.begin();
+			capture* capt{ nullptr };
+			for( index_t i = 0; i < NumCaptures && capt == nullptr; ++i )
+			{
+				if( _at( i ).Name == name )
+					capt = &_at( i );
+			}
+			if( capt == nullptr )
+				capt = &_add( name );
+			capt->Begin = captured.begin().byteData();
+			capt->BeginChar = captured.begin().numChar();
+			capt->End = captured.end().byteData();
+			capt->EndChar = captured.end().numChar();
+		}
+
+
+		match::capture& match::_add( name_t name )
+		{
+			capture* capt{ nullptr };
+			if( NumCaptures < NumInline )
+				capt = &Inline[ NumCaptures ];
+			else
+			{
+				Overflow.push_back( capture() );
+				capt = &Overflow.back();
+			}
+			++NumCaptures;
+			*capt = capture();
+			capt->Name = name;
+			return *capt;
+		}
+	}
+}
@@ -0,0 +1,105 @@
+#include "../MatchState.h"
+#include "Dfa.h"
+
+
+namespace eon
+{
+	namespace rx
+	{
+		// Number of DFAs kept by each state
+		static const index_t MaxDfas{ 16 };
+
+
+		MatchState::MatchState() = default;
+		MatchState::~MatchState() = default;
+
+		MatchState& MatchState::forThread()
+		{
+			static thread_local MatchState state;
+			return state;
+		}
+
+
+		void MatchState::reset( index_t num_nodes )
+		{
+			if( Nodes.size() < num_nodes )
+				Nodes.resize( num_nodes );
+			for( index_t i = 0; i < num_nodes; ++i )
+			{
+				auto& node = Nodes[ i ];
+				if( node.Matched.source() )
+					node.Matched = RxData();
+				node.PrevPos = RecordedPos();
+				node.Captured = false;
+			}
+			Marker = 0;
+		}
+
+		Dfa& MatchState::dfa( const Program& program )
+		{
+			for( auto dfa = Dfas.begin(); dfa != Dfas.end(); ++dfa )
+			{
+				if( ( *dfa )->serial() == program.serial() )
+				{
+					std::rotate( Dfas.begin(), dfa, dfa + 1 );
+					return *Dfas.front();
+				}
+			}
+
+			if( Dfas.size() < MaxDfas )
+				Dfas.insert( Dfas.begin(), std::unique_ptr<Dfa>( new Dfa( program ) ) );
+			else
+			{
+				// Reuse the least recently used
+				std::rotate( Dfas.begin(), Dfas.end() - 1, Dfas.end() );
+				Dfas.front()->reset( program );
+			}
+			return *Dfas.front();
+		}
+
+		void MatchState::Vm::Threads::prepare( index_t num_instructions, index_t num_slots )
+		{
+			if( Sparse.size() < num_instructions )
+			{
+				Sparse.resize( num_instructions );
+				Dense.resize( num_instructions );
+				Pcs.resize( num_instructions );
+			}
+			if( Slots.size() < num_instructions * num_slots )
+				Slots.resize( num_instructions * num_slots );
+			clear();
+		}
+
+		index_t MatchState::vmSteps() const noexcept
+		{
+			index_t steps{ 0 };
+			for( auto& vm : Vms )
+				steps += vm.Steps;
+			return steps;
+		}
+
+		MatchState::Stack& MatchState::_borrowStack()
+		{
+			if( StacksInUse == Stacks.size() )
+			{
+				Stacks.emplace_back();
+				Stacks.back().reserve( 53 );
+			}
+			return Stacks[ StacksInUse++ ];
+		}
+		void MatchState::_returnStack() noexcept
+		{
+			// Pop rather than clear, to keep the capacity
+			auto& stack = Stacks[ --StacksInUse ];
+			while( !stack.empty() )
+				stack.pop();
+		}
+
+		MatchState::Vm& MatchState::_borrowVm()
+		{
+			if( VmsInUse == Vms.size() )
+				Vms.emplace_back();
+			return Vms[ VmsInUse++ ];
+		}
+	}
+}
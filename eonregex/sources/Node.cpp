@@ -9,7 +9,7 @@ namespace eon
 	{
 		Node& Node::operator=( const Node& other )
 		{
-			Matched = other.Matched;
+			Id = other.Id;
 			Next = other.Next != nullptr ? other.Next->copy() : nullptr;
 			Group = nullptr;
 			FixedEnd = other.FixedEnd;
@@ -20,12 +20,11 @@ namespace eon
 			Source = other.Source;
 			Type = other.Type;
 			PreAnchoring = other.PreAnchoring;
-			PrevPos = other.PrevPos;
 			return *this;
 		}
 		Node& Node::operator=( Node&& other ) noexcept
 		{
-			Matched = std::move( other.Matched );
+			Id = other.Id;
 			Next = other.Next; other.Next = nullptr;
 			Group= nullptr;
 			FixedEnd = other.FixedEnd; other.FixedEnd = nullptr;
@@ -36,20 +35,21 @@ namespace eon
 			Source = other.Source; other.Source.clear();
 			Type = other.Type;
 			PreAnchoring = other.PreAnchoring; other.PreAnchoring = Anchor::none;
-			PrevPos = other.PrevPos;
 			return *this;
 		}
 
 
 
 
-		bool Node::match( RxData& data, index_t steps )
+		bool Node::match( RxData& data, index_t steps ) const
 		{
 			// If this node has already been successfully matched, don't try again!
-			if( _matched() )
+			auto& state = data.state();
+			if( _matched( state ) )
 			{
-				Matched.addCaptures( data.captures() );
-				data = Matched;
+				auto& matched = state.node( Id ).Matched;
+				matched.addCaptures( data.captures() );
+				data = matched;
 				return true;
 			}
 
@@ -57,27 +57,22 @@ namespace eon
 			// pattern, we can report failure right now!
 			if( data.remaining() < MinCharsRemaining )
 			{
-				_unmatch();
+				_unmatch( state );
 				return false;
 			}
 
 			// Check anchors
 			if( PreAnchoring != Anchor::none && !_preAnchorMatch( data ) )
 			{
-				_unmatch();
+				_unmatch( state );
 				return false;
 			}
 
 			// If we have a fixed end, then we can fail fast by checking if it's there or not
-			if( FixedEnd )
+			if( _missingFixedEnd( data ) )
 			{
-				FixedValue* endvalue = (FixedValue*)FixedEnd;
-				if( endvalue->value().substr() != substring(
-					data.source().end() - endvalue->value().numChars(), data.source().end() ) )
-				{
-					_unmatch();
-					return false;
-				}
+				_unmatch( state );
+				return false;
 			}
 
 			// Cases:
@@ -97,13 +92,48 @@ namespace eon
 				success = _matchRangeNongreedy( data, steps );
 
 			if( success )
-				Matched = data;
+				state.node( Id ).Matched = data;
 			else
-				_unmatch();
+				_unmatch( state );
 			return success;
 		}
 
 
+		bool Node::_missingFixedEnd( const RxData& data ) const
+		{
+			if( !FixedEnd )
+				return false;
+			FixedValue* endvalue = (FixedValue*)FixedEnd;
+			return endvalue->value().substr() != substring(
+				data.source().end() - endvalue->value().numChars(), data.source().end() );
+		}
+
+
+		bool Node::compile( Program& program ) const
+		{
+			for( auto node = this; node != nullptr; node = node->Next )
+			{
+				if( !node->_compileQuantified( program ) || program.full() )
+					return false;
+			}
+			return true;
+		}
+
+		string Node::requiredLiteral() const
+		{
+			string longest;
+			for( auto node = this; node != nullptr; node = node->Next )
+			{
+				if( node->Quant.minQ() == 0 )
+					continue;
+				auto literal = node->_requiredLiteral();
+				if( literal.numBytes() > longest.numBytes() )
+					longest = std::move( literal );
+			}
+			return longest;
+		}
+
+
 		void Node::_failFastFixedEnd( Node& head )
 		{
 			if( Next )
@@ -116,7 +146,7 @@ namespace eon
 
 
 
-		bool Node::_matchSingle( RxData& data, index_t steps )
+		bool Node::_matchSingle( RxData& data, index_t steps ) const
 		{
 			RxData data_tmp{ data };
 
@@ -139,7 +169,7 @@ namespace eon
 			data = std::move( data_tmp );
 			return true;
 		}
-		bool Node::_matchOneOrZero( RxData& data, index_t steps )
+		bool Node::_matchOneOrZero( RxData& data, index_t steps ) const
 		{
 			// Try to match one first
 			if( _matchSingle( data, steps ) )
@@ -159,14 +189,16 @@ namespace eon
 			else
 				return true;
 		}
-		bool Node::_matchRangeGreedy( RxData& data, index_t steps )
+		bool Node::_matchRangeGreedy( RxData& data, index_t steps ) const
 		{
-			if( PrevPos.same( data.pos(), data.marker() ) )
+			auto& prev_pos = _state( data ).PrevPos;
+			if( prev_pos.same( data.pos(), data.marker() ) )
 				return false;
-			PrevPos.mark( data.pos(), data.marker() );
+			prev_pos.mark( data.pos(), data.marker() );
 
 			// Match as many as possible from the start
-			auto matches = _stack();
+			MatchState::ScratchStack scratch( data.state() );
+			auto& matches = *scratch;
 			matches.push( data );
 			_matchMax( matches, steps );
 			if( matches.size() <= Quant.Min )
@@ -183,7 +215,7 @@ namespace eon
 			// (backgrack) until they do
 			return _matchNext( data, matches );
 		}
-		void Node::_matchMax( Stack& matches, index_t steps )
+		void Node::_matchMax( Stack& matches, index_t steps ) const
 		{
 			// Some special cases can be processed faster
 			if( _matchSpecialCase( matches ) )
@@ -192,7 +224,7 @@ namespace eon
 			matches.push( matches.top() );
 			while( true )
 			{
-				_unmatch();
+				_unmatch( matches.top().state() );
 				if( !_match( matches.top(), steps ) )
 				{
 					matches.pop();
@@ -205,7 +237,7 @@ namespace eon
 				matches.push( matches.top() );
 			}
 		}
-		bool Node::_matchSpecialCase( Stack& matches )
+		bool Node::_matchSpecialCase( Stack& matches ) const
 		{
 			switch( Type )
 			{
@@ -216,7 +248,7 @@ namespace eon
 					return false;
 			}
 		}
-		void Node::_matchAny( Stack& matches )
+		void Node::_matchAny( Stack& matches ) const
 		{
 			// Goble as much as we can
 			index_t gobbled{ 0 };
@@ -231,7 +263,7 @@ namespace eon
 					return;
 			}
 		}
-		bool Node::_noNext( RxData& data, Stack& matches )
+		bool Node::_noNext( RxData& data, Stack& matches ) const
 		{
 			if( matches.size() >= Quant.minQ() )
 			{
@@ -241,7 +273,7 @@ namespace eon
 			}
 			return false;
 		}
-		bool Node::_matchNext( RxData& data, Stack& matches )
+		bool Node::_matchNext( RxData& data, Stack& matches ) const
 		{
 			// 'matches' is a stack of RxData objects where the bottom element
 			// is the start of the current potential greedy match and the top
@@ -277,7 +309,7 @@ namespace eon
 				return true;
 			return false;
 		}
-		bool Node::_matchRangeNongreedy( RxData& data, index_t steps )
+		bool Node::_matchRangeNongreedy( RxData& data, index_t steps ) const
 		{
 			// Match as few as possible from the start
 			RxData data_tmp{ data };
@@ -318,7 +350,7 @@ namespace eon
 				else
 				{
 					// Didn't get a match, try matching this again
-					_unmatch();
+					_unmatch( data_tmp.state() );
 					if( !_match( data_tmp, steps ) )
 						return false;
 					++matches;
@@ -334,14 +366,69 @@ namespace eon
 
 			return false;
 		}
-		bool Node::_matchNext( RxData& data, index_t steps )
+		bool Node::_matchNext( RxData& data, index_t steps ) const
 		{
 			if( Next == nullptr )
 				return true;
 			return Next->match( data, steps );
 		}
 
-		bool Node::_preAnchorMatch( RxData& data )
+		// Set the branches of 'split' instruction, preferring 'body' if
+		// 'greedy', 'exit' if not
+		static inline void _branch( Program& program, uint32_t split, uint32_t body, uint32_t exit, bool greedy ) noexcept
+		{
+			program.at( split ).X = greedy ? body : exit;
+			program.at( split ).Y = greedy ? exit : body;
+		}
+
+		bool Node::_compileQuantified( Program& program ) const
+		{
+			if( PreAnchoring != Anchor::none )
+			{
+				Instruction anchor( Instruction::op::anchor );
+				anchor.Anchoring = PreAnchoring;
+				program.emit( anchor );
+			}
+			uint32_t name_slot{ 0 };
+			if( Name )
+			{
+				name_slot = program.newSlot();
+				program.emit( Instruction( Instruction::op::save, name_slot ) );
+			}
+
+			for( index_t i = 0; i < Quant.minQ(); ++i )
+			{
+				if( !_compile( program ) || program.full() )
+					return false;
+			}
+			if( Quant.maxQ() == INDEX_MAX )
+			{
+				auto split = program.emit( Instruction( Instruction::op::split ) );
+				if( !_compile( program ) )
+					return false;
+				program.emit( Instruction( Instruction::op::jump, split ) );
+				_branch( program, split, split + 1, program.pc(), Quant.greedy() );
+			}
+			else if( Quant.maxQ() > Quant.minQ() )
+			{
+				// Each optional occurrence can skip all the following
+				std::vector<uint32_t> splits;
+				for( index_t i = Quant.minQ(); i < Quant.maxQ(); ++i )
+				{
+					splits.push_back( program.emit( Instruction( Instruction::op::split ) ) );
+					if( !_compile( program ) || program.full() )
+						return false;
+				}
+				for( auto split : splits )
+					_branch( program, split, split + 1, program.pc(), Quant.greedy() );
+			}
+
+			if( Name )
+				program.emit( Instruction( Instruction::op::name, name_slot ) );
+			return true;
+		}
+
+		bool Node::_preAnchorMatch( RxData& data ) const
 		{
 			if( !data() )			// End of input cannot be start of anything
 				return false;
@@ -5,12 +5,11 @@ namespace eon
 {
 	namespace rx
 	{
-		bool NodeGroup::_match( RxData& data, index_t steps )
+		bool NodeGroup::_match( RxData& data, index_t steps ) const
 		{
 			if( Head != nullptr )
 			{
 				RxData param_b{ data };
-				Head->_setGroup( this );
 				if( Head->match( param_b, steps ) )
 				{
 					data = std::move( param_b );
@@ -39,6 +38,8 @@ namespace eon
 				node->Quant.Min *= Quant.Min;
 				node->Quant.Max = Quant.Max == INDEX_MAX || node->Quant.Max == INDEX_MAX ? INDEX_MAX
 					: Quant.Max * node->Quant.Max;
+				if( Quant.Min != 1 || Quant.Max != 1 )
+					node->Quant.Greedy = Quant.Greedy;
 				node->Name = Name;
 				node->Open = Open;
 				node->PreAnchoring |= PreAnchoring;
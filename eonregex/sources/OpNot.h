@@ -40,8 +40,15 @@ namespace eon
 					return Value->equal( *o.Value, cmpflag::deep | cmpflag::quant ); else return Value == o.Value; }
 
 		private:
-			inline bool _match( RxData& data, index_t steps ) override { return !Value->match( data, steps ); }
-			void _unmatch() noexcept override { if( Value->_matched() ) Value->_unmatch(); Node::_unmatch(); }
+			inline bool _match( RxData& data, index_t steps ) const override { return !Value->match( data, steps ); }
+			inline bool _compile( Program& program ) const override {
+				auto ahead = program.emit( Instruction( Instruction::op::not_ahead ) );
+				if( !Value->compile( program ) ) return false; program.emit( Instruction( Instruction::op::match ) );
+				program.at( ahead ).X = ahead + 1; program.at( ahead ).Y = program.pc(); return true; }
+			inline void _index( index_t& num_nodes ) noexcept override {
+				if( Value ) Value->_index( num_nodes ); Node::_index( num_nodes ); }
+			void _unmatch( MatchState& state ) const noexcept override {
+				if( Value->_matched( state ) ) Value->_unmatch( state ); Node::_unmatch( state ); }
 			inline string _strStruct() const override { return Value ? "!" + Value->strStruct() : "!"; }
 			inline void _removeDuplicates() override { if( Value ) Value->removeDuplicates(); }
 			inline void _combinedFixed() override { if( Value ) Value->combineFixed(); }
@@ -17,7 +17,7 @@ namespace eon
 
 
 
-		bool OpOr::_match( RxData& data, index_t steps )
+		bool OpOr::_match( RxData& data, index_t steps ) const
 		{
 			RxData data_b{ data };
 			for( auto& opt : Optionals )
@@ -31,6 +31,30 @@ namespace eon
 			return false;
 		}
 
+		bool OpOr::_compile( Program& program ) const
+		{
+			// Try each optional in order, skipping the remaining ones when
+			// matched
+			std::vector<uint32_t> jumps;
+			for( index_t i = 0; i < Optionals.size(); ++i )
+			{
+				if( i + 1 < Optionals.size() )
+				{
+					auto split = program.emit( Instruction( Instruction::op::split ) );
+					if( !Optionals[ i ]->compile( program ) )
+						return false;
+					jumps.push_back( program.emit( Instruction( Instruction::op::jump ) ) );
+					program.at( split ).X = split + 1;
+					program.at( split ).Y = program.pc();
+				}
+				else if( !Optionals[ i ]->compile( program ) )
+					return false;
+			}
+			for( auto jump : jumps )
+				program.at( jump ).X = program.pc();
+			return true;
+		}
+
 		index_t OpOr::_countMinCharsRemaining() noexcept
 		{
 			MinCharsRemaining = SIZE_MAX;
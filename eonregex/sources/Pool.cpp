@@ -0,0 +1,109 @@
+#include "Pool.h"
+#include <algorithm>
+
+
+namespace eon
+{
+	namespace rx
+	{
+		Pool::~Pool()
+		{
+			{
+				std::lock_guard<std::mutex> lock( Lock );
+				Stop = true;
+			}
+			Wake.notify_all();
+			for( auto& worker : Workers )
+				worker.join();
+		}
+
+		Pool& Pool::instance()
+		{
+			static Pool pool;
+			return pool;
+		}
+
+		index_t Pool::maxThreads() const noexcept
+		{
+			// One worker even on a single core, so that running in parallel
+			// can be tested anywhere
+			return std::max( std::thread::hardware_concurrency(), 2u );
+		}
+
+
+
+
+		void Pool::run( index_t num_tasks, index_t num_threads, const std::function<void( index_t )>& task )
+		{
+			Batch batch;
+			batch.Task = &task;
+			batch.NumTasks = num_tasks;
+			batch.MaxHelpers = std::min( num_threads, std::min( num_tasks, maxThreads() ) );
+			batch.MaxHelpers = batch.MaxHelpers > 0 ? batch.MaxHelpers - 1 : 0;
+			if( batch.MaxHelpers > 0 )
+			{
+				std::lock_guard<std::mutex> lock( Lock );
+				if( Workers.empty() )
+					_start();
+				Pending.push_back( &batch );
+			}
+			if( batch.MaxHelpers > 1 )
+				Wake.notify_all();
+			else if( batch.MaxHelpers == 1 )
+				Wake.notify_one();
+
+			_work( batch );
+
+			// All tasks are taken, wait for the helpers to finish theirs
+			if( batch.MaxHelpers > 0 )
+			{
+				std::unique_lock<std::mutex> lock( Lock );
+				Pending.erase( std::find( Pending.begin(), Pending.end(), &batch ) );
+				Finished.wait( lock, [&batch]() { return batch.Helpers == 0; } );
+			}
+		}
+
+
+
+
+		void Pool::_start()
+		{
+			for( index_t i = 1; i < maxThreads(); ++i )
+				Workers.emplace_back( [this]() { _worker(); } );
+		}
+
+		void Pool::_worker()
+		{
+			std::unique_lock<std::mutex> lock( Lock );
+			while( true )
+			{
+				Batch* batch{ nullptr };
+				Wake.wait( lock, [this, &batch]() {
+					for( auto pending : Pending )
+					{
+						if( pending->Helpers < pending->MaxHelpers && pending->Next < pending->NumTasks )
+						{
+							batch = pending;
+							return true;
+						}
+					}
+					return Stop; } );
+				if( batch == nullptr )
+					return;
+
+				++batch->Helpers;
+				lock.unlock();
+				_work( *batch );
+				lock.lock();
+				if( --batch->Helpers == 0 )
+					Finished.notify_all();
+			}
+		}
+
+		void Pool::_work( Batch& batch ) noexcept
+		{
+			for( auto num = batch.Next++; num < batch.NumTasks; num = batch.Next++ )
+				( *batch.Task )( num );
+		}
+	}
+}
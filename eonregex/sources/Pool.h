@@ -0,0 +1,75 @@
+#pragma once
+
+#include "../RxDefs.h"
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <condition_variable>
+
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// The 'eon' namespace encloses all public functionality
+//
+namespace eon
+{
+	///////////////////////////////////////////////////////////////////////////
+	//
+	// The 'eon::rx' namespace enclosed special elements for Eon regular
+	// expressions
+	//
+	namespace rx
+	{
+		// Process-wide pool of worker threads, for [eon::regex::findAllParallel]
+		// The threads are started the first time the pool is used, and wait
+		// for work until the process ends.
+		class Pool
+		{
+		public:
+			Pool() = default;
+			Pool( const Pool& ) = delete;
+			Pool( Pool&& ) = delete;
+			~Pool();
+
+			Pool& operator=( const Pool& ) = delete;
+			Pool& operator=( Pool&& ) = delete;
+
+			// Get the pool for the process
+			static Pool& instance();
+
+			// Get max number of threads for a single 'run' (the workers and
+			// the calling thread)
+			index_t maxThreads() const noexcept;
+
+			// Call 'task' for each number from 0 to 'num_tasks', on up to
+			// 'num_threads' threads (including the calling thread), and
+			// return when all are done
+			// Tasks are handed out in order, but may finish in any order.
+			// NOTE: 'task' must not throw!
+			void run( index_t num_tasks, index_t num_threads, const std::function<void( index_t )>& task );
+
+		private:
+			struct Batch
+			{
+				const std::function<void( index_t )>* Task{ nullptr };
+				index_t NumTasks{ 0 };
+				index_t MaxHelpers{ 0 };
+				index_t Helpers{ 0 };					// Guarded by 'Lock'
+				std::atomic<index_t> Next{ 0 };
+			};
+
+			void _start();
+			void _worker();
+			static void _work( Batch& batch ) noexcept;
+
+		private:
+			std::mutex Lock;
+			std::condition_variable Wake, Finished;
+			std::vector<Batch*> Pending;
+			std::vector<std::thread> Workers;
+			bool Stop{ false };
+		};
+	}
+}
@@ -0,0 +1,849 @@
+#include "../Program.h"
+#include "../Node.h"
+#include "../CharGroup.h"
+#include "Dfa.h"
+#include <atomic>
+#include <cstring>
+#include <algorithm>
+
+
+namespace eon
+{
+	namespace rx
+	{
+		// Source of unique program identities
+		static std::atomic<uint64_t> Serials{ 0 };
+
+		// Get iterator for slot position 'slot', using 'source' for source
+		// details
+		static inline string_iterator _iterator( const string_iterator& source, const SlotPos& slot ) noexcept {
+			return string_iterator( source, slot.Byte, slot.Char ); }
+
+		// Get iterator for byte position 'byte', at or after 'pos'
+		static inline string_iterator _advance( const string_iterator& pos, const char* byte ) noexcept
+		{
+			auto num_char = pos.numChar();
+			if( pos.bytesOnly() )
+				num_char += byte - pos.byteData();
+			else
+			{
+				for( auto c = pos.byteData(); c < byte; ++c )
+				{
+					if( ( *c & 0xC0 ) != 0x80 )
+						++num_char;
+				}
+			}
+			return string_iterator( pos, byte, num_char );
+		}
+
+		// Find 'literal' from byte position 'pos' to 'end'
+		// Returns nullptr if not found.
+		static const char* _find( const std::string& literal, const char* pos, const char* end ) noexcept
+		{
+			auto size = static_cast<index_t>( literal.size() );
+			for( ; static_cast<index_t>( end - pos ) >= size; ++pos )
+			{
+				pos = static_cast<const char*>( std::memchr( pos, literal[ 0 ], end - pos - size + 1 ) );
+				if( pos == nullptr )
+					return nullptr;
+				if( std::memcmp( pos + 1, literal.data() + 1, size - 1 ) == 0 )
+					return pos;
+			}
+			return nullptr;
+		}
+
+		// Get the first UTF-8 byte of 'c'
+		static inline uint8_t _firstByte( char_t c ) noexcept
+		{
+			if( c < 0x80 )
+				return static_cast<uint8_t>( c );
+			else if( c < 0x800 )
+				return static_cast<uint8_t>( 0xC0 | ( c >> 6 ) );
+			else if( c < 0x10000 )
+				return static_cast<uint8_t>( 0xE0 | ( c >> 12 ) );
+			else
+				return static_cast<uint8_t>( 0xF0 | ( c >> 18 ) );
+		}
+
+
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// The Pike VM
+		// Follows all threads in parallel, one input character at a time, in
+		// priority order so that the match is the same as when backtracking.
+		// Each instruction is visited at most once per character, which
+		// bounds the time to the size of the input times the size of the
+		// program.
+		//
+		class Program::Vm
+		{
+		public:
+			inline Vm( const Program& program, MatchState& state, const char* end )
+				: Prog( program ), State( state ), Scratch( state ), Data( *Scratch ), End( end ) {}
+
+			// Run from instruction 'first' at 'pos'
+			// If 'anchored', the match must start at 'pos'. If 'any', stop at
+			// the first match found, even if a better one could follow.
+			// Returns true if matched, with the slots available from
+			// 'matched()'.
+			bool run( uint32_t first, const string_iterator& pos, bool anchored, bool any );
+
+			inline const SlotPos* matched() const noexcept { return Data.Matched.data(); }
+
+		private:
+			using Threads = MatchState::Vm::Threads;
+			using Job = MatchState::Vm::Job;
+
+			// Follow thread from 'first' to consuming (or match) instructions
+			// and add those to 'threads'
+			void _follow( Threads& threads, uint32_t first, const string_iterator& pos, const Context& context );
+
+			// Check if sub-program starting at 'first' matches at 'pos'
+			inline bool _ahead( uint32_t first, const string_iterator& pos ) {
+				Vm sub( Prog, State, End ); return sub.run( first, pos, true, true ); }
+
+			inline bool _atEnd( const string_iterator& pos ) const noexcept { return !pos || pos.byteData() >= End; }
+
+			// Get context of 'pos'
+			Context _context( const string_iterator& pos, bool at_end ) const noexcept;
+
+		private:
+			const Program& Prog;
+			MatchState& State;
+			MatchState::ScratchVm Scratch;
+			MatchState::Vm& Data;
+			const char* End{ nullptr };
+		};
+
+		bool Program::Vm::run( uint32_t first, const string_iterator& pos, bool anchored, bool any )
+		{
+			auto num_slots = Prog.numSlots();
+			Data.Lists[ 0 ].prepare( Prog.size(), num_slots );
+			Data.Lists[ 1 ].prepare( Prog.size(), num_slots );
+			if( Data.Slots.size() < num_slots )
+			{
+				Data.Slots.resize( num_slots );
+				Data.Matched.resize( num_slots );
+			}
+			auto cur = &Data.Lists[ 0 ], next = &Data.Lists[ 1 ];
+			cur->clear();
+
+			auto it = pos;
+			bool at_end = _atEnd( it );
+			char_t c = at_end ? NullChr : *it;
+			Context context = _context( it, at_end );
+
+			bool matched{ false };
+			for( bool first_pos = true; ; first_pos = false )
+			{
+				// Nothing in progress, skip ahead to where a match can start
+				if( !anchored && !matched && !at_end && cur->NumThreads == 0 && Prog.skips() )
+				{
+					auto skipped = it;
+					if( !Prog.skip( skipped, End ) )
+						return false;
+					if( skipped.byteData() != it.byteData() )
+					{
+						it = skipped;
+						c = *it;
+						context = _context( it, false );
+					}
+				}
+
+				// New thread (with the lowest priority) for a match starting here
+				if( !matched && ( first_pos || !anchored ) )
+				{
+					std::fill( Data.Slots.begin(), Data.Slots.begin() + num_slots, SlotPos() );
+					_follow( *cur, first, it, context );
+				}
+				if( cur->NumThreads == 0 && ( matched || anchored ) )
+					break;
+
+				auto next_it = it;
+				if( !at_end )
+					++next_it;
+				bool next_at_end = at_end || _atEnd( next_it );
+				char_t next_c = next_at_end ? NullChr : *next_it;
+				Context next_context;
+				next_context.AtEnd = next_at_end;
+				if( Prog.context() )
+				{
+					next_context.Prev = context.Cur;
+					next_context.Cur = next_at_end ? 0 : Context::details( next_c );
+				}
+
+				next->clear();
+				for( index_t i = 0; i < cur->NumThreads; ++i )
+				{
+					auto pc = cur->Pcs[ i ];
+					auto& instruction = Prog[ pc ];
+					auto slots = cur->Slots.data() + i * num_slots;
+					if( instruction.Op == Instruction::op::match )
+					{
+						// Threads of lower priority are cut off
+						std::copy( slots, slots + num_slots, Data.Matched.begin() );
+						matched = true;
+						if( any )
+							return true;
+						break;
+					}
+					if( !at_end && Prog.consumes( instruction, c ) )
+					{
+						std::copy( slots, slots + num_slots, Data.Slots.begin() );
+						_follow( *next, pc + 1, next_it, next_context );
+					}
+				}
+				if( at_end )
+					break;
+
+				std::swap( cur, next );
+				it = next_it;
+				c = next_c;
+				at_end = next_at_end;
+				context = next_context;
+			}
+			return matched;
+		}
+
+		Context Program::Vm::_context( const string_iterator& pos, bool at_end ) const noexcept
+		{
+			Context context;
+			context.AtEnd = at_end;
+			if( Prog.context() )
+			{
+				context.Prev = Context::details( pos.numByte() > 0 ? *( pos - 1 ) : NullChr );
+				context.Cur = at_end ? 0 : Context::details( *pos );
+				context.Start = pos.numChar() == 0;
+			}
+			return context;
+		}
+
+		void Program::Vm::_follow( Threads& threads, uint32_t first, const string_iterator& pos, const Context& context )
+		{
+			SlotPos here{ pos.byteData(), pos.numChar() };
+			Job job;
+			job.Pc = first;
+			Data.Jobs.push_back( job );
+			while( !Data.Jobs.empty() )
+			{
+				job = Data.Jobs.back();
+				Data.Jobs.pop_back();
+				if( job.Restore )
+				{
+					Data.Slots[ job.Slot ] = job.Old;
+					continue;
+				}
+
+				for( auto pc = job.Pc; !threads.visited( pc ); )
+				{
+					threads.visit( pc );
+					++Data.Steps;
+					auto& instruction = Prog[ pc ];
+					switch( instruction.Op )
+					{
+						case Instruction::op::split:
+						{
+							Job other;
+							other.Pc = instruction.Y;
+							Data.Jobs.push_back( other );
+							pc = instruction.X;
+							continue;
+						}
+						case Instruction::op::jump:
+							pc = instruction.X;
+							continue;
+						case Instruction::op::save:
+						{
+							// Restore when done with this thread, the slot is
+							// shared with threads of lower priority
+							Job restore;
+							restore.Slot = instruction.X;
+							restore.Old = Data.Slots[ instruction.X ];
+							restore.Restore = true;
+							Data.Jobs.push_back( restore );
+							Data.Slots[ instruction.X ] = here;
+							++pc;
+							continue;
+						}
+						case Instruction::op::name:
+							if( !eon::validName( substring( _iterator( pos, Data.Slots[ instruction.X ] ), pos ) ) )
+								break;
+							++pc;
+							continue;
+						case Instruction::op::not_ahead:
+							if( _ahead( instruction.X, pos ) )
+								break;
+							pc = instruction.Y;
+							continue;
+						case Instruction::op::anchor:
+						case Instruction::op::word_end:
+						case Instruction::op::end:
+							if( !Prog.holds( instruction, context ) )
+								break;
+							++pc;
+							continue;
+						default:
+							threads.add( pc, Data.Slots.data(), Prog.numSlots() );
+							break;
+					}
+					break;
+				}
+			}
+		}
+
+
+
+
+		uint8_t Context::details( char_t c ) noexcept
+		{
+			uint8_t details{ 0 };
+			if( c == NullChr )
+				details |= null;
+			else if( c == NewlineChr )
+				details |= newline;
+			if( string::isSeparatorSpace( c ) )
+				details |= space;
+			if( string::isSeparator( c ) )
+				details |= separator;
+			if( string::isPunctuation( c ) )
+				details |= punctuation;
+			return details;
+		}
+
+
+
+
+		Program& Program::operator=( Program&& other ) noexcept
+		{
+			Code = std::move( other.Code );
+			Sets = std::move( other.Sets );
+			Captures = std::move( other.Captures );
+			Groups = std::move( other.Groups );
+			NumSlots = other.NumSlots;
+			Flags = other.Flags;
+			DfaCompatible = other.DfaCompatible;
+			UsesContext = other.UsesContext;
+			Serial = other.Serial;
+			StartAnchored = other.StartAnchored;
+			Prefix = std::move( other.Prefix );
+			Required = std::move( other.Required );
+			FirstBytes = other.FirstBytes;
+			SkipByFirstByte = other.SkipByFirstByte;
+			SetSize = other.SetSize;
+			SetTail = other.SetTail;
+			other.clear();
+			return *this;
+		}
+
+
+		bool Program::compile( const Node& head, Flag flags )
+		{
+			clear();
+			Flags = flags;
+			NumSlots = 2;		// The complete match
+			emit( Instruction( Instruction::op::save, 0 ) );
+			if( !head.compile( *this ) || full() )
+			{
+				clear();
+				return false;
+			}
+			emit( Instruction( Instruction::op::save, 1 ) );
+			emit( Instruction( Instruction::op::match ) );
+
+			DfaCompatible = true;
+			for( auto& instruction : Code )
+			{
+				if( instruction.Op == Instruction::op::not_ahead || instruction.Op == Instruction::op::name )
+					DfaCompatible = false;
+				else if( instruction.Op == Instruction::op::anchor || instruction.Op == Instruction::op::word_end )
+					UsesContext = true;
+			}
+			_analyze( head );
+			Serial = ++Serials;
+			return true;
+		}
+
+		bool Program::addToSet( const Program& program )
+		{
+			if( program.empty() || !program.DfaCompatible || size() + program.size() + 1 > MaxSetSize )
+				return false;
+
+			// The programs are chained by splits, earlier ones having
+			// priority
+			if( Code.empty() )
+			{
+				Flags = program.Flags;
+				DfaCompatible = true;
+				SkipByFirstByte = true;
+				SetTail = emit( Instruction( Instruction::op::jump, 1 ) );
+			}
+			else
+			{
+				at( SetTail ) = Instruction( Instruction::op::split, at( SetTail ).X, pc() );
+				SetTail = emit( Instruction( Instruction::op::jump, pc() + 1 ) );
+			}
+			auto offset = pc();
+			auto set_offset = static_cast<uint32_t>( Sets.size() );
+			Sets.insert( Sets.end(), program.Sets.begin(), program.Sets.end() );
+			for( auto instruction : program.Code )
+			{
+				if( instruction.Op == Instruction::op::split || instruction.Op == Instruction::op::jump )
+				{
+					instruction.X += offset;
+					instruction.Y += offset;
+				}
+				else if( instruction.Op == Instruction::op::set )
+					instruction.X += set_offset;
+				else if( instruction.Op == Instruction::op::match )
+					instruction.X = static_cast<uint32_t>( SetSize );
+				Code.push_back( instruction );
+			}
+			UsesContext = UsesContext || program.UsesContext;
+			if( !program._firstBytes( FirstBytes ) )
+				SkipByFirstByte = false;
+			++SetSize;
+			Serial = ++Serials;
+			return true;
+		}
+
+
+		uint32_t Program::newCapture( name_t name )
+		{
+			// Captures with the same name share a group, the last one to
+			// match is used
+			auto group = static_cast<index_t>( std::find( Groups.begin(), Groups.end(), name ) - Groups.begin() );
+			if( group == Groups.size() )
+				Groups.push_back( name );
+			auto slot = static_cast<uint32_t>( NumSlots );
+			NumSlots += 2;
+			Captures.push_back( { group + 1, slot } );
+			return slot;
+		}
+
+
+		uint32_t Program::emitClass( CharClass char_class )
+		{
+			CharSet set;
+			for( char_t c = 0; c < 256; ++c )
+			{
+				if( _inClass( char_class, c ) )
+					set.addLow( c );
+			}
+
+			// Only ASCII digits are digits, the other classes are Unicode
+			// categories
+			set.Exact = char_class == CharClass::digit;
+			set.Class = char_class;
+			return _emitSet( std::move( set ) );
+		}
+
+		uint32_t Program::emitGroup( const CharGroup& group )
+		{
+			CharSet set;
+			bool icase = Flags & Flag::icase;
+			auto& value = group.value();
+
+			// Case folding below 256 is done the same way as for literal
+			// characters, without involving the locale
+			for( char_t c = 0; c < 256; ++c )
+			{
+				bool in = group.matchChar( c, false ) != value.Negate;
+				if( !in && icase )
+				{
+					auto l = static_cast<char_t>( std::tolower( c ) ), u = static_cast<char_t>( std::toupper( c ) );
+					if( l != u )
+						in = group.matchChar( c == l ? u : l, false ) != value.Negate;
+				}
+				if( in != value.Negate )
+					set.addLow( c );
+			}
+
+			// Plain characters and ranges can be looked up as ranges
+			set.Exact = !icase && value.Special.empty();
+			if( set.Exact )
+			{
+				std::vector<std::pair<char_t, char_t>> ranges;
+				for( auto c : value.Chars )
+				{
+					if( c >= 256 )
+						ranges.push_back( { c, c } );
+				}
+				for( auto& range : value.Ranges )
+				{
+					if( range.second >= 256 )
+						ranges.push_back( { std::max<char_t>( range.first, 256 ), range.second } );
+				}
+				std::sort( ranges.begin(), ranges.end() );
+				for( auto& range : ranges )
+				{
+					if( !set.Ranges.empty() && range.first <= set.Ranges.back().second + 1 )
+						set.Ranges.back().second = std::max( set.Ranges.back().second, range.second );
+					else
+						set.Ranges.push_back( range );
+				}
+				set.Negate = value.Negate;
+			}
+			set.Group = &group;
+			return _emitSet( std::move( set ) );
+		}
+
+
+		bool Program::match( RxData& data, rx::match& result ) const
+		{
+			if( !Prefix.empty() )
+			{
+				auto pos = data.pos().byteData();
+				if( static_cast<index_t>( data.source().end().byteData() - pos ) < Prefix.size()
+					|| std::memcmp( pos, Prefix.data(), Prefix.size() ) != 0 )
+					return false;
+			}
+
+			if( DfaCompatible && Captures.empty() && !( Flags & Flag::no_dfa ) )
+			{
+				string_iterator end;
+				auto found = _dfa( data, true, end );
+				if( found == DfaResult::no_match )
+					return false;
+				else if( found == DfaResult::match )
+				{
+					result.layout( data.pos(), Groups );
+					result.set( 0, data.pos().byteData(), data.pos().numChar(), end.byteData(), end.numChar() );
+					data.pos( end );
+					return true;
+				}
+			}
+
+			Vm vm( *this, data.state(), data.source().end().byteData() );
+			if( !vm.run( 0, data.pos(), true, false ) )
+				return false;
+			_registerCaptures( data, vm.matched(), result );
+			return true;
+		}
+
+		bool Program::search( RxData& data, rx::match& result ) const
+		{
+			auto end = data.source().end().byteData();
+
+			// Only one place to try if anchored at the start
+			if( StartAnchored )
+			{
+				if( data.pos().numChar() > 0 )
+					return false;
+				return match( data, result );
+			}
+
+			// No need to look closer if a required literal is missing
+			if( !Required.empty() && _find( Required, data.pos().byteData(), end ) == nullptr )
+				return false;
+			if( skips() )
+			{
+				auto pos = data.pos();
+				if( !skip( pos, end ) )
+					return false;
+				data.pos( pos );
+			}
+
+			// The DFA can quickly tell if there is a match, but not exactly
+			// where it starts, only where it can start from
+			auto from = data.pos();
+			if( DfaCompatible && !( Flags & Flag::no_dfa ) )
+			{
+				string_iterator match_end;
+				auto found = _dfa( data, false, match_end, &from );
+				if( found == DfaResult::no_match )
+					return false;
+				else if( found == DfaResult::unknown )
+					from = data.pos();
+			}
+
+			Vm vm( *this, data.state(), end );
+			if( !vm.run( 0, from, false, false ) )
+				return false;
+			_registerCaptures( data, vm.matched(), result );
+			return true;
+		}
+
+
+		bool Program::consumes( const Instruction& instruction, char_t c ) const noexcept
+		{
+			switch( instruction.Op )
+			{
+				case Instruction::op::chr:
+					return c == instruction.Char;
+				case Instruction::op::chr_icase:
+					return static_cast<char_t>( std::tolower( c ) ) == instruction.Char;
+				case Instruction::op::any:
+					return true;
+				case Instruction::op::set:
+				{
+					auto& set = Sets[ instruction.X ];
+					if( c < 256 )
+						return set.low( c );
+					if( set.Exact )
+					{
+						auto range = std::upper_bound( set.Ranges.begin(), set.Ranges.end(), c,
+							[]( char_t value, const std::pair<char_t, char_t>& range ) { return value < range.first; } );
+						return ( range != set.Ranges.begin() && c <= ( range - 1 )->second ) != set.Negate;
+					}
+					return set.Group != nullptr ? set.Group->matchChar( c, Flags & Flag::icase ) : _inClass( set.Class, c );
+				}
+				default:
+					return false;
+			}
+		}
+
+		bool Program::holds( const Instruction& instruction, const Context& context ) const noexcept
+		{
+			switch( instruction.Op )
+			{
+				case Instruction::op::anchor:
+				{
+					// End of input cannot be start of anything
+					if( context.AtEnd || ( context.Cur & Context::null ) )
+						return false;
+					auto anchoring = instruction.Anchoring;
+					if( anchoring & Anchor::spaces )
+					{
+						if( !context.Start && !( context.Prev & ( Context::null | Context::space ) ) )
+							return false;
+					}
+					if( anchoring & Anchor::word )
+					{
+						if( context.Start && !( context.Prev & ( Context::null | Context::separator
+							| Context::punctuation ) ) )
+							return false;
+					}
+					if( anchoring & Anchor::line )
+					{
+						if( !context.Start && !( context.Prev & Context::newline ) )
+							return false;
+					}
+					if( anchoring & Anchor::input )
+					{
+						if( !context.Start )
+							return false;
+					}
+					return true;
+				}
+				case Instruction::op::word_end:
+					if( Flags & Flag::bounds )
+						return !( context.Prev & Context::space ) && ( context.AtEnd || ( context.Cur & Context::space ) );
+					else
+						return !( context.Prev & ( Context::separator | Context::punctuation ) )
+							&& ( context.AtEnd || ( context.Cur & ( Context::separator | Context::punctuation ) ) );
+				case Instruction::op::end:
+					return context.AtEnd;
+				default:
+					return true;
+			}
+		}
+
+
+		bool Program::skip( string_iterator& pos, const char* end ) const noexcept
+		{
+			// Byte values only line up with characters in valid UTF-8
+			if( !pos.validUTF8() )
+				return true;
+
+			auto from = pos.byteData();
+			const char* found{ nullptr };
+			if( !Prefix.empty() )
+				found = _find( Prefix, from, end );
+			else
+			{
+				for( auto c = from; c < end; ++c )
+				{
+					if( FirstBytes[ static_cast<uint8_t>( *c ) ] )
+					{
+						found = c;
+						break;
+					}
+				}
+			}
+			if( found == nullptr )
+				return false;
+			if( found != from )
+				pos = _advance( pos, found );
+			return true;
+		}
+
+
+		void Program::_analyze( const Node& head )
+		{
+			if( Flags & Flag::no_prefilter )
+				return;
+
+			// Anchoring and literal prefix, from the single path through the
+			// start of the program
+			uint32_t pc{ 0 };
+			while( Code[ pc ].Op == Instruction::op::save )
+				++pc;
+			StartAnchored = Code[ pc ].Op == Instruction::op::anchor && ( Code[ pc ].Anchoring & Anchor::input );
+			string prefix;
+			for( ; Code[ pc ].Op == Instruction::op::chr || Code[ pc ].Op == Instruction::op::save; ++pc )
+			{
+				if( Code[ pc ].Op == Instruction::op::chr )
+					prefix += Code[ pc ].Char;
+			}
+			Prefix = prefix.stdstr();
+
+			if( !( Flags & Flag::icase ) )
+				Required = head.requiredLiteral().stdstr();
+			if( Required.size() <= Prefix.size() )
+				Required.clear();		// The prefix is checked anyway
+
+			// First bytes, of all consuming instructions that can be reached
+			// without consuming anything
+			// Not possible if a match can be empty, or start with any of a
+			// broad set of characters.
+			SkipByFirstByte = false;
+			FirstBytes.reset();
+			if( !Prefix.empty() || StartAnchored )
+				return;
+			std::vector<bool> visited( Code.size(), false );
+			std::vector<uint32_t> stack{ 0 };
+			while( !stack.empty() )
+			{
+				pc = stack.back();
+				stack.pop_back();
+				if( visited[ pc ] )
+					continue;
+				visited[ pc ] = true;
+				auto& instruction = Code[ pc ];
+				switch( instruction.Op )
+				{
+					case Instruction::op::split:
+						stack.push_back( instruction.Y );
+						stack.push_back( instruction.X );
+						break;
+					case Instruction::op::jump:
+						stack.push_back( instruction.X );
+						break;
+					case Instruction::op::not_ahead:
+						stack.push_back( instruction.Y );
+						break;
+					case Instruction::op::save:
+					case Instruction::op::name:
+					case Instruction::op::anchor:
+					case Instruction::op::word_end:
+					case Instruction::op::end:
+						stack.push_back( pc + 1 );
+						break;
+					case Instruction::op::chr:
+						FirstBytes.set( _firstByte( instruction.Char ) );
+						break;
+					case Instruction::op::chr_icase:
+						if( instruction.Char >= 0x80 )
+							return;
+						FirstBytes.set( static_cast<uint8_t>( std::tolower( static_cast<int>( instruction.Char ) ) ) );
+						FirstBytes.set( static_cast<uint8_t>( std::toupper( static_cast<int>( instruction.Char ) ) ) );
+						break;
+					case Instruction::op::set:
+					{
+						// Small sets of ASCII characters only, such as digits
+						auto& set = Sets[ instruction.X ];
+						if( set.Low[ 2 ] != 0 || set.Low[ 3 ] != 0 || !set.Exact || set.Negate || !set.Ranges.empty()
+							|| std::bitset<64>( set.Low[ 0 ] ).count() + std::bitset<64>( set.Low[ 1 ] ).count() > MaxFirstSet )
+						{
+							FirstBytes.reset();
+							return;
+						}
+						for( char_t c = 0; c < 128; ++c )
+						{
+							if( set.low( c ) )
+								FirstBytes.set( c );
+						}
+						break;
+					}
+					default:
+						FirstBytes.reset();
+						return;
+				}
+			}
+			// A single first byte is a prefix
+			if( FirstBytes.count() == 1 )
+			{
+				for( int byte = 0; byte < 256; ++byte )
+				{
+					if( FirstBytes[ byte ] )
+						Prefix = std::string( 1, static_cast<char>( byte ) );
+				}
+			}
+			else
+				SkipByFirstByte = FirstBytes.any();
+		}
+
+
+		bool Program::_inClass( CharClass char_class, char_t c ) noexcept
+		{
+			switch( char_class )
+			{
+				case CharClass::letter:
+					return string::isLetter( c );
+				case CharClass::not_letter:
+					return !string::isLetter( c );
+				case CharClass::lower:
+					return string::isLetterLowerCase( c );
+				case CharClass::upper:
+					return string::isLetterUpperCase( c );
+				case CharClass::digit:
+					return string::isNumberAsciiDigit( c );
+				case CharClass::not_digit:
+					return !string::isNumberDecimalDigit( c );
+				case CharClass::space:
+					return string::isSpaceChar( c );
+				case CharClass::not_space:
+					return !string::isSpaceChar( c );
+				case CharClass::punctuation:
+					return string::isPunctuation( c );
+				case CharClass::not_punctuation:
+					return !string::isPunctuation( c );
+				case CharClass::word:
+					return string::isWordChar( c );
+				case CharClass::not_word:
+					return !string::isWordChar( c );
+			}
+			return false;
+		}
+
+		uint32_t Program::_emitSet( CharSet&& set )
+		{
+			Sets.push_back( std::move( set ) );
+			return emit( Instruction( Instruction::op::set, static_cast<uint32_t>( Sets.size() - 1 ) ) );
+		}
+
+		bool Program::_firstBytes( std::bitset<256>& bytes ) const noexcept
+		{
+			if( !Prefix.empty() )
+				bytes.set( static_cast<uint8_t>( Prefix[ 0 ] ) );
+			else if( SkipByFirstByte )
+				bytes |= FirstBytes;
+			else
+				return false;
+			return true;
+		}
+
+
+		void Program::_registerCaptures( RxData& data, const SlotPos* slots, rx::match& result ) const
+		{
+			result.layout( data.pos(), Groups );
+			result.set( 0, slots[ 0 ].Byte, slots[ 0 ].Char, slots[ 1 ].Byte, slots[ 1 ].Char );
+			for( auto& capture : Captures )
+			{
+				auto& first = slots[ capture.second ];
+				auto& last = slots[ capture.second + 1 ];
+				if( first.Byte != nullptr && last.Byte != nullptr )
+					result.set( capture.first, first.Byte, first.Char, last.Byte, last.Char );
+			}
+			data.pos( _iterator( data.pos(), slots[ 1 ] ) );
+		}
+
+		DfaResult Program::_dfa( RxData& data, bool anchored, string_iterator& end, string_iterator* start ) const
+		{
+			return data.state().dfa( *this ).run( *this, data.pos(), data.source().end().byteData(), anchored, end,
+				start );
+		}
+	}
+}
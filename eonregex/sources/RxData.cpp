@@ -1,10 +1,20 @@
 #include "../RxData.h"
+#include "../MatchState.h"
 
 
 namespace eon
 {
 	namespace rx
 	{
+		RxData::RxData( const substring& source, Flag flags, MatchState& state ) noexcept
+		{
+			Src = source;
+			Pos = Src.begin();
+			CmpFlags = flags;
+			State = &state;
+			Marker = state.nextMarker();
+		}
+
 		substring RxData::findCapture( name_t name ) const noexcept
 		{
 			if( Captures )
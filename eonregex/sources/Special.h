@@ -33,8 +33,10 @@ namespace eon
 				*static_cast<Node*>( this ) = std::move( other ); return *this; }
 
 		private:
-			inline bool _match( RxData& data, index_t steps ) override {
+			inline bool _match( RxData& data, index_t steps ) const override {
 				return string::isSpaceChar( data() ) ? data.advance() : false; }
+			inline bool _compile( Program& program ) const override {
+				program.emitClass( CharClass::space ); return true; }
 			inline string _strStruct() const override { return "\\s"; }
 			inline index_t _countMinCharsRemaining() noexcept override {
 				return MinCharsRemaining = Quant.minQ() + ( Next ? Next->_countMinCharsRemaining() : 0 ); }
@@ -55,8 +57,10 @@ namespace eon
 				*static_cast<Node*>( this ) = std::move( other ); return *this; }
 
 		private:
-			inline bool _match( RxData& data, index_t steps ) override {
+			inline bool _match( RxData& data, index_t steps ) const override {
 				return data && !string::isSpaceChar( data() ) ? data.advance() : false; }
+			inline bool _compile( Program& program ) const override {
+				program.emitClass( CharClass::not_space ); return true; }
 			inline string _strStruct() const override { return "\\S"; }
 			inline index_t _countMinCharsRemaining() noexcept override {
 				return MinCharsRemaining = Quant.minQ() + ( Next ? Next->_countMinCharsRemaining() : 0 ); }
@@ -80,8 +84,10 @@ namespace eon
 				*static_cast<Node*>( this ) = std::move( other ); return *this; }
 
 		private:
-			inline bool _match( RxData& data, index_t steps ) override {
+			inline bool _match( RxData& data, index_t steps ) const override {
 				return string::isPunctuation( data() ) ? data.advance() : false; }
+			inline bool _compile( Program& program ) const override {
+				program.emitClass( CharClass::punctuation ); return true; }
 			inline string _strStruct() const override { return "\\p"; }
 			inline index_t _countMinCharsRemaining() noexcept override {
 				return MinCharsRemaining = Quant.minQ() + ( Next ? Next->_countMinCharsRemaining() : 0 ); }
@@ -104,8 +110,10 @@ namespace eon
 				noexcept { *static_cast<Node*>( this ) = std::move( other ); return *this; }
 
 		private:
-			inline bool _match( RxData& data, index_t steps ) override {
+			inline bool _match( RxData& data, index_t steps ) const override {
 				return data && !string::isPunctuation( data() ) ? data.advance() : false; }
+			inline bool _compile( Program& program ) const override {
+				program.emitClass( CharClass::not_punctuation ); return true; }
 			inline string _strStruct() const override { return "\\P"; }
 			inline index_t _countMinCharsRemaining() noexcept override {
 				return MinCharsRemaining = Quant.minQ() + ( Next ? Next->_countMinCharsRemaining() : 0 ); }
@@ -33,8 +33,10 @@ namespace eon
 				*static_cast<Node*>( this ) = std::move( other ); return *this; }
 
 		private:
-			inline bool _match( RxData& data, index_t steps ) override {
+			inline bool _match( RxData& data, index_t steps ) const override {
 				return string::isWordChar( data() ) ? data.advance() : false; }
+			inline bool _compile( Program& program ) const override {
+				program.emitClass( CharClass::word ); return true; }
 			inline string _strStruct() const override { return "\\w"; }
 			inline index_t _countMinCharsRemaining() noexcept override {
 				return MinCharsRemaining = Quant.minQ() + ( Next ? Next->_countMinCharsRemaining() : 0 ); }
@@ -57,8 +59,10 @@ namespace eon
 				*static_cast<Node*>( this ) = std::move( other ); return *this; }
 
 		private:
-			inline bool _match( RxData& data, index_t steps ) override {
+			inline bool _match( RxData& data, index_t steps ) const override {
 				return data && !string::isWordChar( data() ) ? data.advance() : false; }
+			inline bool _compile( Program& program ) const override {
+				program.emitClass( CharClass::not_word ); return true; }
 			inline string _strStruct() const override { return "\\W"; }
 			inline index_t _countMinCharsRemaining() noexcept override {
 				return MinCharsRemaining = Quant.minQ() + ( Next ? Next->_countMinCharsRemaining() : 0 ); }
@@ -1,4 +1,6 @@
 #include "Regression.h"
+#include <thread>
+#include <atomic>
 
 
 
@@ -321,6 +323,38 @@ namespace eon
 		WANT_TRUE( expr.match( "*" ) ) << "Didn't match '*'";
 		WANT_FALSE( expr.match( "d" ) ) << "Matched 'd'";
 	}
+	TEST( RegExTest, match_chargroup_ranges )
+	{
+		regex expr;
+		REQUIRE_NO_EXCEPT( expr = R"([a-fα-ωÆ_]+)" ) << "Failed to parse";
+
+		WANT_EQ( "ca", expr.findFirst( "xcay" ).all().stdstr() ) << "Wrong ASCII match";
+		WANT_EQ( "βÆ_γ", expr.findFirst( "ΑβÆ_γΩ" ).all().stdstr() ) << "Wrong unicode match";
+		WANT_FALSE( expr.match( "æ" ) ) << "Matched 'æ'";
+
+		REQUIRE_NO_EXCEPT( expr = R"([^a-fα-ω]+)" ) << "Failed to parse negated";
+		WANT_EQ( "ΑxΩ", expr.findFirst( "aΑxΩβ" ).all().stdstr() ) << "Wrong negated match";
+	}
+	TEST( RegExTest, match_chargroup_icase )
+	{
+		regex expr;
+		REQUIRE_NO_EXCEPT( expr = regex( R"([a-c_]+)", "i" ) ) << "Failed to parse";
+
+		WANT_EQ( "aBc_C", expr.findFirst( "xxaBc_Cd" ).all().stdstr() ) << "Wrong match";
+		WANT_FALSE( expr.match( "D" ) ) << "Matched 'D'";
+	}
+	TEST( RegExTest, match_chargroup_icase_unicode )
+	{
+		// Case folding above Latin-1, on the DFA, the Pike VM, and by
+		// backtracking
+		for( auto flags : { "i", "i!d", "i!p", "i!v" } )
+		{
+			regex expr;
+			REQUIRE_NO_EXCEPT( expr = regex( R"([ω])", flags ) ) << "Failed to parse with \"" << flags << "\"";
+			WANT_EQ( "Ω", expr.findFirst( string( "xΩy" ) ).all().stdstr() ) << "Wrong match with \"" << flags << "\"";
+			WANT_FALSE( expr.match( string( "Ψ" ) ) ) << "Matched 'Ψ' with \"" << flags << "\"";
+		}
+	}
 
 	TEST( RegExTest, match_substring )
 	{
@@ -746,7 +780,303 @@ namespace eon
 		found = rx.findAll( bad );
 		WANT_EQ( 0, found.size() ) << "Found bad";
 	}
+	TEST( FindTests, caller_state )
+	{
+		string str{ "key=alpha; key=beta" };
+		regex rx{ R"(@<key>(\l+)=@<value>(\l+))" };
+		rx::MatchState state;
+		auto found = rx.findAll( str.substr(), state );
+		REQUIRE_EQ( 2, found.size() ) << "Failed to find good";
+		WANT_EQ( "alpha", eon::string( found[ 0 ].group( name_value ) ) ) << "Wrong first value found";
+		WANT_EQ( "beta", eon::string( found[ 1 ].group( name_value ) ) ) << "Wrong second value found";
+		WANT_TRUE( rx.match( substring( "key=gamma" ), state ) ) << "Failed to reuse state";
+	}
+	TEST( FindTests, shared_between_threads )
+	{
+		regex rx{ R"(@<key>(\l+)=@<value>(\d+))" };
+		std::atomic<int> wrong{ 0 };
+		std::vector<std::thread> threads;
+		for( int t = 0; t < 4; ++t )
+		{
+			threads.push_back( std::thread( [&, t]() {
+				for( int i = 0; i < 500; ++i )
+				{
+					string num = string::toString( t * 1000 + i );
+					string str = "x; key=" + num;
+					auto found = rx.findFirst( str );
+					if( !found || found.group( name_value ) != num.substr() )
+						++wrong;
+				} } ) );
+		}
+		for( auto& thread : threads )
+			thread.join();
+		WANT_EQ( 0, wrong.load() ) << "Wrong matches when shared between threads";
+	}
+	TEST( FindTests, literal_prefilter )
+	{
+		string str{ "æøå level=warn; æøå level=error code=17; level=error code=18" };
+		regex prefix{ R"(level=error code=@<code>(\d+))" };
+		auto found = prefix.findAll( str );
+		REQUIRE_EQ( 2, found.size() ) << "Wrong number of matches with prefix";
+		WANT_EQ( "17", eon::string( found[ 0 ].group( name( "code" ) ) ) ) << "Wrong first match with prefix";
+		WANT_EQ( "18", eon::string( found[ 1 ].group( name( "code" ) ) ) ) << "Wrong second match with prefix";
+
+		regex required{ R"(\l+=error code=\d+)" };
+		found = required.findAll( str );
+		REQUIRE_EQ( 2, found.size() ) << "Wrong number of matches with required literal";
+		WANT_EQ( "level=error code=17", eon::string( found[ 0 ].group( name_complete ) ) ) << "Wrong required match";
+		WANT_FALSE( required.findFirst( "level=warn code=17" ) ) << "Matched without required literal";
 
+		regex first_bytes{ R"([ec]\l+=\d+)" };
+		found = first_bytes.findAll( str );
+		REQUIRE_EQ( 2, found.size() ) << "Wrong number of matches with first bytes";
+		WANT_EQ( "code=18", eon::string( found[ 1 ].group( name_complete ) ) ) << "Wrong first bytes match";
+	}
+	TEST( FindTests, start_anchored )
+	{
+		string str{ "abc abc abc" };
+		regex rx{ R"(^abc)" };
+		WANT_EQ( 1, rx.findAll( str ).size() ) << "Anchored expression matched more than once";
+		WANT_FALSE( rx.findFirst( substring( str.begin() + 4, str.end() ) ) ) << "Anchored expression matched inside";
+	}
+	TEST( FindTests, reused_result )
+	{
+		string str{ "x=1 æ=22 y=3" };
+		rx::match result;
+		for( auto flags : { "", "!v" } )
+		{
+			regex pair{ R"(@<key>(\S)=@<value>(\d+))", flags };
+			REQUIRE_TRUE( pair.findFirstInto( substring( str.begin() + 4, str.end() ), result ) ) << "Failed to find";
+			WANT_EQ( "æ", eon::string( result.group( name( "key" ) ) ) ) << "Wrong key";
+			WANT_EQ( "22", eon::string( result.group( name( "value" ) ) ) ) << "Wrong value";
+			WANT_EQ( 3, result.size() ) << "Wrong number of captures";
+
+			// More captures than are stored inside the result
+			regex many{ R"(@<a>(\S)=@<b>(\d) @<c>(\S)=@<d>(\d+) @<e>(\S)=@<f>(\d))", flags };
+			REQUIRE_TRUE( many.matchInto( str, result ) ) << "Failed to match";
+			WANT_EQ( 7, result.size() ) << "Wrong number of captures";
+			WANT_EQ( "22", eon::string( result.group( name( "d" ) ) ) ) << "Wrong inline capture";
+			WANT_EQ( "3", eon::string( result.group( name( "f" ) ) ) ) << "Wrong overflow capture";
+
+			WANT_FALSE( pair.matchInto( "==", result ) ) << "Matched";
+			WANT_FALSE( result ) << "Result not cleared";
+			WANT_EQ( 0, result.size() ) << "Captures left behind";
+		}
+	}
+	TEST( FindTests, parallel )
+	{
+		string str;
+		for( int i = 0; i < 2000; ++i )
+			str += "linje " + string( i ) + ": ærlig id=" + string( i * 7 ) + ( i % 3 == 0 ? " øk\n" : "\n" );
+		regex rx{ R"(id=@<id>(\d+)( øk)?$)", "l" };
+		auto expected = rx.findAll( str );
+		REQUIRE_EQ( 2000, expected.size() ) << "Wrong number of sequential matches";
+		for( index_t threads : { 1, 2, 4 } )
+		{
+			auto found = rx.findAllParallel( str, NewlineChr, threads );
+			REQUIRE_EQ( expected.size(), found.size() ) << "Wrong number of matches, " << threads << " threads";
+			for( index_t i = 0; i < found.size(); ++i )
+			{
+				REQUIRE_EQ( expected[ i ].all().begin().numChar(), found[ i ].all().begin().numChar() )
+					<< "Wrong position of match " << i << ", " << threads << " threads";
+				REQUIRE_EQ( string( expected[ i ].group( name( "id" ) ) ), string( found[ i ].group( name( "id" ) ) ) )
+					<< "Wrong capture of match " << i << ", " << threads << " threads";
+			}
+		}
+		WANT_EQ( 3, regex( R"(\d+)" ).findAllParallel( "1 22\n333" ).size() ) << "Wrong matches in small input";
+		WANT_TRUE( regex( R"(\d+)" ).findAllParallel( "" ).empty() ) << "Matched empty input";
+	}
+
+
+	TEST( SetTests, match )
+	{
+		regexset set{ R"(GET /\w+)", R"(\U+ /api)", R"(POST)", R"(\U+ /\l+/\d+$)" };
+		REQUIRE_EQ( 4, set.size() ) << "Wrong number of patterns";
+		WANT_TRUE( ( std::vector<index_t>{ 0, 1, 3 } == set.match( "GET /api/17" ) ) ) << "Wrong patterns for GET";
+		WANT_TRUE( ( std::vector<index_t>{ 2 } == set.match( "POST /login" ) ) ) << "Wrong patterns for POST";
+		WANT_TRUE( set.match( "PUT" ).empty() ) << "Matched PUT";
+		WANT_TRUE( ( std::vector<index_t>{ 1, 2 } == set.find( "PUT /api POST" ) ) ) << "Wrong patterns found";
+	}
+	TEST( SetTests, longest )
+	{
+		// Tokens, where keywords are also names
+		regexset set{ R"(if)", R"(\l+)", R"(\d+)", R"(\d+\.\d+)", R"(\s+)" };
+		auto hit = set.matchLongest( "if x" );
+		REQUIRE_TRUE( hit ) << "No match for 'if'";
+		WANT_EQ( 0, hit.Pattern ) << "Keyword didn't win tie";
+		WANT_EQ( "if", eon::string( hit.Match ) ) << "Wrong keyword match";
+		hit = set.matchLongest( "iffy" );
+		WANT_EQ( 1, hit.Pattern ) << "Name didn't win on length";
+		WANT_EQ( "iffy", eon::string( hit.Match ) ) << "Wrong name match";
+		hit = set.matchLongest( "3.14 " );
+		WANT_EQ( 3, hit.Pattern ) << "Decimal didn't win on length";
+		WANT_FALSE( set.matchLongest( "+3" ) ) << "Matched operator";
+
+		hit = set.findLongest( "+-*3.14 + 2" );
+		REQUIRE_TRUE( hit ) << "Nothing found";
+		WANT_EQ( 3, hit.Pattern ) << "Wrong pattern found";
+		WANT_EQ( 3, hit.Match.begin().numChar() ) << "Found wrong position";
+		WANT_EQ( "3.14", eon::string( hit.Match ) ) << "Found wrong match";
+	}
+	TEST( SetTests, separate )
+	{
+		// Backreferences cannot be combined, and are matched separately
+		regexset set{ R"(@<q>(['"])\w+@:<q>)", R"('\w+)", R"('\w)" };
+		WANT_TRUE( ( std::vector<index_t>{ 0, 1, 2 } == set.match( "'abc'" ) ) ) << "Wrong patterns";
+		auto hit = set.matchLongest( "'abc'" );
+		WANT_EQ( 0, hit.Pattern ) << "Wrong longest pattern";
+		WANT_EQ( "'abc'", eon::string( hit.Match ) ) << "Wrong longest match";
+
+		regexset copy{ set };
+		WANT_TRUE( ( std::vector<index_t>{ 1, 2 } == copy.match( "'abc" ) ) ) << "Wrong patterns for copy";
+	}
+
+	TEST( StreamTests, chunks )
+	{
+		// Feed 1, 2, or 3 bytes at a time, splitting both characters and
+		// the prefix
+		string input{ "x 3.14 ÆØÅ+ 17.0 zzz 2.718 .5 ÆØÅ 1." };
+		regex expr{ R"((\d+\.\d+)|ÆØÅ)" };
+		auto expected = expr.findAll( input );
+		REQUIRE_EQ( 5, expected.size() ) << "Wrong number of matches from findAll";
+
+		std::vector<regexstream::found> found;
+		std::vector<string> matched;
+		regexstream stream{ expr };
+		index_t pos{ 0 }, step{ 0 };
+		auto& bytes = input.stdstr();
+		auto num = stream.scan(
+			[&]( char* buffer, index_t size ) {
+				auto num = std::min( std::min( size, step++ % 3 + 1 ), bytes.size() - pos );
+				memcpy( buffer, bytes.c_str() + pos, num ); pos += num; return num; },
+			[&]( const regexstream::found& match ) {
+				found.push_back( match ); matched.push_back( string( match.Match.all() ) ); return true; } );
+		REQUIRE_EQ( expected.size(), num ) << "Wrong number of matches";
+		for( index_t i = 0; i < num; ++i )
+		{
+			auto all = expected[ i ].all();
+			WANT_EQ( string( all ).stdstr(), matched[ i ].stdstr() ) << "Wrong match #" << i;
+			WANT_EQ( all.begin().byteData() - bytes.c_str(), found[ i ].StartByte ) << "Wrong start byte #" << i;
+			WANT_EQ( all.end().byteData() - bytes.c_str(), found[ i ].EndByte ) << "Wrong end byte #" << i;
+			WANT_EQ( all.begin().numChar(), found[ i ].StartChar ) << "Wrong start char #" << i;
+			WANT_EQ( all.end().numChar(), found[ i ].EndChar ) << "Wrong end char #" << i;
+		}
+	}
+	TEST( StreamTests, source )
+	{
+		string input;
+		for( int i = 0; i < 20000; ++i )
+			input += "line " + string( i ) + ( i % 1000 == 0 ? " ERROR: failed\n" : " ok\n" );
+		source::String src{ "test", string( input ) };
+		regex expr{ R"(ERROR: \l+$)", "l" };
+		regexstream stream{ expr };
+		std::vector<index_t> found;
+		auto num = stream.scan( src, [&]( const regexstream::found& match ) {
+			found.push_back( match.StartByte ); return true; } );
+		REQUIRE_EQ( 20, num ) << "Wrong number of matches";
+		auto expected = expr.findAll( input );
+		REQUIRE_EQ( 20, expected.size() ) << "Wrong number of matches from findAll";
+		for( index_t i = 0; i < num; ++i )
+			WANT_EQ( expected[ i ].all().begin().byteData() - input.stdstr().c_str(), found[ i ] ) << "Wrong position #" << i;
+
+		num = stream.scan( src, [&]( const regexstream::found& ) { return false; } );
+		WANT_EQ( 1, num ) << "Didn't stop";
+	}
+	TEST( StreamTests, invalid )
+	{
+		regex expr{ R"(@<q>(['"])\w+@:<q>)" };
+		WANT_EXCEPT( regexstream{ expr }, rx::InvalidExpression ) << "Streamed backreference";
+	}
+	TEST( CacheTests, cached )
+	{
+		regex::clearCache();
+		auto first = regex::cached( R"(\d+)", "i" );
+		auto second = regex::cached( R"(\d+)", "i" );
+		auto other = regex::cached( R"(\d+)" );
+		auto stats = regex::cacheStats();
+		WANT_EQ( 1, stats.Hits ) << "Wrong number of hits";
+		WANT_EQ( 2, stats.Misses ) << "Wrong number of misses";
+		WANT_EQ( 2, stats.Size ) << "Wrong cache size";
+		WANT_EQ( "\\d+", second.str() ) << "Wrong pattern";
+		WANT_EQ( "i", second.flags() ) << "Wrong flags";
+		WANT_EQ( "42", string( second.findFirst( "a42b" ).all() ) ) << "Cached expression doesn't work";
+
+		// Expressions from the cache remain valid when dropped from it
+		regex::clearCache();
+		WANT_EQ( 0, regex::cacheStats().Size ) << "Cache not cleared";
+		WANT_TRUE( first.match( "17" ) ) << "Dropped expression doesn't work";
+
+		WANT_EXCEPT( regex::cached( "(a" ), rx::InvalidExpression ) << "Invalid expression accepted";
+		WANT_EQ( 0, regex::cacheStats().Size ) << "Invalid expression cached";
+	}
+	TEST( CacheTests, lru )
+	{
+		regex::clearCache();
+		regex::cacheCapacity( 2 );
+		regex::cached( "a" );
+		regex::cached( "b" );
+		regex::cached( "a" );
+		regex::cached( "c" );		// Drops "b", the least recently used
+		regex::cached( "a" );
+		regex::cached( "b" );
+		auto stats = regex::cacheStats();
+		regex::cacheCapacity( regex::DefCacheCapacity );
+		WANT_EQ( 2, stats.Hits ) << "Wrong number of hits";
+		WANT_EQ( 4, stats.Misses ) << "Wrong number of misses";
+		WANT_EQ( 2, stats.Size ) << "Wrong cache size";
+	}
+	TEST( CacheTests, threads )
+	{
+		regex::clearCache();
+		std::vector<std::thread> threads;
+		std::atomic<index_t> matched{ 0 };
+		for( int t = 0; t < 4; ++t )
+		{
+			threads.emplace_back( [&matched, t]() {
+				for( int i = 0; i < 1000; ++i )
+				{
+					if( regex::cached( "x" + string( i % 50 ) + R"(\d)" ).match( "x" + string( i % 50 ) + string( t ) ) )
+						++matched;
+				} } );
+		}
+		for( auto& thread : threads )
+			thread.join();
+		auto stats = regex::cacheStats();
+		WANT_EQ( 4000, matched ) << "Wrong number of matches";
+		WANT_EQ( 4000, stats.Hits + stats.Misses ) << "Wrong number of lookups";
+		WANT_EQ( 50, stats.Size ) << "Wrong cache size";
+	}
+
+	TEST( ReplaceTests, groups )
+	{
+		regex expr{ R"(@<key>(\w+)=@<value>(\w+))" };
+		WANT_EQ( "b:a, d:c;", expr.replace( "a=b, c=d;", "@:<value>:@:<key>" ) ) << "Wrong named replacement";
+		WANT_EQ( "[a=b|a|b], [c=d|c|d];", expr.replace( "a=b, c=d;", "[@:0|@:1|@:2]" ) ) << "Wrong numbered replacement";
+		WANT_EQ( "@ @: @x, @ @: @x;", expr.replace( "a=b, c=d;", "@@ @: @x" ) ) << "Wrong literal '@'";
+		WANT_EQ( "no match", expr.replace( "no match", "x" ) ) << "Replaced without match";
+
+		WANT_EXCEPT( expr.replace( "a=b", "@:<other>" ), rx::InvalidExpression ) << "Unknown group accepted";
+		WANT_EXCEPT( expr.replace( "a=b", "@:3" ), rx::InvalidExpression ) << "Unknown group number accepted";
+	}
+	TEST( ReplaceTests, unicode )
+	{
+		regex expr{ R"(ø+)" };
+		auto replaced = expr.replace( "bøøk, βøø", "ö" );
+		WANT_EQ( "bök, βö", replaced ) << "Wrong replacement";
+		WANT_EQ( 7, replaced.numChars() ) << "Wrong number of characters";
+	}
+	TEST( ReplaceTests, empty )
+	{
+		regex expr{ R"(x*)" };
+		WANT_EQ( "-a--b", expr.replace( "axxb", "-" ) ) << "Wrong replacement of empty matches";
+	}
+	TEST( ReplaceTests, callback )
+	{
+		regex expr{ R"(@<num>(\d+))" };
+		auto doubled = expr.replace( "1 and 21", []( const rx::match& found, std::string& output ) {
+			output += std::to_string( 2 * std::stoi( found.group( name( "num" ) ).stdstr() ) ); } );
+		WANT_EQ( "2 and 42", doubled ) << "Wrong callback replacement";
+	}
 
 	// Common function used by optimize tests
 	void OptimizeTests::optimizeTest( regex& plain, regex& optimized, string& good_str, string& bad_str, int iterations )
@@ -831,8 +1161,9 @@ namespace eon
 	}	//*/
 	TEST( OptimizeTests, removeSuperfluousGroups )	// CONSIDERABLE IMPROVEMENT! FINT OUT WHY!
 	{
-		regex plain{ R"(((A)|(B))*)", "!g" };
-		regex optimized( R"(((A)|(B))*)" );
+		// Graph optimizations only matter when backtracking
+		regex plain{ R"(((A)|(B))*)", "!gv" };
+		regex optimized( R"(((A)|(B))*)", "!v" );
 		string good{ "AAAABBBBABABABBBBBBCCC" };
 		string bad{ "CCCCCCCCCCCCCCCCCCCCCCCCCCBABABA" };
 		optimizeTest( plain, optimized, good, bad );
@@ -855,8 +1186,9 @@ namespace eon
 	}	//*/
 	TEST( OptimizeTests, failfast_fixed_end )		// SIGNIFICANT IMPROVEMENT!
 	{
-		regex plain{ R"(.*A$)" };
-		regex optimized( R"(.*A$)", "f" );
+		// Graph optimizations only matter when backtracking
+		regex plain{ R"(.*A$)", "!v" };
+		regex optimized( R"(.*A$)", "f!v" );
 		string good{ "ACCCCCCCCCCCCCCCCCCCCCCCCCCCA" };
 		string bad{ "ACCCCCCCCCCCCCCCCCCCCCCCCCCB" };
 		optimizeTest( plain, optimized, good, bad );
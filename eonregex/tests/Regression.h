@@ -2,6 +2,9 @@
 
 #include <eontest/Test.h>
 #include <eonregex/RegEx.h>
+#include <eonregex/RegExSet.h>
+#include <eonregex/RegExStream.h>
+#include <eonsource/String.h>
 
 
 namespace eon
@@ -10,6 +13,10 @@ namespace eon
 	class MatchOrTest : public eontest::EonTest {};
 	class MiscTests : public eontest::EonTest {};
 	class FindTests : public eontest::EonTest {};
+	class SetTests : public eontest::EonTest {};
+	class StreamTests : public eontest::EonTest {};
+	class CacheTests : public eontest::EonTest {};
+	class ReplaceTests : public eontest::EonTest {};
 	class OptimizeTests : public eontest::EonTest
 	{
 	public:
@@ -212,6 +212,31 @@ namespace eon
 				File( string( ( sandboxDir() / "source.txt" ).string() ) ).bytes(
 					Pos( 4, 4, 0, 4 ), Pos( 7, 7, 0, 7 ) ) ) );
 
+		index_t File::read( index_t byte_pos, char* buffer, index_t size ) noexcept
+		{
+			if( byte_pos >= NumBytes )
+				return 0;
+			if( Data.fail() )
+				Data.clear();
+			if( byte_pos != static_cast<index_t>( Data.tellg() ) )
+			{
+				Data.seekg( byte_pos, std::ifstream::beg );
+				if( Data.fail() )
+					return 0;
+			}
+			Data.read( buffer, std::min( size, NumBytes - byte_pos ) );
+			return static_cast<index_t>( Data.gcount() );
+		}
+		EON_TEST_3STEP_SANDBOX( File, read, beyond_end,
+			saveFile( "source.txt", "one" ),
+			char buffer[ 4 ],
+			EON_EQ( 0, File( string( ( sandboxDir() / "source.txt" ).string() ) ).read( 3, buffer, 4 ) ) );
+		EON_TEST_4STEP_SANDBOX( File, read, partial,
+			saveFile( "source.txt", "one two three" ),
+			char buffer[ 8 ],
+			auto num = File( string( ( sandboxDir() / "source.txt" ).string() ) ).read( 8, buffer, 8 ),
+			EON_EQ( "three", std::string( buffer, num ) ) );
+
 
 
 
@@ -77,6 +77,11 @@ namespace eon::source
 		// Returns empty if not a valid area or the entire area is outside the scope of the source!
 		std::string bytes( const Pos& start, const Pos& end ) noexcept override;
 
+		// Read up to 'size' bytes, from byte position 'byte_pos', into
+		// 'buffer'
+		// Returns number of bytes read, 0 if at or beyond source end!
+		index_t read( index_t byte_pos, char* buffer, index_t size ) noexcept override;
+
 
 
 
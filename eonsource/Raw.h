@@ -78,6 +78,11 @@ namespace eon::source
 		// Returns -1 if at or beyond source end!
 		virtual int byte( index_t pos ) noexcept = 0;
 
+		// Get the source bytes, if held in contiguous memory (as for
+		// [eon::source::String]) so they can be read directly.
+		// Returns nullptr if not!
+		virtual const char* data() const noexcept { return nullptr; }
+
 		// Convert the specified portion of 'this' source into a string value.
 		// The returned string will be empty if the portion is invalid or
 		// entirely outside the scope of the source.
@@ -88,6 +93,13 @@ namespace eon::source
 		// or entirely outside the scope of the source.
 		virtual std::string bytes( const Pos& start, const Pos& end ) noexcept = 0;
 
+		// Read up to 'size' bytes, from byte position 'byte_pos', into
+		// 'buffer'. Much faster than [bytes] when reading large portions.
+		// Returns number of bytes read, 0 if at or beyond source end!
+		virtual index_t read( index_t byte_pos, char* buffer, index_t size ) noexcept {
+			index_t num{ 0 }; for( int b = 0; num < size && ( b = byte( byte_pos + num ) ) >= 0; ++num )
+				buffer[ num ] = static_cast<char>( b ); return num; }
+
 
 	protected:
 
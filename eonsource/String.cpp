@@ -1,4 +1,5 @@
 #include "String.h"
+#include <cstring>
 
 
 namespace eon
@@ -109,6 +110,22 @@ namespace eon
 		EON_TEST( String, bytes, non_empty,
 			EON_EQ( "two", String( "test", "one two three" ).bytes( Pos( 4, 4, 0, 4 ), Pos( 7, 7, 0, 7 ) ) ) );
 
+		index_t String::read( index_t byte_pos, char* buffer, index_t size ) noexcept
+		{
+			if( byte_pos >= Data.numBytes() )
+				return 0;
+			auto num = std::min( size, Data.numBytes() - byte_pos );
+			std::memcpy( buffer, Data.c_str() + byte_pos, num );
+			return num;
+		}
+		EON_TEST_2STEP( String, read, beyond_end,
+			char buffer[ 4 ],
+			EON_EQ( 0, String( "test", "one" ).read( 3, buffer, 4 ) ) );
+		EON_TEST_3STEP( String, read, partial,
+			char buffer[ 8 ],
+			auto num = String( "test", "one two three" ).read( 8, buffer, 8 ),
+			EON_EQ( "three", std::string( buffer, num ) ) );
+
 
 
 
@@ -86,6 +86,9 @@ namespace eon
 			// Returns -1 if at or beyond source end!
 			inline int byte( index_t pos ) noexcept override { return pos < Data.numBytes() ? Data.byte( pos ) : -1; }
 
+			// Get the source bytes
+			inline const char* data() const noexcept override { return Data.c_str(); }
+
 			// Get string at specified area.
 			// Returns empty string if not a valid area or the entire area is
 			// outside the scope of the source!
@@ -95,6 +98,11 @@ namespace eon
 			// Returns empty if not a valid area or the entire area is outside the scope of the source!
 			std::string bytes( const Pos& start, const Pos& end ) noexcept override;
 
+			// Read up to 'size' bytes, from byte position 'byte_pos', into
+			// 'buffer'
+			// Returns number of bytes read, 0 if at or beyond source end!
+			index_t read( index_t byte_pos, char* buffer, index_t size ) noexcept override;
+
 
 
 
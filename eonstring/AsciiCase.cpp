@@ -0,0 +1,267 @@
+#include "AsciiCase.h"
+#include <eoninlinetest/InlineTest.h>
+#include <string>
+
+
+namespace eon
+{
+	///////////////////////////////////////////////////////////////////////////
+	//
+	// Scalar
+	//
+
+	static inline char _lower( char c ) noexcept { return static_cast<unsigned char>( c - 'A' ) < 26 ? c | 0x20 : c; }
+	static inline char _upper( char c ) noexcept { return static_cast<unsigned char>( c - 'a' ) < 26 ? c & ~0x20 : c; }
+
+	static void _caseScalar( char* bytes, index_t size, bool upper ) noexcept
+	{
+		auto end = bytes + size;
+		if( upper )
+		{
+			for( auto c = bytes; c != end; ++c )
+				*c = _upper( *c );
+		}
+		else
+		{
+			for( auto c = bytes; c != end; ++c )
+				*c = _lower( *c );
+		}
+	}
+	EON_NO_TEST( ascii, _caseScalar );
+
+	static int _compareScalar( const char* a, const char* b, index_t size, index_t offset ) noexcept
+	{
+		for( index_t i = 0; i < size; ++i )
+		{
+			auto lw_a = _lower( a[ i ] ), lw_b = _lower( b[ i ] );
+			if( lw_a != lw_b )
+			{
+				auto equal = static_cast<int>( offset + i + 1 );
+				return static_cast<unsigned char>( lw_a ) < static_cast<unsigned char>( lw_b ) ? -equal : equal;
+			}
+		}
+		return 0;
+	}
+	EON_NO_TEST( ascii, _compareScalar );
+
+
+
+
+	///////////////////////////////////////////////////////////////////////////
+	//
+	// SIMD
+	//
+	// A byte is in the range ['first', 'first' + 26) if it is less than
+	// -128 + 26 as a signed byte after adding 128 - 'first'. The case bit
+	// (0x20) is then flipped for the bytes in range.
+	//
+
+#ifdef EON_X86
+	EON_TARGET_SSE2 static index_t _caseSse2( char* bytes, index_t size, bool upper ) noexcept
+	{
+		auto shift = _mm_set1_epi8( static_cast<char>( 128 - ( upper ? 'a' : 'A' ) ) );
+		auto limit = _mm_set1_epi8( -128 + 26 );
+		auto flip = _mm_set1_epi8( 0x20 );
+		index_t done{ 0 };
+		for( ; size - done >= 16; done += 16 )
+		{
+			auto pos = reinterpret_cast<__m128i*>( bytes + done );
+			auto value = _mm_loadu_si128( pos );
+			auto letters = _mm_cmplt_epi8( _mm_add_epi8( value, shift ), limit );
+			_mm_storeu_si128( pos, _mm_xor_si128( value, _mm_and_si128( letters, flip ) ) );
+		}
+		return done;
+	}
+	EON_NO_TEST( ascii, _caseSse2 );
+
+	EON_TARGET_AVX2 static index_t _caseAvx2( char* bytes, index_t size, bool upper ) noexcept
+	{
+		auto shift = _mm256_set1_epi8( static_cast<char>( 128 - ( upper ? 'a' : 'A' ) ) );
+		auto limit = _mm256_set1_epi8( -128 + 26 );
+		auto flip = _mm256_set1_epi8( 0x20 );
+		index_t done{ 0 };
+		for( ; size - done >= 32; done += 32 )
+		{
+			auto pos = reinterpret_cast<__m256i*>( bytes + done );
+			auto value = _mm256_loadu_si256( pos );
+			auto letters = _mm256_cmpgt_epi8( limit, _mm256_add_epi8( value, shift ) );
+			_mm256_storeu_si256( pos, _mm256_xor_si256( value, _mm256_and_si256( letters, flip ) ) );
+		}
+		return done;
+	}
+	EON_NO_TEST( ascii, _caseAvx2 );
+
+	// Compare 'size' bytes, returns number of leading bytes that are equal when folded.
+	EON_TARGET_SSE2 static index_t _sameSse2( const char* a, const char* b, index_t size ) noexcept
+	{
+		auto shift = _mm_set1_epi8( static_cast<char>( 128 - 'A' ) );
+		auto limit = _mm_set1_epi8( -128 + 26 );
+		auto flip = _mm_set1_epi8( 0x20 );
+		index_t done{ 0 };
+		for( ; size - done >= 16; done += 16 )
+		{
+			auto value_a = _mm_loadu_si128( reinterpret_cast<const __m128i*>( a + done ) );
+			auto value_b = _mm_loadu_si128( reinterpret_cast<const __m128i*>( b + done ) );
+			value_a = _mm_or_si128( value_a, _mm_and_si128( _mm_cmplt_epi8( _mm_add_epi8( value_a, shift ), limit ), flip ) );
+			value_b = _mm_or_si128( value_b, _mm_and_si128( _mm_cmplt_epi8( _mm_add_epi8( value_b, shift ), limit ), flip ) );
+			auto same = static_cast<uint32_t>( _mm_movemask_epi8( _mm_cmpeq_epi8( value_a, value_b ) ) );
+			if( same != 0xFFFF )
+				return done + lowestBit( ~same );
+		}
+		return done;
+	}
+	EON_NO_TEST( ascii, _sameSse2 );
+
+	EON_TARGET_AVX2 static index_t _sameAvx2( const char* a, const char* b, index_t size ) noexcept
+	{
+		auto shift = _mm256_set1_epi8( static_cast<char>( 128 - 'A' ) );
+		auto limit = _mm256_set1_epi8( -128 + 26 );
+		auto flip = _mm256_set1_epi8( 0x20 );
+		index_t done{ 0 };
+		for( ; size - done >= 32; done += 32 )
+		{
+			auto value_a = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( a + done ) );
+			auto value_b = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( b + done ) );
+			value_a = _mm256_or_si256(
+				value_a, _mm256_and_si256( _mm256_cmpgt_epi8( limit, _mm256_add_epi8( value_a, shift ) ), flip ) );
+			value_b = _mm256_or_si256(
+				value_b, _mm256_and_si256( _mm256_cmpgt_epi8( limit, _mm256_add_epi8( value_b, shift ) ), flip ) );
+			auto same = static_cast<uint32_t>( _mm256_movemask_epi8( _mm256_cmpeq_epi8( value_a, value_b ) ) );
+			if( same != 0xFFFFFFFF )
+				return done + lowestBit( ~same );
+		}
+		return done;
+	}
+	EON_NO_TEST( ascii, _sameAvx2 );
+#endif
+
+
+
+
+	///////////////////////////////////////////////////////////////////////////
+	//
+	// Public
+	//
+
+	static void _case( char* bytes, index_t size, bool upper, simd kernel ) noexcept
+	{
+		index_t done{ 0 };
+#ifdef EON_X86
+		switch( useSimd( kernel ) )
+		{
+			case simd::avx2:
+				done = _caseAvx2( bytes, size, upper );
+				break;
+			case simd::sse2:
+				done = _caseSse2( bytes, size, upper );
+				break;
+			default:
+				break;
+		}
+#endif
+		_caseScalar( bytes + done, size - done, upper );
+	}
+	EON_NO_TEST( ascii, _case );
+
+	void asciiLower( char* bytes, index_t size, simd kernel ) noexcept
+	{
+		_case( bytes, size, false, kernel );
+	}
+#ifdef EON_TEST_MODE
+	// Get a copy of 'str' repeated 'copies' times and transformed using the specified kernel.
+	static std::string _testCase( const char* str, int copies, bool upper, simd kernel )
+	{
+		std::string bytes;
+		for( int i = 0; i < copies; ++i )
+			bytes += str;
+		if( upper )
+			asciiUpper( &bytes[ 0 ], bytes.size(), kernel );
+		else
+			asciiLower( &bytes[ 0 ], bytes.size(), kernel );
+		return bytes;
+	}
+	static const char* TestCaseMixed{ "@AZaz[`{ Hello, World! 09" };
+#endif
+	EON_TEST( ascii, asciiLower, empty,
+		EON_EQ( "", _testCase( "", 1, false, simd::avx2 ) ) );
+	EON_TEST( ascii, asciiLower, scalar,
+		EON_EQ( "@azaz[`{ hello, world! 09", _testCase( TestCaseMixed, 1, false, simd::none ) ) );
+	EON_TEST( ascii, asciiLower, sse2,
+		EON_EQ( _testCase( "@azaz[`{ hello, world! 09", 5, false, simd::none ),
+			_testCase( TestCaseMixed, 5, false, simd::sse2 ) ) );
+	EON_TEST( ascii, asciiLower, avx2,
+		EON_EQ( _testCase( "@azaz[`{ hello, world! 09", 5, false, simd::none ),
+			_testCase( TestCaseMixed, 5, false, simd::avx2 ) ) );
+
+	void asciiUpper( char* bytes, index_t size, simd kernel ) noexcept
+	{
+		_case( bytes, size, true, kernel );
+	}
+	EON_TEST( ascii, asciiUpper, scalar,
+		EON_EQ( "@AZAZ[`{ HELLO, WORLD! 09", _testCase( TestCaseMixed, 1, true, simd::none ) ) );
+	EON_TEST( ascii, asciiUpper, sse2,
+		EON_EQ( _testCase( "@AZAZ[`{ HELLO, WORLD! 09", 5, true, simd::none ),
+			_testCase( TestCaseMixed, 5, true, simd::sse2 ) ) );
+	EON_TEST( ascii, asciiUpper, avx2,
+		EON_EQ( _testCase( "@AZAZ[`{ HELLO, WORLD! 09", 5, true, simd::none ),
+			_testCase( TestCaseMixed, 5, true, simd::avx2 ) ) );
+
+	int asciiCompareICase( const char* a, index_t a_size, const char* b, index_t b_size, simd kernel ) noexcept
+	{
+		auto size = a_size < b_size ? a_size : b_size;
+		index_t done{ 0 };
+#ifdef EON_X86
+		switch( useSimd( kernel ) )
+		{
+			case simd::avx2:
+				done = _sameAvx2( a, b, size );
+				break;
+			case simd::sse2:
+				done = _sameSse2( a, b, size );
+				break;
+			default:
+				break;
+		}
+#endif
+		if( auto cmp = _compareScalar( a + done, b + done, size - done, done ); cmp != 0 )
+			return cmp;
+		if( a_size == b_size )
+			return 0;
+		return a_size < b_size ? -static_cast<int>( size + 1 ) : static_cast<int>( size + 1 );
+	}
+#ifdef EON_TEST_MODE
+	// Compare 'a' and 'b' (both repeated 'copies' times) using the specified kernel.
+	static int _testCompare( const char* a, const char* b, int copies, simd kernel )
+	{
+		std::string bytes_a, bytes_b;
+		for( int i = 0; i < copies; ++i )
+		{
+			bytes_a += a;
+			bytes_b += b;
+		}
+		return asciiCompareICase( bytes_a.c_str(), bytes_a.size(), bytes_b.c_str(), bytes_b.size(), kernel );
+	}
+#endif
+	EON_TEST( ascii, asciiCompareICase, empty_empty,
+		EON_EQ( 0, _testCompare( "", "", 1, simd::avx2 ) ) );
+	EON_TEST( ascii, asciiCompareICase, empty_nonempty,
+		EON_EQ( -1, _testCompare( "", "a", 1, simd::avx2 ) ) );
+	EON_TEST( ascii, asciiCompareICase, eq,
+		EON_EQ( 0, _testCompare( "Hello, World!", "hELLO, wORLD!", 10, simd::none ) ) );
+	EON_TEST( ascii, asciiCompareICase, eq_sse2,
+		EON_EQ( 0, _testCompare( "Hello, World!", "hELLO, wORLD!", 10, simd::sse2 ) ) );
+	EON_TEST( ascii, asciiCompareICase, eq_avx2,
+		EON_EQ( 0, _testCompare( "Hello, World!", "hELLO, wORLD!", 10, simd::avx2 ) ) );
+	EON_TEST( ascii, asciiCompareICase, lt_scalar,
+		EON_EQ( -13, _testCompare( "Hello, World!Hello", "hELLO, wORLD@", 1, simd::none ) ) );
+	EON_TEST( ascii, asciiCompareICase, lt_sse2,
+		EON_EQ( -13, _testCompare( "Hello, World!Hello", "hELLO, wORLD@", 1, simd::sse2 ) ) );
+	EON_TEST( ascii, asciiCompareICase, gt_avx2,
+		EON_EQ( 41, _testCompare( "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNZ", "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmna", 1,
+			simd::avx2 ) ) );
+	EON_TEST( ascii, asciiCompareICase, shorter,
+		EON_EQ( -41, _testCompare( "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMN", "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnX", 1,
+			simd::avx2 ) ) );
+	EON_TEST( ascii, asciiCompareICase, bracket,
+		EON_EQ( -1, _testCompare( "[", "{", 1, simd::none ) ) );
+}
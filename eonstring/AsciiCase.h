@@ -0,0 +1,34 @@
+#pragma once
+#include "Simd.h"
+
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// The 'eon' namespace encloses all public functionality
+//
+namespace eon
+{
+	///////////////////////////////////////////////////////////////////////////
+	//
+	// ASCII Case Kernels
+	//
+	// Case conversion and case-insensitive comparing of pure ASCII bytes,
+	// 16 or 32 bytes at a time when the running CPU supports it (see
+	// [eon::cpuSimd]). Only 'A'-'Z' and 'a'-'z' are affected, so these
+	// must only be used when the locale agrees (see
+	// [eon::locale::asciiCase]).
+	//
+
+	// Transform 'A'-'Z' into 'a'-'z' in place.
+	void asciiLower( char* bytes, index_t size, simd kernel = cpuSimd() ) noexcept;
+
+	// Transform 'a'-'z' into 'A'-'Z' in place.
+	void asciiUpper( char* bytes, index_t size, simd kernel = cpuSimd() ) noexcept;
+
+	// Compare two ASCII byte sequences while ignoring case.
+	// Returns: Same as [eon::strcmp::icase_utf8], zero if equal or number of
+	//          equal characters plus one if different, negative if 'a' is
+	//          less than 'b'.
+	int asciiCompareICase(
+		const char* a, index_t a_size, const char* b, index_t b_size, simd kernel = cpuSimd() ) noexcept;
+}
@@ -1,4 +1,5 @@
 ﻿#include "Compare.h"
+#include "AsciiCase.h"
 #include <eoninlinetest/InlineTest.h>
 #include <cctype>
 
@@ -168,6 +169,14 @@ namespace eon::strcmp
 		const string_iterator& b_start,
 		const string_iterator& b_end ) const noexcept
 	{
+		if( Loc->asciiCase() && a_start.bytesOnly() && a_start.validUTF8() && b_start.bytesOnly() && b_start.validUTF8() )
+		{
+			return asciiCompareICase( a_start.byteData(), a_end.byteData() - a_start.byteData(),
+				b_start.byteData(), b_end.byteData() - b_start.byteData() );
+		}
+		if( a_start.validUTF8() && b_start.validUTF8() )
+			return _compareUtf8( a_start.byteData(), a_end.byteData(), b_start.byteData(), b_end.byteData() );
+
 		string_iterator a_i = a_start;
 		string_iterator b_i = b_start;
 		int equal = 0;
@@ -189,6 +198,37 @@ namespace eon::strcmp
 		else
 			return 0;
 	}
+	int icase_utf8::_compareUtf8( const char* a, const char* a_end, const char* b, const char* b_end ) const noexcept
+	{
+		// Only decode where the bytes differ or aren't ASCII
+		int equal = 0;
+		while( a < a_end && b < b_end )
+		{
+			++equal;
+			if( *a == *b && static_cast<uint8_t>( *a ) < 0x80 )
+			{
+				++a;
+				++b;
+				continue;
+			}
+			char_t cp_a{ 0 }, cp_b{ 0 };
+			a += string_iterator::decodeValidUtf8( a, cp_a );
+			b += string_iterator::decodeValidUtf8( b, cp_b );
+			if( cp_a != cp_b )
+			{
+				auto lw_a = Loc->toLower( static_cast<wchar_t>( cp_a ) );
+				auto lw_b = Loc->toLower( static_cast<wchar_t>( cp_b ) );
+				if( lw_a != lw_b )
+					return lw_a < lw_b ? -equal : equal;
+			}
+		}
+		if( a < a_end )
+			return equal + 1;
+		else if( b < b_end )
+			return -( equal + 1 );
+		else
+			return 0;
+	}
 	EON_TEST( icase_utf8, operator_call, void_void,
 		EON_EQ( 0, icase_utf8::Cmp( string_iterator(), string_iterator(), string_iterator(), string_iterator() ) ) );
 	EON_TEST_2STEP( icase_utf8, operator_call, void_empty,
@@ -221,4 +261,20 @@ namespace eon::strcmp
 		string_iterator a( "abd" ),
 		string_iterator b( "Abc" ),
 		EON_EQ( 3, icase_utf8::Cmp( a, a + 3, b, b + 3 ) ) );
+	EON_TEST_3STEP( icase_utf8, operator_call, long_ASCII,
+		string_iterator a( "The quick brown fox jumps over the lazy dog" ),
+		string_iterator b( "THE QUICK BROWN FOX JUMPS OVER THE LAZY CAT" ),
+		EON_EQ( 41, icase_utf8::Cmp( a, a + 43, b, b + 43 ) ) );
+	EON_TEST_3STEP( icase_utf8, operator_call, UTF8,
+		string_iterator a( u8"Ærlig talt, ÅSE" ),
+		string_iterator b( u8"ærlig talt, åse" ),
+		EON_EQ( 0, icase_utf8::Cmp( a, a + 15, b, b + 15 ) ) );
+	EON_TEST_3STEP( icase_utf8, operator_call, UTF8_lt,
+		string_iterator a( u8"Ærlig talt, ÅSE" ),
+		string_iterator b( u8"ærlig talt, øse" ),
+		EON_EQ( -13, icase_utf8::Cmp( a, a + 15, b, b + 15 ) ) );
+	EON_TEST_3STEP( icase_utf8, operator_call, UTF8_shorter,
+		string_iterator a( u8"Ærlig" ),
+		string_iterator b( u8"ærlig talt" ),
+		EON_EQ( -6, icase_utf8::Cmp( a, a + 5, b, b + 10 ) ) );
 }
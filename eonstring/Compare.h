@@ -110,6 +110,9 @@ namespace eon::strcmp
 			const string_iterator& b_start,
 			const string_iterator& b_end ) const noexcept;
 		static const icase_utf8 Cmp;
+	private:
+		// Compare valid UTF-8 bytes.
+		int _compareUtf8( const char* a, const char* a_end, const char* b, const char* b_end ) const noexcept;
 	private:
 		const eon::locale* Loc{ nullptr };
 	};
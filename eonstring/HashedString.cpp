@@ -0,0 +1,22 @@
+#include "HashedString.h"
+#include <eoninlinetest/InlineTest.h>
+
+
+namespace eon
+{
+	EON_TEST( hashed_string, hashed_string, empty,
+		EON_EQ( string().hash(), hashed_string().hash() ) );
+	EON_TEST( hashed_string, hashed_string, string,
+		EON_EQ( string( "alpha" ).hash(), hashed_string( string( "alpha" ) ).hash() ) );
+	EON_TEST( hashed_string, hashed_string, cstr,
+		EON_EQ( string( "alpha" ), hashed_string( "alpha" ).str() ) );
+
+	EON_TEST( hashed_string, operator_eq, equal,
+		EON_TRUE( hashed_string( "alpha" ) == hashed_string( "alpha" ) ) );
+	EON_TEST( hashed_string, operator_eq, different,
+		EON_FALSE( hashed_string( "alpha" ) == hashed_string( "beta" ) ) );
+	EON_TEST( hashed_string, operator_ne, different,
+		EON_TRUE( hashed_string( "alpha" ) != hashed_string( "beta" ) ) );
+	EON_TEST( hashed_string, operator_lt, basic,
+		EON_TRUE( hashed_string( "alpha" ) < hashed_string( "beta" ) ) );
+}
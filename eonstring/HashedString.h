@@ -0,0 +1,110 @@
+#pragma once
+#include "String.h"
+
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// The 'eon' namespace encloses all public functionality
+//
+namespace eon
+{
+	///////////////////////////////////////////////////////////////////////////
+	//
+	// Eon Hashed String Class - eon::hashed_string
+	//
+	// An immutable [eon::string] that computes its hash value once, on
+	// construction. Use as key in hash tables where the same keys are hashed
+	// over and over again, such as lookup tables that are built once and
+	// then queried with pre-made keys.
+	//
+	class hashed_string
+	{
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Construction
+		//
+	public:
+
+		hashed_string() : Hash( Value.hash() ) {}
+		hashed_string( const hashed_string& ) = default;
+		hashed_string( hashed_string&& ) noexcept = default;
+
+		inline hashed_string( const string& value ) : Value( value ), Hash( Value.hash() ) {}
+		inline hashed_string( string&& value ) noexcept : Value( std::move( value ) ), Hash( Value.hash() ) {}
+		inline hashed_string( const char* value ) : Value( value ), Hash( Value.hash() ) {}
+		inline hashed_string( const std::string& value ) : Value( value ), Hash( Value.hash() ) {}
+
+		~hashed_string() = default;
+
+
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Modifier Methods
+		//
+	public:
+
+		hashed_string& operator=( const hashed_string& ) = default;
+		hashed_string& operator=( hashed_string&& ) noexcept = default;
+
+
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Read-only Methods
+		//
+	public:
+
+		// Get the string.
+		inline const string& str() const noexcept { return Value; }
+		inline operator const string&() const noexcept { return Value; }
+
+		// Get the cached hash value, same as [eon::string::hash] for the string.
+		inline size_t hash() const noexcept { return Hash; }
+
+		// Check if empty.
+		inline bool empty() const noexcept { return Value.empty(); }
+
+
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Comparison
+		//
+		// Different hash values are used to rule out equality without
+		// comparing the strings.
+		//
+	public:
+
+		inline friend bool operator==( const hashed_string& a, const hashed_string& b ) noexcept {
+			return a.Hash == b.Hash && a.Value == b.Value; }
+		inline friend bool operator!=( const hashed_string& a, const hashed_string& b ) noexcept {
+			return a.Hash != b.Hash || a.Value != b.Value; }
+		inline friend bool operator<( const hashed_string& a, const hashed_string& b ) noexcept {
+			return a.Value < b.Value; }
+
+
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Attributes
+		//
+	private:
+		string Value;
+		size_t Hash{ 0 };
+	};
+}
+
+
+namespace std
+{
+	// Allow implicit use of [eon::hashed_string] as key when used in
+	// containers such as 'std::unordered_map' and 'std::unordered_set'.
+	template<>
+	struct hash<::eon::hashed_string> {
+		inline size_t operator()( const ::eon::hashed_string& rhs ) const noexcept { return rhs.hash(); } };
+}
@@ -1,5 +1,9 @@
 ﻿#include "Locale.h"
 #include <eoninlinetest/InlineTest.h>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <memory>
 
 
 namespace eon
@@ -65,6 +69,11 @@ namespace eon
 	EON_TEST( locale, toLower, no_NB_2,
 		EON_EQ( L'å', locale::get().toLower( L'Å' ) ) );
 #endif
+	EON_TEST( locale, toLower, standard_non_BMP,
+		EON_EQ( wchar_t( 0x1F600 ), locale::get().toLower( wchar_t( 0x1F600 ) ) ) );
+
+	EON_TEST( locale, asciiCase, standard,
+		EON_TRUE( locale::get().asciiCase() ) );
 
 
 
@@ -128,5 +137,43 @@ namespace eon
 		Num = &std::use_facet<std::numpunct<wchar_t>>( Loc );
 		CType = &std::use_facet<std::ctype<wchar_t>>( Loc );
 		Money = &std::use_facet<std::moneypunct<wchar_t>>( Loc );
+		LowerCaseTable = _lowerCaseTable( Loc.name(), *CType );
+		LowerCase = LowerCaseTable.get();
+		AsciiCase = _asciiCase();
+	}
+
+	bool locale::_asciiCase() const
+	{
+		for( wchar_t c = 0; c < 0x80; ++c )
+		{
+			auto lower = c >= 'A' && c <= 'Z' ? c + 0x20 : c, upper = c >= 'a' && c <= 'z' ? c - 0x20 : c;
+			if( CType->tolower( c ) != lower || CType->toupper( c ) != upper )
+				return false;
+		}
+		return true;
+	}
+
+	std::shared_ptr<const uint16_t> locale::_lowerCaseTable(
+		const std::string& name, const std::ctype<wchar_t>& ctype )
+	{
+		auto build = [&ctype]() {
+			std::vector<wchar_t> chars( 0xFFFF );
+			for( size_t i = 0; i < chars.size(); ++i )
+				chars[ i ] = static_cast<wchar_t>( i );
+			ctype.tolower( chars.data(), chars.data() + chars.size() );
+			std::shared_ptr<uint16_t> table( new uint16_t[ chars.size() ], std::default_delete<uint16_t[]>() );
+			for( size_t i = 0; i < chars.size(); ++i )
+				table.get()[ i ] = static_cast<uint32_t>( chars[ i ] ) < 0xFFFF ? static_cast<uint16_t>( chars[ i ] ) : 0xFFFF;
+			return std::shared_ptr<const uint16_t>( table ); };
+		if( name == "*" )
+			return build();
+
+		static std::mutex lock;
+		static std::unordered_map<std::string, std::shared_ptr<const uint16_t>> tables;
+		std::lock_guard<std::mutex> guard( lock );
+		auto& table = tables[ name ];
+		if( !table )
+			table = build();
+		return table;
 	}
 }
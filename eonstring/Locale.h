@@ -1,5 +1,6 @@
 #pragma once
 #include <locale>
+#include <memory>
 #include "UniChar.h"
 
 
@@ -130,7 +131,19 @@ namespace eon
 
 		// Get lower-case version of specified character.
 		// Returns the same character if no lower-case version exists!
-		inline wchar_t toLower( wchar_t value ) const { return CType->tolower( value ); }
+		// NOTE: Characters in the Basic Multilingual Plane are looked up in a
+		//       table, built once per locale name (and process).
+		inline wchar_t toLower( wchar_t value ) const {
+			if( static_cast<uint32_t>( value ) < 0xFFFF ) {
+				auto lower = LowerCase[ value ]; if( lower != 0xFFFF ) return static_cast<wchar_t>( lower ); }
+			return CType->tolower( value ); }
+
+		// Check if case transformation of ASCII characters is plain 'A'-'Z'
+		// to/from 'a'-'z', and all other ASCII characters are left alone.
+		// (Not so in Turkish locales, for example.)
+		// If so, ASCII-only strings can be transformed and compared without
+		// looking up each character.
+		inline bool asciiCase() const noexcept { return AsciiCase; }
 
 
 
@@ -180,6 +193,15 @@ namespace eon
 
 		void _set( const std::string& name );
 
+		bool _asciiCase() const;
+
+		// Get lower-case table for the BMP, 0xFFFF for characters that must
+		// be looked up using the facet.
+		// Tables are shared by all locales with the same name, except for
+		// unnamed ("*") locales, which can have any facets.
+		static std::shared_ptr<const uint16_t> _lowerCaseTable(
+			const std::string& name, const std::ctype<wchar_t>& ctype );
+
 
 
 
@@ -196,6 +218,10 @@ namespace eon
 		const std::ctype<wchar_t>* CType{ nullptr };
 		const std::moneypunct<wchar_t>* Money{ nullptr };
 
+		std::shared_ptr<const uint16_t> LowerCaseTable;
+		const uint16_t* LowerCase{ nullptr };
+		bool AsciiCase{ false };
+
 		static thread_local locale CurLocale;
 	};
 }
@@ -9,10 +9,10 @@ namespace eon
 #endif
 
 
+	static std::once_flag DataInit;
 	inline void init()
 	{
-		if( !Data )
-			Data = std::make_unique<NameData>();
+		std::call_once( DataInit, []() { if( !Data ) Data = std::make_unique<NameData>(); } );
 	}
 
 	const string& str( const name_t& name )
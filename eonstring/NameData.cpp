@@ -1,4 +1,6 @@
 #include "NameData.h"
+#include <eoninlinetest/InlineTest.h>
+#include <thread>
 
 
 namespace eon
@@ -6,22 +8,31 @@ namespace eon
 	const string NameData::NullStr;
 
 
+	NameData::~NameData()
+	{
+		auto num_names = NumNames.load();
+		for( uint32_t i = 0; i < num_names; ++i )
+			_slot( i )->load()->~string();
+		for( auto& segment : Segments )
+			delete[] segment.load();
+	}
+
+
 	name_t NameData::name( string&& str ) noexcept
 	{
 		if( !validName( str ) )
 			return no_name;
-		std::scoped_lock<std::mutex> lock( Lock );
-		if( auto found = Lookup.find( &str );
-			found != Lookup.end() )
-		{
-			str.clear();		// For consistency!
-			return found->second;
-		}
-		Names.push_back( new string( std::move( str ) ) );
-		name_t id( Names.size() );
-		Lookup[ Names[ Names.size() - 1 ] ] = id;
-		return id;
+		return _intern( std::move( str ) );
 	}
+	EON_TEST_2STEP( NameData, name, same,
+		NameData data,
+		EON_EQ( data.name( "alpha" ), data.name( "alpha" ) ) );
+	EON_TEST_2STEP( NameData, name, different,
+		NameData data,
+		EON_TRUE( data.name( "alpha" ) != data.name( "beta" ) ) );
+	EON_TEST_2STEP( NameData, name, invalid,
+		NameData data,
+		EON_EQ( no_name, data.name( "not a name" ) ) );
 
 	bool NameData::validName( const string& str ) noexcept
 	{
@@ -41,16 +52,140 @@ namespace eon
 	{
 		if( str.empty() )
 			return no_name;
-		std::scoped_lock<std::mutex> lock( Lock );
-		if( auto found = Lookup.find( &str );
-			found != Lookup.end() )
+		return _intern( std::move( str ) );
+	}
+
+	EON_TEST_2STEP( NameData, str, no_name,
+		NameData data,
+		EON_EQ( string(), data.str( no_name ) ) );
+	EON_TEST_2STEP( NameData, str, unknown,
+		NameData data,
+		EON_EQ( string(), data.str( name_t( 5 ) ) ) );
+#ifdef EON_TEST_MODE
+	// Intern (and resolve) the same 'num_names' names from 'num_threads' threads.
+	// Returns the number of distinct names interned.
+	static uint32_t _testIntern( NameData& data, int num_threads, int num_names )
+	{
+		std::vector<std::thread> threads;
+		for( int t = 0; t < num_threads; ++t )
+		{
+			threads.push_back( std::thread( [&data, num_names]() {
+				for( int i = 0; i < num_names; ++i )
+				{
+					string str( "n" + std::to_string( i ) );
+					if( data.str( data.name( string( str ) ) ) != str )
+						return;
+				} } ) );
+		}
+		for( auto& thread : threads )
+			thread.join();
+		return data.name( "extra" ).value() - 1;
+	}
+#endif
+	EON_TEST_3STEP( NameData, str, across_segments,
+		NameData data,
+		for( int i = 0; i < 3000; ++i ) data.name( string( "n" + std::to_string( i ) ) ),
+		EON_EQ( string( "n2999" ), data.str( name_t( 3000 ) ) ) );
+	EON_TEST_2STEP( NameData, str, threads,
+		NameData data,
+		EON_EQ( 3000u, _testIntern( data, 4, 3000 ) ) );
+
+
+
+
+	NameData::Slot& NameData::_claimSlot( uint32_t index )
+	{
+		uint32_t segment{ 0 }, offset{ 0 };
+		_locate( index, segment, offset );
+		auto seg = Segments[ segment ].load( std::memory_order_acquire );
+		if( seg == nullptr )
+		{
+			auto fresh = new Slot[ static_cast<size_t>( FirstSegmentSize ) << segment ]();
+			if( Segments[ segment ].compare_exchange_strong( seg, fresh, std::memory_order_acq_rel ) )
+				seg = fresh;
+			else
+				delete[] fresh;		// Another thread got there first, 'seg' is now theirs
+		}
+		return seg[ offset ];
+	}
+
+	name_t NameData::_intern( string&& str )
+	{
+		auto hash = str.hash();
+		auto& shard = _shard( hash );
+		{
+			std::shared_lock<std::shared_mutex> lock( shard.Lock );
+			if( auto found = _find( shard, str, hash ); found != no_name )
+			{
+				str.clear();		// For consistency!
+				return found;
+			}
+		}
+
+		std::unique_lock<std::shared_mutex> lock( shard.Lock );
+		if( auto found = _find( shard, str, hash ); found != no_name )
 		{
 			str.clear();		// For consistency!
-			return found->second;
+			return found;
 		}
-		Names.push_back( new string( std::move( str ) ) );
-		name_t id( Names.size() );
-		Lookup[ Names[ Names.size() - 1 ] ] = id;
+		auto index = NumNames.fetch_add( 1, std::memory_order_relaxed );
+		_claimSlot( index ).store( _store( std::move( str ) ), std::memory_order_release );
+		name_t id( index + 1 );
+		_insert( shard, hash, id );
 		return id;
 	}
+
+	const string* NameData::_store( string&& str )
+	{
+		std::scoped_lock<std::mutex> lock( ArenaLock );
+		if( ArenaUsed + sizeof( string ) > ArenaChunkSize )
+		{
+			Arena.push_back( std::unique_ptr<char[]>( new char[ ArenaChunkSize ] ) );
+			ArenaUsed = 0;
+		}
+		auto entry = new( Arena.back().get() + ArenaUsed ) string( std::move( str ) );
+		ArenaUsed += sizeof( string );
+		return entry;
+	}
+
+	name_t NameData::_find( const Shard& shard, const string& str, size_t hash ) const noexcept
+	{
+		if( shard.Table.empty() )
+			return no_name;
+		auto hash32 = static_cast<uint32_t>( hash );
+		auto mask = shard.Table.size() - 1;
+		for( auto pos = hash & mask; shard.Table[ pos ].Value != 0; pos = ( pos + 1 ) & mask )
+		{
+			auto& bucket = shard.Table[ pos ];
+			if( bucket.Hash == hash32 && *_slot( bucket.Value - 1 )->load( std::memory_order_acquire ) == str )
+				return name_t( bucket.Value );
+		}
+		return no_name;
+	}
+
+	void NameData::_insert( Shard& shard, size_t hash, name_t name )
+	{
+		// Keep the load factor at or below 3/4
+		if( ( shard.Count + 1 ) * 4 > shard.Table.size() * 3 )
+		{
+			std::vector<Bucket> table( shard.Table.empty() ? 64 : shard.Table.size() * 2 );
+			auto mask = table.size() - 1;
+			for( auto& bucket : shard.Table )
+			{
+				if( bucket.Value == 0 )
+					continue;
+				auto pos = bucket.Hash & mask;
+				while( table[ pos ].Value != 0 )
+					pos = ( pos + 1 ) & mask;
+				table[ pos ] = bucket;
+			}
+			shard.Table = std::move( table );
+		}
+		auto mask = shard.Table.size() - 1;
+		auto pos = hash & mask;
+		while( shard.Table[ pos ].Value != 0 )
+			pos = ( pos + 1 ) & mask;
+		shard.Table[ pos ] = Bucket{ static_cast<uint32_t>( hash ), name.value() };
+		++shard.Count;
+	}
 }
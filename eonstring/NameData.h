@@ -3,6 +3,8 @@
 #include "String.h"
 #include <set>
 #include <mutex>
+#include <shared_mutex>
+#include <atomic>
 #include <unordered_map>
 
 
@@ -16,27 +18,121 @@ namespace eon
 	//
 	// Underlying implementation of eon::name handling
 	//
-
-	struct hash_name { inline size_t operator()( const string* a ) const noexcept { return a->hash(); } };
-	struct eq_name { inline bool operator()( const string* a, const string* b ) const noexcept { return *a == *b; } };
+	// Names are stored back to back in arena chunks as string objects, which
+	// hold byte and character counts and keep short names in-place. No
+	// separate heap allocation is needed per name, except for names too
+	// long for that.
+	// A segmented, append-only array indexed by name value points into the
+	// arena. Segments are never moved or reallocated, so converting a name
+	// into a string is wait-free (two atomic loads).
+	// Converting a string into a name goes through an open addressing hash
+	// table of (hash, name) pairs, split into shards that each have their
+	// own reader/writer lock. The hashes are kept there, not in the arena,
+	// so that probing doesn't touch the names until the hash matches.
+	// Looking up an existing name only takes a shared lock on one shard.
+	//
 	class NameData
 	{
 	public:
 		NameData() = default;
-		~NameData() { std::scoped_lock<std::mutex> lock( Lock ); for( auto elm : Names ) delete elm; }
+		~NameData();
 
-		inline const string& str( const name_t& name ) { std::scoped_lock<std::mutex> lock( Lock );
-			return ( name > no_name && name.value() <= Names.size() ) ? *Names[ name.value() - 1 ] : NullStr; }
+		inline const string& str( const name_t& name ) const noexcept {
+			auto elm = name > no_name ? _slot( name.value() - 1 ) : nullptr;
+			auto value = elm != nullptr ? elm->load( std::memory_order_acquire ) : nullptr;
+			return value != nullptr ? *value : NullStr; }
 
 		name_t name( string&& str ) noexcept;
 		name_t compilerName( string&& str );
 
 		static bool validName( const string& str ) noexcept;
 
+
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Helpers
+		//
 	private:
-		std::vector<string*> Names;
-		std::unordered_map<const string*, name_t, hash_name, eq_name> Lookup;
-		std::mutex Lock;
+
+		// Segment 'n' holds FirstSegmentSize << n names, so that 32-bit name
+		// values never run out of segments.
+		static const uint32_t FirstSegmentBits{ 10 };
+		static const uint32_t FirstSegmentSize{ 1 << FirstSegmentBits };
+		static const uint32_t NumSegments{ 32 - FirstSegmentBits + 1 };
+		static const size_t ShardBits{ 6 };
+		static const size_t NumShards{ 1 << ShardBits };
+		static const size_t ArenaChunkSize{ 64 * 1024 };
+
+		using Slot = std::atomic<const string*>;
+
+		// Get slot for name index (name value - 1), nullptr if not allocated.
+		inline const Slot* _slot( uint32_t index ) const noexcept {
+			uint32_t segment{ 0 }, offset{ 0 }; _locate( index, segment, offset );
+			auto seg = Segments[ segment ].load( std::memory_order_acquire );
+			return seg != nullptr ? seg + offset : nullptr; }
+
+		static inline void _locate( uint32_t index, uint32_t& segment, uint32_t& offset ) noexcept {
+			auto pos = static_cast<uint64_t>( index ) + FirstSegmentSize;
+			segment = _log2( pos ) - FirstSegmentBits;
+			offset = static_cast<uint32_t>( pos - ( static_cast<uint64_t>( 1 ) << ( segment + FirstSegmentBits ) ) ); }
+		static inline uint32_t _log2( uint64_t value ) noexcept
+		{
+#if defined( __GNUC__ ) || defined( __clang__ )
+			return 63 - static_cast<uint32_t>( __builtin_clzll( value ) );
+#else
+			uint32_t bits{ 0 }; while( value >>= 1 ) ++bits; return bits;
+#endif
+		}
+
+		// Get slot for name index, allocate segment if needed.
+		Slot& _claimSlot( uint32_t index );
+
+		name_t _intern( string&& str );
+
+		// Move string into the arena.
+		const string* _store( string&& str );
+
+		// Hash table bucket, Value is zero for unused buckets.
+		// (Only the lower 32 bits of the hash are kept, the table never gets bigger than that.)
+		struct Bucket
+		{
+			uint32_t Hash{ 0 };
+			uint32_t Value{ 0 };
+		};
+		struct Shard
+		{
+			std::shared_mutex Lock;
+			std::vector<Bucket> Table;
+			size_t Count{ 0 };
+		};
+
+		// Shards are selected by the highest hash bits, buckets by the lowest.
+		inline Shard& _shard( size_t hash ) noexcept { return Shards[ hash >> ( sizeof( size_t ) * 8 - ShardBits ) ]; }
+
+		// Find name in shard, returns [eon::no_name] if not there.
+		name_t _find( const Shard& shard, const string& str, size_t hash ) const noexcept;
+
+		// Add name to shard, growing the table if needed.
+		void _insert( Shard& shard, size_t hash, name_t name );
+
+
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Attributes
+		//
+	private:
+		std::atomic<Slot*> Segments[ NumSegments ]{};
+		std::atomic<uint32_t> NumNames{ 0 };
+		Shard Shards[ NumShards ];
+
+		std::mutex ArenaLock;
+		std::vector<std::unique_ptr<char[]>> Arena;
+		size_t ArenaUsed{ ArenaChunkSize };
+
 		static const string NullStr;
 	};
 }
@@ -0,0 +1,63 @@
+#include "Simd.h"
+#include <eoninlinetest/InlineTest.h>
+
+
+namespace eon
+{
+	static simd _detectSimd() noexcept
+	{
+#if defined( EON_X86 ) && ( defined( __GNUC__ ) || defined( __clang__ ) )
+		__builtin_cpu_init();
+		if( __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "popcnt" ) )
+			return simd::avx2;
+		if( __builtin_cpu_supports( "sse2" ) )
+			return simd::sse2;
+		return simd::none;
+#elif defined( EON_X86 ) && defined( _MSC_VER )
+		int info[ 4 ]{ 0, 0, 0, 0 };
+		__cpuid( info, 0 );
+		auto max_leaf = info[ 0 ];
+		__cpuid( info, 1 );
+		bool sse2 = ( info[ 3 ] & ( 1 << 26 ) ) != 0;
+		bool popcnt = ( info[ 2 ] & ( 1 << 23 ) ) != 0;
+		bool os_ymm = ( info[ 2 ] & ( 1 << 27 ) ) != 0 && ( _xgetbv( 0 ) & 0x6 ) == 0x6;
+		if( max_leaf >= 7 && os_ymm && popcnt )
+		{
+			__cpuidex( info, 7, 0 );
+			if( ( info[ 1 ] & ( 1 << 5 ) ) != 0 )
+				return simd::avx2;
+		}
+		return sse2 ? simd::sse2 : simd::none;
+#else
+		return simd::none;
+#endif
+	}
+
+	simd cpuSimd() noexcept
+	{
+		static const simd level = _detectSimd();
+		return level;
+	}
+	EON_TEST( simd, cpuSimd, at_least_none,
+		EON_TRUE( cpuSimd() >= simd::none ) );
+
+	EON_TEST( simd, useSimd, none,
+		EON_TRUE( useSimd( simd::none ) == simd::none ) );
+	EON_TEST( simd, useSimd, capped,
+		EON_TRUE( useSimd( simd::avx2 ) == cpuSimd() ) );
+
+	const char* simdName( simd level ) noexcept
+	{
+		switch( level )
+		{
+			case simd::sse2:
+				return "sse2";
+			case simd::avx2:
+				return "avx2";
+			default:
+				return "scalar";
+		}
+	}
+	EON_TEST( simd, simdName, none,
+		EON_EQ( std::string( "scalar" ), std::string( simdName( simd::none ) ) ) );
+}
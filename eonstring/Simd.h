@@ -0,0 +1,100 @@
+#pragma once
+#include "UniChar.h"
+
+
+// Detect x86 SIMD support
+#if defined( __x86_64__ ) || defined( _M_X64 ) || defined( __i386__ ) || defined( _M_IX86 )
+#	define EON_X86
+#	include <immintrin.h>
+#	ifdef _MSC_VER
+#		include <intrin.h>
+#	endif
+#endif
+
+// Detect byte order, for code reading several bytes as one integer
+#if defined( _MSC_VER ) || ( defined( __BYTE_ORDER__ ) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+#	define EON_LITTLE_ENDIAN
+#endif
+
+// Functions using instructions beyond the compiler's target baseline must be
+// marked with one of these. (MSVC allows intrinsics everywhere.)
+#if defined( __GNUC__ ) || defined( __clang__ )
+#	define EON_TARGET_SSE2 __attribute__(( target( "sse2" ) ))
+#	define EON_TARGET_AVX2 __attribute__(( target( "avx2,popcnt" ) ))
+#else
+#	define EON_TARGET_SSE2
+#	define EON_TARGET_AVX2
+#endif
+
+
+
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// The 'eon' namespace encloses all public functionality
+//
+namespace eon
+{
+	///////////////////////////////////////////////////////////////////////////
+	//
+	// SIMD instruction set levels, in increasing order.
+	//
+	// Kernels that come in several versions use [eon::cpuSimd] to pick the
+	// best one for the running CPU. A specific level can also be requested
+	// (typically for testing and benchmarking), in which case the best
+	// supported level not above the requested one is used.
+	//
+	enum class simd : uint8_t
+	{
+		none,		// Plain C++ (scalar/SWAR), works everywhere
+		sse2,		// 128-bit SSE2
+		avx2		// 256-bit AVX2
+	};
+
+	// Get the best SIMD instruction set level supported by the running CPU.
+	// Detected once, then cached.
+	simd cpuSimd() noexcept;
+
+	// Get the requested SIMD level if supported, the best supported level below it if not.
+	inline simd useSimd( simd requested ) noexcept { auto cpu = cpuSimd(); return requested < cpu ? requested : cpu; }
+
+	// Get the name of a SIMD level.
+	const char* simdName( simd level ) noexcept;
+
+
+	// Count number of set bits in a 32-bit value.
+	inline int popCount( uint32_t value ) noexcept
+	{
+#if defined( __GNUC__ ) || defined( __clang__ )
+		return __builtin_popcount( value );
+#else
+		value = value - ( ( value >> 1 ) & 0x55555555 );
+		value = ( value & 0x33333333 ) + ( ( value >> 2 ) & 0x33333333 );
+		return static_cast<int>( ( ( ( value + ( value >> 4 ) ) & 0x0F0F0F0F ) * 0x01010101 ) >> 24 );
+#endif
+	}
+
+	// Get index of lowest set bit in a non-zero 32-bit value.
+	inline int lowestBit( uint32_t value ) noexcept
+	{
+#if defined( __GNUC__ ) || defined( __clang__ )
+		return __builtin_ctz( value );
+#else
+		unsigned long index{ 0 };
+		_BitScanForward( &index, value );
+		return static_cast<int>( index );
+#endif
+	}
+
+	// Get index of highest set bit in a non-zero 32-bit value.
+	inline int highestBit( uint32_t value ) noexcept
+	{
+#if defined( __GNUC__ ) || defined( __clang__ )
+		return 31 - __builtin_clz( value );
+#else
+		unsigned long index{ 0 };
+		_BitScanReverse( &index, value );
+		return static_cast<int>( index );
+#endif
+	}
+}
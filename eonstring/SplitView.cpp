@@ -0,0 +1,309 @@
+#include "SplitView.h"
+#include "String.h"
+#include "Simd.h"
+#include <eoninlinetest/InlineTest.h>
+#include <cstring>
+
+
+namespace eon
+{
+	split_view::split_view( const substring& source, const substring& separator ) noexcept
+		: Source( source.lowToHigh() ), Separator( separator.lowToHigh() ), Kernel( cpuSimd() )
+	{
+		Ascii = Source.begin().bytesOnly();
+		SeparatorSize = Separator.numBytes();
+		SeparatorChars = Separator.numChars();
+
+		// Valid UTF-8 can only match at character boundaries, raw bytes always do
+		if( Source.validUTF8() ? Separator.validUTF8() : Separator.begin().bytesOnly() )
+		{
+			Mode = SeparatorSize == 1 ? mode::byte : mode::bytes;
+			if( Mode == mode::byte )
+				Bytes[ 0 ] = *Separator.begin().byteData();
+		}
+		else
+			Mode = mode::generic;
+	}
+
+	split_view::split_view( const substring& source, char_t separator ) noexcept
+		: Source( source.lowToHigh() ), Kernel( cpuSimd() )
+	{
+		Ascii = Source.begin().bytesOnly();
+		SeparatorChars = 1;
+		if( isValidCodepoint( separator ) )
+		{
+			uint32_t bytes{ 0 };
+			SeparatorSize = string_iterator::unicodeToBytes( separator, bytes );
+			memcpy( Bytes, &bytes, SeparatorSize );
+		}
+		Mode = SeparatorSize == 1 ? mode::byte : mode::bytes;
+	}
+
+	split_view::split_view( const substring& source, charcat separators ) noexcept
+		: Source( source.lowToHigh() ), Category( separators ), Mode( mode::category ), Kernel( cpuSimd() )
+	{
+		Ascii = Source.begin().bytesOnly();
+		SeparatorChars = 1;
+	}
+
+
+#ifdef EON_TEST_MODE
+	// Split 'source' using the view and join the elements, each in brackets.
+	template<typename separator_t>
+	static string _testSplit( const string& source, separator_t separator )
+	{
+		string joined;
+		for( auto& element : split_view( source.substr(), separator ) )
+			joined << "[" << element << "]";
+		return joined;
+	}
+
+	// Check that the view gives the same elements as splitSequential.
+	static bool _testSameAsSequential( const string& source, const string& separator )
+	{
+		auto expected = source.splitSequential<std::vector<substring>>( separator );
+		split_view view( source.substr(), separator.substr() );
+		size_t i{ 0 };
+		for( auto element = view.begin(); element != view.end(); ++element, ++i )
+		{
+			if( i == expected.size() || *element != expected[ i ]
+				|| element->begin().numChar() != expected[ i ].begin().numChar()
+				|| element->end().numChar() != expected[ i ].end().numChar() )
+				return false;
+		}
+		return i == expected.size();
+	}
+#endif
+	EON_TEST( split_view, split_view, empty,
+		EON_EQ( "", _testSplit( string(), ',' ) ) );
+	EON_TEST( split_view, split_view, no_separator,
+		EON_EQ( "[abc]", _testSplit( string( "abc" ), ',' ) ) );
+	EON_TEST( split_view, split_view, char_t,
+		EON_EQ( "[a][][bc][]", _testSplit( string( "a,,bc," ), ',' ) ) );
+	EON_TEST( split_view, split_view, char_t_UTF8,
+		EON_EQ( u8"[a][ø][b]", _testSplit( string( u8"a€ø€b" ), char_t( 0x20AC ) ) ) );
+	EON_TEST( split_view, split_view, substring,
+		EON_EQ( "[a][b][][c]", _testSplit( string( "a, b, , c" ), substring( ", " ) ) ) );
+	EON_TEST( split_view, split_view, charcat,
+		EON_EQ( u8"[ab][ø][][c]", _testSplit( string( u8"ab\tø  c" ), charcat::separator_space | charcat::other_control ) ) );
+	EON_TEST( split_view, split_view, long_ASCII,
+		EON_TRUE( _testSameAsSequential( string( 20, string( "alpha,beta,,gamma,delta epsilon," ) ), "," ) ) );
+	EON_TEST( split_view, split_view, long_UTF8,
+		EON_TRUE( _testSameAsSequential( string( 20, string( u8"ålfa,βῆτα,,γάμμα,δέλτα 中文," ) ), "," ) ) );
+	EON_TEST( split_view, split_view, long_UTF8_substring,
+		EON_TRUE( _testSameAsSequential( string( 20, string( u8"ålfa€,βῆτα€,,γάμμα,δέλτα 中文," ) ), u8"€," ) ) );
+	EON_TEST_2STEP( split_view, split_view, substring_source,
+		string source( "ab,cd,ef,gh" ),
+		EON_EQ( 2, std::distance( split_view( source.substr( 3, 5 ), ',' ).begin(), split_view( source.substr( 3, 5 ), ',' ).end() ) ) );
+
+
+
+
+	///////////////////////////////////////////////////////////////////////////
+	//
+	// Iteration
+	//
+
+	split_view::iterator::iterator( const split_view* view ) noexcept
+	{
+		View = view;
+		Next = View->Source.begin().byteData();
+		NextChar = View->Source.begin().numChar();
+		_next();
+	}
+
+	void split_view::iterator::_next() noexcept
+	{
+		if( Next == nullptr )
+		{
+			View = nullptr;
+			Current = substring();
+			return;
+		}
+		const char* sep_end{ nullptr };
+		auto sep = _findSeparator( Next, sep_end );
+		auto element_end = sep != nullptr ? sep : View->Source.end().byteData();
+		auto num_chars = View->Ascii ? static_cast<index_t>( element_end - Next ) : _countChars( Next, element_end );
+		string_iterator first( View->Source.begin(), Next, NextChar );
+		Current = substring( first, string_iterator( first, element_end, NextChar + num_chars ) );
+		if( sep != nullptr )
+		{
+			NextChar += num_chars + ( View->Mode == mode::category ? 1 : View->SeparatorChars );
+			Next = sep_end;
+		}
+		else
+			Next = nullptr;
+	}
+
+	const char* split_view::iterator::_findSeparator( const char* pos, const char*& sep_end ) noexcept
+	{
+		auto end = View->Source.end().byteData();
+		const char* found{ nullptr };
+		switch( View->Mode )
+		{
+			case mode::byte:
+				if( ( found = _findByte( pos ) ) != nullptr )
+					sep_end = found + 1;
+				return found;
+			case mode::bytes:
+				found = substring::findBytes( pos, end - pos, View->_separator(), View->SeparatorSize );
+				if( found != nullptr )
+					sep_end = found + View->SeparatorSize;
+				return found;
+			case mode::category:
+				return _findInCategory( pos, sep_end );
+			default:
+			{
+				auto match = substring( string_iterator( View->Source.begin(), pos, NextChar ), View->Source.end() )
+					.findFirst( View->Separator );
+				if( !match )
+					return nullptr;
+				sep_end = match.end().byteData();
+				return match.begin().byteData();
+			}
+		}
+	}
+
+	const char* split_view::iterator::_findByte( const char* pos ) noexcept
+	{
+		auto end = View->Source.end().byteData();
+		if( Block == nullptr || pos >= Block + 32 )
+		{
+			Block = pos;
+			Mask = _byteMask( Block, end, View->Bytes[ 0 ], View->Kernel );
+		}
+		else
+			Mask &= ~0u << ( pos - Block );
+		while( Mask == 0 )
+		{
+			Block += 32;
+			if( Block >= end )
+				return nullptr;
+			Mask = _byteMask( Block, end, View->Bytes[ 0 ], View->Kernel );
+		}
+		return Block + lowestBit( Mask );
+	}
+
+	const char* split_view::iterator::_findInCategory( const char* pos, const char*& sep_end ) const noexcept
+	{
+		auto& chars = Characters::get();
+		for( auto c = pos, end = View->Source.end().byteData(); c < end; )
+		{
+			auto byte = static_cast<uint8_t>( *c );
+			if( byte < 0x80 || View->Ascii )
+			{
+				if( chars.is( byte, View->Category ) )
+				{
+					sep_end = c + 1;
+					return c;
+				}
+				++c;
+				continue;
+			}
+
+			// Source is valid UTF-8 (or it would be bytes only)
+			char_t codepoint{ 0 };
+			auto size = string_iterator::decodeValidUtf8( c, codepoint );
+			if( chars.is( codepoint, View->Category ) )
+			{
+				sep_end = c + size;
+				return c;
+			}
+			c += size;
+		}
+		return nullptr;
+	}
+
+
+
+
+	///////////////////////////////////////////////////////////////////////////
+	//
+	// Helpers
+	//
+
+	index_t split_view::_countChars( const char* begin, const char* end ) noexcept
+	{
+		// Count the bytes that are not UTF-8 continuation bytes, 8 at a time
+		index_t num{ 0 };
+		auto c = begin;
+		for( ; end - c >= 8; c += 8 )
+		{
+			uint64_t word{ 0 };
+			memcpy( &word, c, 8 );
+			auto continuation = ( word & ~( word << 1 ) & 0x8080808080808080ull ) >> 7;
+			num += 8 - static_cast<index_t>( ( continuation * 0x0101010101010101ull ) >> 56 );
+		}
+		for( ; c != end; ++c )
+		{
+			if( ( *c & 0xC0 ) != 0x80 )
+				++num;
+		}
+		return num;
+	}
+	EON_TEST( split_view, _countChars, UTF8,
+		EON_EQ( 11, split_view::_countChars( u8"ab€cdøø中文xy", u8"ab€cdøø中文xy" + 19 ) ) );
+
+#ifdef EON_X86
+	EON_TARGET_SSE2 static uint32_t _byteMaskSse2( const char* pos, char byte ) noexcept
+	{
+		auto value = _mm_set1_epi8( byte );
+		auto low = _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i*>( pos ) ), value ) );
+		auto high = _mm_movemask_epi8(
+			_mm_cmpeq_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i*>( pos + 16 ) ), value ) );
+		return static_cast<uint32_t>( low ) | ( static_cast<uint32_t>( high ) << 16 );
+	}
+	EON_NO_TEST( split_view, _byteMaskSse2 );
+
+	EON_TARGET_AVX2 static uint32_t _byteMaskAvx2( const char* pos, char byte ) noexcept
+	{
+		return static_cast<uint32_t>( _mm256_movemask_epi8( _mm256_cmpeq_epi8(
+			_mm256_loadu_si256( reinterpret_cast<const __m256i*>( pos ) ), _mm256_set1_epi8( byte ) ) ) );
+	}
+	EON_NO_TEST( split_view, _byteMaskAvx2 );
+#endif
+
+	uint32_t split_view::_byteMask( const char* pos, const char* end, char byte, simd kernel ) noexcept
+	{
+		if( end - pos >= 32 )
+		{
+#ifdef EON_X86
+			switch( kernel )
+			{
+				case simd::avx2:
+					return _byteMaskAvx2( pos, byte );
+				case simd::sse2:
+					return _byteMaskSse2( pos, byte );
+				default:
+					break;
+			}
+#endif
+			end = pos + 32;
+		}
+		uint32_t mask{ 0 };
+		for( auto c = pos; c != end; ++c )
+		{
+			if( *c == byte )
+				mask |= 1u << ( c - pos );
+		}
+		return mask;
+	}
+#ifdef EON_TEST_MODE
+	// Get positions of 'x' in 32 bytes at 'offset' in text with 'x' every 5th byte, using the specified kernel.
+	static uint32_t _testByteMask( simd kernel, index_t offset, index_t size = 32 )
+	{
+		std::string text;
+		for( int i = 0; i < 100; ++i )
+			text += i % 5 == 0 ? 'x' : 'a';
+		return split_view::_byteMask( text.c_str() + offset, text.c_str() + offset + size, 'x', useSimd( kernel ) );
+	}
+#endif
+	EON_TEST( split_view, _byteMask, scalar,
+		EON_EQ( 0x42108421u, _testByteMask( simd::none, 5 ) ) );
+	EON_TEST( split_view, _byteMask, sse2,
+		EON_EQ( 0x42108421u, _testByteMask( simd::sse2, 5 ) ) );
+	EON_TEST( split_view, _byteMask, avx2,
+		EON_EQ( 0x84210842u, _testByteMask( simd::avx2, 4 ) ) );
+	EON_TEST( split_view, _byteMask, short,
+		EON_EQ( 0x21u, _testByteMask( simd::avx2, 5, 7 ) ) );
+}
@@ -0,0 +1,165 @@
+#pragma once
+#include "Substring.h"
+#include "UniChar.h"
+#include <eoninlinetest/TestMacros.h>
+#include <iterator>
+
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// The 'eon' namespace encloses all public functionality
+//
+namespace eon
+{
+	enum class simd : uint8_t;
+
+	///////////////////////////////////////////////////////////////////////////
+	//
+	// Eon Split View Class - eon::split_view
+	//
+	// A lazy split of a substring into elements on a separator, which is a
+	// substring, a character, or any character in a [eon::charcat] category.
+	// The elements are found one at a time while iterating, as substrings
+	// referencing the source, so nothing is allocated.
+	//
+	// The elements are the same as those of [eon::substring::splitSequential]
+	// (without max number of elements): Empty elements between consecutive
+	// separators and after a trailing separator are included, while an
+	// empty source has no elements at all.
+	//
+	// Single byte separators are searched for 32 bytes at a time, using
+	// SIMD if the running CPU supports it. Other separators are searched for
+	// in raw bytes if possible (see [eon::substring::findBytes]).
+	//
+	// WARNING: The source (and a substring separator) must outlive the view!
+	//
+	class split_view
+	{
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Construction
+		//
+	public:
+
+		split_view() = delete;
+
+		// Split on every occurrence of the 'separator' substring.
+		split_view( const substring& source, const substring& separator ) noexcept;
+
+		// Split on every occurrence of the 'separator' character.
+		split_view( const substring& source, char_t separator ) noexcept;
+
+		// Split on every character in the 'separators' category.
+		split_view( const substring& source, charcat separators ) noexcept;
+
+		split_view( const split_view& ) = default;
+		~split_view() = default;
+
+
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Iteration
+		//
+	public:
+
+		// Forward iterator for the elements.
+		// Only valid for as long as the view is.
+		class iterator
+		{
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = substring;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const substring*;
+			using reference = const substring&;
+
+			iterator() = default;
+
+			inline const substring& operator*() const noexcept { return Current; }
+			inline const substring* operator->() const noexcept { return &Current; }
+
+			inline iterator& operator++() noexcept { _next(); return *this; }
+			inline iterator operator++( int ) noexcept { auto copy = *this; _next(); return copy; }
+
+			inline bool operator==( const iterator& other ) const noexcept {
+				return View == nullptr ? other.View == nullptr
+					: other.View != nullptr && Current.begin().byteData() == other.Current.begin().byteData(); }
+			inline bool operator!=( const iterator& other ) const noexcept { return !( *this == other ); }
+
+		private:
+			friend class split_view;
+			explicit iterator( const split_view* view ) noexcept;
+
+			void _next() noexcept;
+
+			// Find next separator at or after 'pos', set 'sep_end' to one past it.
+			// Returns nullptr if there are no more.
+			const char* _findSeparator( const char* pos, const char*& sep_end ) noexcept;
+			const char* _findByte( const char* pos ) noexcept;
+			const char* _findInCategory( const char* pos, const char*& sep_end ) const noexcept;
+
+		private:
+			const split_view* View{ nullptr };
+			substring Current;
+			const char* Next{ nullptr };		// Start of next element, nullptr if no more
+			index_t NextChar{ 0 };
+
+			// Single byte separator positions in the 32 bytes from 'Block'
+			// that have not been passed yet.
+			const char* Block{ nullptr };
+			uint32_t Mask{ 0 };
+		};
+
+		// Get iterator for the first element.
+		// Returns [end] if the source is empty.
+		inline iterator begin() const noexcept { return Source.empty() ? iterator() : iterator( this ); }
+
+		// Get iterator for one past the last element.
+		inline iterator end() const noexcept { return iterator(); }
+
+
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Helpers
+		//
+	EON_PRIVATE:
+
+		enum class mode : uint8_t
+		{
+			byte,			// Single byte separator in 'Bytes'
+			bytes,			// Multi-byte separator in 'Bytes' or 'Separator'
+			category,		// Any character in 'Category'
+			generic			// 'Separator' searched for using substring::findFirst
+		};
+
+		inline const char* _separator() const noexcept { return Separator ? Separator.begin().byteData() : Bytes; }
+
+		// Get number of characters in the (valid UTF-8) bytes.
+		static index_t _countChars( const char* begin, const char* end ) noexcept;
+
+		// Get bit mask of the positions of 'byte' in the 32 bytes from 'pos' (fewer if 'end' is closer).
+		static uint32_t _byteMask( const char* pos, const char* end, char byte, simd kernel ) noexcept;
+
+
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Attributes
+		//
+	private:
+		substring Source;
+		substring Separator;		// Only set for substring separators
+		char Bytes[ 4 ]{ 0, 0, 0, 0 };	// Character separator as UTF-8
+		index_t SeparatorSize{ 0 };		// In bytes
+		index_t SeparatorChars{ 0 };
+		charcat Category{ charcat::undef };
+		mode Mode{ mode::byte };
+		simd Kernel{};					// Set from cpuSimd()
+		bool Ascii{ false };			// If number of bytes == number of characters in source
+	};
+}
@@ -213,8 +213,7 @@ namespace eon
 
 	void string::_wstrToUtf8( const wchar_t* start, const wchar_t* end )
 	{
-		Bytes.clear();
-		NumChars = 0;
+		clear();
 		uint32_t value{ 0 };
 		const char* bytes = (char*)&value;
 		for( auto wc = start; wc != end; ++wc )
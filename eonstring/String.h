@@ -3,6 +3,7 @@
 #include "Substring.h"
 #include "Locale.h"
 #include "Compare.h"
+#include "SplitView.h"
 #include <eoninlinetest/TestMacros.h>
 #include <set>
 #include <list>
@@ -11,6 +12,8 @@
 #include <iomanip>
 #include <cmath>
 #include <unordered_map>
+#include <vector>
+#include <atomic>
 
 
 
@@ -92,7 +95,7 @@ namespace eon
 		inline string( string&& other ) noexcept { *this = std::move( other ); }
 
 		// Construct as a copy of another string
-		inline string( const string& ) = default;
+		inline string( const string& other ) : Bytes( other.Bytes ), NumChars( other.NumChars ) {}
 
 
 		// Construct as a copy of a substring marked by the specified iterator pair.
@@ -119,7 +122,7 @@ namespace eon
 
 		// Construct as a copy of a C string of specified length.
 		// WARNING: Throws [eon::InvalidUTF8] if input is not valid UTF-8!
-		inline string( const char* input, index_t input_length ) { *this = std::string( input, input_length ); }
+		inline string( const char* input, index_t input_length ) { assign( input, input_length ); }
 
 		// Construct as a copy of a C string of specified length.
 		// Will not throw exception on invalid UTF-8 parts but substitute those with the specified substitution string.
@@ -246,7 +249,7 @@ namespace eon
 
 
 		// Default destructor.
-		virtual ~string() = default;
+		virtual ~string() { _dropCharIndex(); }
 
 
 	EON_PRIVATE:
@@ -295,11 +298,13 @@ namespace eon
 
 
 		// Discard current details and copy those of another string.
-		inline string& operator=( const string& ) = default;
+		inline string& operator=( const string& other ) {
+			if( this != &other ) { _dropCharIndex(); Bytes = other.Bytes; NumChars = other.NumChars; } return *this; }
 
 		// Discard current details and take over ownership of those of another string.
 		inline string& operator=( string&& other ) noexcept {
-			Bytes = std::move( other.Bytes ); NumChars = other.NumChars; other.NumChars = 0; return *this; }
+			_dropCharIndex(); Bytes = std::move( other.Bytes ); NumChars = other.NumChars; other.NumChars = 0;
+			CharIndex.store( other.CharIndex.exchange( nullptr ) ); return *this; }
 
 
 		// Discard current details and copy new from a substring.
@@ -463,6 +468,14 @@ namespace eon
 		// string, or the byte position of 'start' is beyond 'pos'.
 		iterator bytePos( index_t pos, iterator start = iterator() ) const;
 
+		// Given a character position within the string, get an iterator for it.
+		// For large non-ASCII strings, this uses a sparse index of the byte
+		// position of every 64th character, built on first use and discarded
+		// when the string is modified. Other strings are counted from the
+		// start, or from the end if in the last third.
+		// Returns [end] if 'num_char' is at or beyond the end of the string.
+		iterator charPos( index_t num_char ) const;
+
 
 		// Given an iterator for another string, get a new iterator for the same position in 'this'.
 		// Returns [end] if the iterator from the other string is beyond what 'this' string contains.
@@ -526,7 +539,7 @@ namespace eon
 	public:
 
 		// Clear the string contents
-		inline void clear() noexcept { Bytes.clear(); NumChars = 0; }
+		inline void clear() noexcept { _dropCharIndex(); Bytes.clear(); NumChars = 0; }
 
 		// Reserve memory in order to reduce the number of times the
 		// underlying string buffer may have to grow.
@@ -561,7 +574,8 @@ namespace eon
 
 
 		// Concatenate another string to 'this'.
-		inline string& operator+=( const string& other ) { Bytes += other.Bytes; NumChars += other.NumChars; return *this; }
+		inline string& operator+=( const string& other ) {
+			_dropCharIndex(); Bytes += other.Bytes; NumChars += other.NumChars; return *this; }
 
 		// Concatenate an substring to 'this'.
 		// WARNING: Throws [eon::InvalidUTF8] if input is not valid UTF-8!
@@ -675,9 +689,8 @@ namespace eon
 
 		// Get a copy of the string with only letters in the 'sub' substring of 'this' transformed to upper-case.
 		// Will use 'custom_locale' if specified and the default Eon locale if not!
-		inline string upper( const substring& sub, const locale* custom_locale = nullptr ) const {
-			return transform( sub, []( char_t c, const eon::locale& loc ) {
-				return loc.toUpper( static_cast<wchar_t>( c ) ); }, custom_locale ); }
+		// NOTE: ASCII-only strings are transformed without character lookups if the locale allows it!
+		string upper( const substring& sub, const locale* custom_locale = nullptr ) const;
 
 
 		// Get a copy of the string with all letters transformed to lower case.
@@ -686,9 +699,8 @@ namespace eon
 
 		// Get a copy of the string with only letters in the 'sub' substring of 'this' transformed to lower-case.
 		// Will use 'custom_locale' if specified and the default Eon locale if not!
-		inline string lower( const substring& sub, const locale* custom_locale = nullptr ) const {
-			return transform( sub, []( char_t c, const eon::locale& loc ) {
-				return loc.toLower( static_cast<wchar_t>( c ) ); }, custom_locale ); }
+		// NOTE: ASCII-only strings are transformed without character lookups if the locale allows it!
+		string lower( const substring& sub, const locale* custom_locale = nullptr ) const;
 
 
 		// Get a copy of the string with first letter transformed to upper-case.
@@ -747,7 +759,7 @@ namespace eon
 		// Get substring based on character position and count.
 		// NOTE: This involves counting characters, but will count from the end if closer than start!
 		inline substring substr( index_t start, index_t size ) const {
-			auto sub = substr(); return substring( sub.iterator( start ), sub.iterator( start + size ) ); }
+			auto first = charPos( start ); return substring( first, size < CharIndexStep ? first + size : charPos( start + size ) ); }
 
 
 		// Get a substring (slice) starting at 'start' position and ending at 'end'. If either value is
@@ -1119,6 +1131,24 @@ namespace eon
 		container_t splitNonSequential( char_t delimiter ) const {
 			return substr().splitNonSequential<container_t>( delimiter ); }
 
+		// Get a lazy split of the string on every occurrence of 'delimiter', see [eon::split_view].
+		// The elements are the same as for splitSequential, but found one at a time while iterating,
+		// without allocating anything.
+		// WARNING: The string (and the delimiter) must outlive the view!
+		// Example: {for( auto& field : line.splitView( ',' ) ) ...}
+		inline split_view splitView( char_t delimiter ) const { return split_view( substr(), delimiter ); }
+		inline split_view splitView( const string& delimiter ) const {
+			return split_view( substr(), delimiter.substr() ); }
+		split_view splitView( string&& delimiter ) const = delete;
+		inline split_view splitView( const substring& delimiter ) const { return split_view( substr(), delimiter ); }
+		inline split_view splitView( const char* delimiter ) const {
+			return split_view( substr(), substring( delimiter ) ); }
+
+		// Get a lazy split of the string on every character in the 'delimiters' category, see [eon::split_view].
+		// WARNING: The string must outlive the view!
+		// Example: {for( auto& word : text.splitView( charcat::separator_space ) ) ...}
+		inline split_view splitView( charcat delimiters ) const { return split_view( substr(), delimiters ); }
+
 
 		// Get a string that joins the elements from 'start' to 'end' using 'this' string as 'glue' in between.
 		template<typename iterator_t>
@@ -1404,7 +1434,9 @@ namespace eon
 		//
 		// String hashing
 		//
-		// Uses the FNV-1a hash algorithm
+		// The fixed-size hashes use the FNV-1a hash algorithm, the 'size_t'
+		// hash used by hash tables uses the faster wyhash algorithm.
+		// (See [eon::hashed_string] for strings that cache their hash value.)
 		//
 	public:
 
@@ -1414,13 +1446,9 @@ namespace eon
 		// Get a 64-bit hash value using FNV-1a hash algorithm .
 		inline uint64_t hash64() const noexcept { return substring::hash64( Bytes.c_str(), Bytes.c_str() + Bytes.size() ); }
 
-#if defined(_WIN64) || defined(__x86_64__)
-		// Get a 'size_t' size hash value using FNV-1a hash algorithm .
-		inline size_t hash() const noexcept { return substring::hash64( Bytes.c_str(), Bytes.c_str() + Bytes.size() ); }
-#else
-		// Get a 'size_t' size hash value using FNV-1a hash algorithm .
-		inline size_t hash() const noexcept { return substring::hash32( Bytes.c_str(), Bytes.c_str() + Bytes.size() ); }
-#endif
+		// Get a 'size_t' size hash value using wyhash hash algorithm .
+		inline size_t hash() const noexcept {
+			return static_cast<size_t>( substring::wyhash( Bytes.c_str(), Bytes.c_str() + Bytes.size() ) ); }
 
 
 
@@ -2410,6 +2438,23 @@ namespace eon
 		string::iterator _ensureValidStart( iterator& start ) const;
 		string::iterator _count( index_t pos, iterator& start ) const;
 
+		// Character index, see [eon::string::charPos].
+		static const index_t CharIndexStep{ 64 };
+		static const index_t CharIndexMinChars{ 1024 };
+		inline bool _useCharIndex() const noexcept { return NumChars >= CharIndexMinChars && !_ascii(); }
+		const std::vector<index_t>& _charIndex() const;
+		// (Only exchanging if there is one, as most strings never get one.)
+		inline void _dropCharIndex() noexcept {
+			if( CharIndex.load( std::memory_order_relaxed ) != nullptr )
+				delete CharIndex.exchange( nullptr, std::memory_order_acquire ); }
+
+		// Get a copy of an ASCII-only string with the case of letters in 'area' transformed.
+		string _asciiCase( const substring& area, bool upper ) const;
+
+		// Get a copy of the string with the case of letters in 'area' transformed.
+		// (Same as [transform], without the overhead of appending one character at a time.)
+		string _utf8Case( const substring& area, bool upper, const eon::locale& loc ) const;
+
 		inline string _prepOutput( const substring& area ) const
 		{
 			string output;
@@ -2489,6 +2534,9 @@ namespace eon
 		std::string Bytes;
 		index_t NumChars{ 0 };	// Number of code points
 
+		// Byte position of every [CharIndexStep]th character, see [eon::string::charPos].
+		mutable std::atomic<const std::vector<index_t>*> CharIndex{ nullptr };
+
 	public:
 		static const string Empty;
 	};
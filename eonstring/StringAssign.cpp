@@ -35,9 +35,11 @@ namespace eon
 
 	string& string::assign( const char* input, index_t input_length )
 	{
-		iterator i( input, input_length );	// Using iterator to scan the raw string for us!
-		_assertValidUtf8( i );
-		NumChars = i.numSourceChars();
+		index_t num_chars{ 0 };
+		if( !iterator::scanUtf8( input, input_length, num_chars ) )
+			throw InvalidUTF8();
+		_dropCharIndex();
+		NumChars = num_chars;
 		Bytes.assign( input, input_length );
 		return *this;
 	}
@@ -61,6 +63,7 @@ namespace eon
 	{
 		uint32_t bytes;
 		auto size = iterator::unicodeToBytes( input, bytes );
+		_dropCharIndex();
 		Bytes.reserve( size * copies );
 		for( index_t i = 0; i < copies; ++i )
 			Bytes.append( (const char*)&bytes, size );
@@ -82,6 +85,7 @@ namespace eon
 		// Make sure 'other' and 'this' are not the same!
 		if( &other.Bytes != &Bytes )
 		{
+			_dropCharIndex();
 			Bytes.reserve( other.numBytes() * copies );
 			for( index_t i = 0; i < copies; ++i )
 				Bytes.append( other.Bytes );
@@ -103,6 +107,7 @@ namespace eon
 		{
 			iterator i( input );
 			_assertValidUtf8( i );
+			_dropCharIndex();
 			Bytes.reserve( input.size() * copies );
 			for( index_t i = 0; i < copies; ++i )
 				Bytes.append( input );
@@ -181,6 +186,7 @@ namespace eon
 
 	string& string::_assignLowToHigh( const substring& input )
 	{
+		_dropCharIndex();
 		NumChars = input.numChars();
 		Bytes.assign( input.begin().byteData(), input.numBytes() );
 		return *this;
@@ -194,9 +200,11 @@ namespace eon
 
 	string& string::operator=( std::string&& input )
 	{
-		substring sub( input );
-		_assertValidUtf8( sub );
-		NumChars = sub.numChars();
+		index_t num_chars{ 0 };
+		if( !iterator::scanUtf8( input.c_str(), input.size(), num_chars ) )
+			throw InvalidUTF8();
+		_dropCharIndex();
+		NumChars = num_chars;
 		Bytes = std::move( input );
 		return *this;
 	}
@@ -1,4 +1,5 @@
 ﻿#include "String.h"
+#include "AsciiCase.h"
 #include <eoninlinetest/InlineTest.h>
 #include <cctype>
 #include <regex>
@@ -22,6 +23,13 @@ namespace eon
 			[]( string_iterator begin, string_iterator end ) { for( auto c = begin; c != end; ++c ) if( *c % 2 == 0 ) return c; return end; },
 			[]( char_t c, const eon::locale& loc ) { return c - 32; } ) ) );
 
+	string string::upper( const substring& sub, const eon::locale* custom_locale ) const
+	{
+		const eon::locale& loc = custom_locale != nullptr ? *custom_locale : eon::locale::get();
+		if( _ascii() && loc.asciiCase() )
+			return _asciiCase( sub, true );
+		return _utf8Case( sub, true, loc );
+	}
 	EON_TEST_2STEP( string, upper, empty,
 		string obj,
 		EON_EQ( "", obj.upper( obj.substr() ) ) );
@@ -40,6 +48,23 @@ namespace eon
 		string obj( "aBcDeFgH" ),
 		EON_EQ( "aBcDEFgH", obj.upper( obj.substr( obj.begin() + 3, obj.end() - 3 ) ) ) );
 
+	EON_TEST_2STEP( string, upper, long_ASCII,
+		string obj( 10, string( "The quick brown fox, " ) ),
+		EON_EQ( string( 10, string( "THE QUICK BROWN FOX, " ) ), obj.upper() ) );
+	EON_TEST_2STEP( string, upper, UTF8_default,
+		string obj( u8"æøå abc" ),
+		EON_EQ( u8"ÆØÅ ABC", obj.upper() ) );
+	EON_TEST_2STEP( string, upper, non_BMP,
+		string obj( u8"\U00010428x" ),
+		EON_EQ( u8"\U00010400X", obj.upper() ) );
+
+	string string::lower( const substring& sub, const eon::locale* custom_locale ) const
+	{
+		const eon::locale& loc = custom_locale != nullptr ? *custom_locale : eon::locale::get();
+		if( _ascii() && loc.asciiCase() )
+			return _asciiCase( sub, false );
+		return _utf8Case( sub, false, loc );
+	}
 	EON_TEST_2STEP( string, lower, empty,
 		string obj,
 		EON_EQ( "", obj.lower( obj.substr() ) ) );
@@ -58,6 +83,70 @@ namespace eon
 		string obj( "aBcDeFgH" ),
 		EON_EQ( "aBcdeFgH", obj.lower( obj.substr( obj.begin() + 3, obj.end() - 3 ) ) ) );
 
+	EON_TEST_2STEP( string, lower, long_ASCII,
+		string obj( 10, string( "The QUICK Brown fox, " ) ),
+		EON_EQ( string( 10, string( "the quick brown fox, " ) ), obj.lower() ) );
+	EON_TEST_2STEP( string, lower, UTF8_default,
+		string obj( u8"ÆØÅ ABC" ),
+		EON_EQ( u8"æøå abc", obj.lower() ) );
+	EON_TEST_2STEP( string, lower, non_BMP,
+		string obj( u8"\U00010400X" ),
+		EON_EQ( u8"\U00010428x", obj.lower() ) );
+
+	string string::_asciiCase( const substring& area, bool upper ) const
+	{
+		if( area.empty() )
+			return *this;
+		auto real_area = area.lowToHigh();
+		string output( std::string( Bytes ), true );
+		auto bytes = &output.Bytes[ 0 ] + ( real_area.begin().byteData() - Bytes.c_str() );
+		if( upper )
+			asciiUpper( bytes, real_area.numBytes() );
+		else
+			asciiLower( bytes, real_area.numBytes() );
+		return output;
+	}
+	EON_TEST_2STEP( string, _asciiCase, reversed,
+		string obj( "abcdef" ),
+		EON_EQ( "abCDef", obj._asciiCase( obj.substr( obj.begin() + 2, obj.end() - 2 ).highToLow(), true ) ) );
+
+	string string::_utf8Case( const substring& area, bool upper, const eon::locale& loc ) const
+	{
+		if( area.empty() )
+			return *this;
+		auto real_area = area.lowToHigh();
+		auto start = real_area.begin().byteData(), end = real_area.end().byteData();
+		string output;
+		output.Bytes.reserve( Bytes.size() );
+		output.Bytes.append( Bytes.c_str(), start - Bytes.c_str() );
+		auto ascii_case = loc.asciiCase();
+		for( auto c = start; c < end; )
+		{
+			if( ascii_case && static_cast<uint8_t>( *c ) < 0x80 )
+			{
+				auto letter = static_cast<unsigned char>( ( *c | 0x20 ) - 'a' ) < 26;
+				output.Bytes += letter ? ( upper ? *c & ~0x20 : *c | 0x20 ) : *c;
+				++c;
+				continue;
+			}
+			char_t codepoint{ 0 };
+			c += string_iterator::decodeValidUtf8( c, codepoint );
+			// (Characters beyond the BMP don't fit a 16 bit wchar_t.)
+			if( sizeof( wchar_t ) > 2 || codepoint <= 0xFFFF )
+				codepoint = static_cast<char_t>( upper ? loc.toUpper( static_cast<wchar_t>( codepoint ) )
+					: loc.toLower( static_cast<wchar_t>( codepoint ) ) );
+			uint32_t bytes{ 0 };
+			auto size = string_iterator::unicodeToBytes( codepoint, bytes );
+			output.Bytes.append( reinterpret_cast<const char*>( &bytes ), size );
+		}
+		output.Bytes.append( end, Bytes.c_str() + Bytes.size() - end );
+		output.NumChars = NumChars;
+		return output;
+	}
+	EON_TEST_2STEP( string, _utf8Case, substr,
+		string obj( u8"æøå abc ÆØÅ" ),
+		EON_EQ( u8"æøÅ ABC ÆØÅ", obj._utf8Case( obj.substr( obj.begin() + 2, obj.end() - 2 ), true, eon::locale::get() ) ) );
+
 	EON_TEST( string, ucFirst, empty,
 		EON_EQ( "", string().ucFirst() ) );
 	EON_TEST( string, ucFirst, ASCII,
@@ -73,6 +162,8 @@ namespace eon
 		if( sub.empty() )
 			return *this;
 		auto area = sub.lowToHigh();
+		if( _ascii() && ( custom_locale != nullptr ? *custom_locale : eon::locale::get() ).asciiCase() )
+			return _asciiCase( substring( area.begin(), area.begin() + 1 ), true );
 		if( area.numBytes() == 1 )
 			return upper( area, custom_locale );
 		else
@@ -135,8 +226,7 @@ namespace eon
 			++e;
 		else
 			--e;
-		auto sub = substr();
-		return substring( sub.iterator( s ), sub.iterator( e ) );
+		return substring( charPos( s ), charPos( e ) );
 	}
 	EON_TEST( string, slice, empty,
 		EON_EQ( substring(), string().slice( 0, -1 ) ) );
@@ -1,8 +1,11 @@
 ﻿#include "String.h"
+#include "Simd.h"
 #include <eoninlinetest/InlineTest.h>
 #include <cctype>
 #include <regex>
 #include <unordered_map>
+#include <algorithm>
+#include <cstring>
 
 
 namespace eon
@@ -36,7 +39,18 @@ namespace eon
 	string::iterator string::bytePos( index_t pos, iterator start ) const
 	{
 		start = _ensureValidStart( start );
-		return _ascii() ? _optimizedAsciiBytePos( pos, start ) : _count( pos, start );
+		if( _ascii() )
+			return _optimizedAsciiBytePos( pos, start );
+		if( _useCharIndex() && pos < Bytes.size() )
+		{
+			// Skip ahead to the last indexed character at or before 'pos'
+			auto& index = _charIndex();
+			auto found = std::upper_bound( index.begin(), index.end(), pos ) - 1;
+			if( *found > start.numByte() )
+				start = iterator( Bytes.c_str(), Bytes.size(), NumChars, Bytes.c_str() + *found,
+					static_cast<index_t>( found - index.begin() ) * CharIndexStep );
+		}
+		return _count( pos, start );
 	}
 	EON_TEST_2STEP( string, bytePos, ASCII,
 		string obj( "abcdef" ),
@@ -44,6 +58,93 @@ namespace eon
 	EON_TEST_2STEP( string, bytePos, UTF8,
 		string obj( EON_CURLY( char_t( 913 ), char_t( 914 ), char_t( 915 ), char_t( 916 ) ) ),
 		EON_EQ( 915, static_cast<int>( *obj.bytePos( 3 ) ) ) );
+	EON_TEST_2STEP( string, bytePos, indexed,
+		string obj( 1000, string( u8"a\u00D8" ) ),
+		EON_EQ( 1001, obj.bytePos( 1501 ).numChar() ) );
+
+	string::iterator string::charPos( index_t num_char ) const
+	{
+		if( num_char >= NumChars )
+			return end();
+		if( !_useCharIndex() )
+		{
+			// NOTE: Counting backward is slightly more costly so skew the middle-point.
+			if( NumChars >= 10 && num_char >= ( NumChars / 3 ) * 2 )
+				return end() - ( NumChars - num_char );
+			return begin() + num_char;
+		}
+		auto& index = _charIndex();
+		auto checkpoint = num_char / CharIndexStep;
+		return iterator( Bytes.c_str(), Bytes.size(), NumChars, Bytes.c_str() + index[ checkpoint ],
+			checkpoint * CharIndexStep ) + num_char % CharIndexStep;
+	}
+	EON_TEST_2STEP( string, charPos, empty,
+		string obj,
+		EON_EQ( obj.end(), obj.charPos( 0 ) ) );
+	EON_TEST_2STEP( string, charPos, ASCII,
+		string obj( "abcdef" ),
+		EON_EQ( 'd', *obj.charPos( 3 ) ) );
+	EON_TEST_2STEP( string, charPos, beyond,
+		string obj( "abcdef" ),
+		EON_EQ( obj.end(), obj.charPos( 6 ) ) );
+	EON_TEST_2STEP( string, charPos, from_end,
+		string obj( u8"a\u00D8bc\u00D8defgh\u00D8ij" ),
+		EON_EQ( char_t( 0xD8 ), *obj.charPos( 10 ) ) );
+	EON_TEST_2STEP( string, charPos, from_end_numbers,
+		string obj( u8"a\u00D8bc\u00D8defgh\u00D8ij" ),
+		EON_EQ( 14, obj.charPos( 11 ).numByte() ) );
+	EON_TEST_2STEP( string, charPos, indexed,
+		string obj( 1000, string( u8"a\u00D8b" ) ),
+		EON_EQ( string( u8"\u00D8b" ), string( obj.substr( obj.charPos( 1600 ), obj.charPos( 1602 ) ) ) ) );
+	EON_TEST_2STEP( string, charPos, indexed_numbers,
+		string obj( 1000, string( u8"a\u00D8b" ) ),
+		EON_EQ( 2135, obj.charPos( 1601 ).numByte() ) );
+	EON_TEST_3STEP( string, charPos, modified,
+		string obj( 1000, string( u8"a\u00D8b" ) ),
+		obj.charPos( 1600 ); obj.erase( obj.substr( obj.begin(), obj.begin() + 1 ) ),
+		EON_EQ( char_t( 0xD8 ), *obj.charPos( 1599 ) ) );
+
+	const std::vector<index_t>& string::_charIndex() const
+	{
+		if( auto index = CharIndex.load( std::memory_order_acquire ); index != nullptr )
+			return *index;
+
+		// Count characters 8 bytes at a time, only looking at single bytes
+		// when the next checkpoint is within reach.
+		auto fresh = new std::vector<index_t>();
+		fresh->reserve( NumChars / CharIndexStep + 1 );
+		auto bytes = reinterpret_cast<const unsigned char*>( Bytes.c_str() );
+		index_t size = Bytes.size(), pos = 0, num_char = 0;
+		while( pos < size )
+		{
+			if( pos + 8 <= size && num_char + 8 <= fresh->size() * CharIndexStep )
+			{
+				uint64_t word{ 0 };
+				std::memcpy( &word, bytes + pos, 8 );
+				auto continuation = word & ~( word << 1 ) & 0x8080808080808080ull;
+				num_char += 8 - popCount( static_cast<uint32_t>( continuation ) )
+					- popCount( static_cast<uint32_t>( continuation >> 32 ) );
+				pos += 8;
+			}
+			else
+			{
+				if( ( bytes[ pos ] & 0xC0 ) != 0x80 )
+				{
+					if( num_char % CharIndexStep == 0 )
+						fresh->push_back( pos );
+					++num_char;
+				}
+				++pos;
+			}
+		}
+
+		// Another thread may have built the index while we did
+		const std::vector<index_t>* existing{ nullptr };
+		if( CharIndex.compare_exchange_strong( existing, fresh, std::memory_order_acq_rel ) )
+			return *fresh;
+		delete fresh;
+		return *existing;
+	}
 
 	inline string::iterator string::_ensureValidStart( iterator& start ) const
 	{
@@ -1,5 +1,6 @@
 ﻿#include "StringIterator.h"
 #include "String.h"
+#include "Simd.h"
 #include <eoninlinetest/InlineTest.h>
 #include <cctype>
 #include <regex>
@@ -816,17 +817,228 @@ namespace eon
 		return _utf8Decode( state, codep, byte ); }
 	EON_NO_TEST( string_iterator, utf8Decode );
 
-	index_t string_iterator::countUtf8Chars( const char* str, index_t size )
+	///////////////////////////////////////////////////////////////////////////
+	//
+	// UTF-8 validate-and-count kernels
+	//
+	// All kernels give the same result as running [_utf8Decode] over every
+	// byte. The scalar kernel is the decoder with an eight-bytes-at-a-time
+	// ASCII fast path, the SSE2 kernel does the same 16 bytes at a time, while
+	// the AVX2 kernel validates 32 bytes at a time without decoding, using the
+	// Keiser-Lemire lookup algorithm (see "Validating UTF-8 In Less Than One
+	// Instruction Per Byte", Software: Practice and Experience, 2021).
+	//
+
+	// Decode characters from 'c' until at or past 'stop' (but never past 'end'), counting them in 'num'.
+	// The decoder state starts afresh for each character, so there is no dependency between characters.
+	// Returns false if invalid UTF-8.
+	static inline bool _decodeChars( const char*& c, const char* stop, const char* end, index_t& num ) noexcept
 	{
 		char32_t cp{ 0 };
-		char32_t state{ 0 };
+		while( c < stop )
+		{
+			char32_t state{ UTF8_ACCEPT };
+			do
+			{
+				if( c == end || _utf8Decode( state, cp, static_cast<unsigned char>( *c++ ) ) == UTF8_REJECT )
+					return false;
+			} while( state != UTF8_ACCEPT );
+			++num;
+		}
+		return true;
+	}
+	EON_NO_TEST( string_iterator, _decodeChars );
+
+	static bool _scanUtf8Scalar( const char* str, index_t size, index_t& num_chars ) noexcept
+	{
 		index_t num = 0;
-		for( auto c = str, end_c = str + size; c != end_c; ++c )
+		uint64_t word{ 0 };
+		for( auto c = str, end = str + size; c != end; )
 		{
-			if( !_utf8Decode( state, cp, static_cast<unsigned char>( *c ) ) )
-				++num;
+			if( end - c >= 8 )
+			{
+				memcpy( &word, c, 8 );
+				if( ( word & 0x8080808080808080ull ) == 0 )
+				{
+					c += 8;
+					num += 8;
+					continue;
+				}
+			}
+			if( !_decodeChars( c, end - c > 8 ? c + 8 : end, end, num ) )
+				return false;
+		}
+		num_chars = num;
+		return true;
+	}
+	EON_NO_TEST( string_iterator, _scanUtf8Scalar );
+
+#ifdef EON_X86
+	EON_TARGET_SSE2 static bool _scanUtf8Sse2( const char* str, index_t size, index_t& num_chars ) noexcept
+	{
+		index_t num = 0;
+		for( auto c = str, end = str + size; c != end; )
+		{
+			if( end - c >= 16 )
+			{
+				auto non_ascii = static_cast<uint32_t>(
+					_mm_movemask_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i*>( c ) ) ) );
+				if( non_ascii == 0 )
+				{
+					c += 16;
+					num += 16;
+					continue;
+				}
+
+				// Skip the ASCII bytes in front of the first non-ASCII byte
+				auto ascii = lowestBit( non_ascii );
+				c += ascii;
+				num += ascii;
+			}
+
+			// Decode (about) a block's worth of characters before checking for ASCII again
+			if( !_decodeChars( c, end - c > 16 ? c + 16 : end, end, num ) )
+				return false;
+		}
+		num_chars = num;
+		return true;
+	}
+	EON_NO_TEST( string_iterator, _scanUtf8Sse2 );
+
+
+	// Error bits for the AVX2 kernel's lookup tables.
+	// Each names an invalid pair of bytes, 'byte 1' followed by 'byte 2'.
+	static const uint8_t TooShort{ 1 << 0 };		// 11______ 0_______ or 11______ 11______
+	static const uint8_t TooLong{ 1 << 1 };			// 0_______ 10______
+	static const uint8_t Overlong3{ 1 << 2 };		// 11100000 100_____
+	static const uint8_t TooLarge{ 1 << 3 };		// 11110100 1001____ and above
+	static const uint8_t Surrogate{ 1 << 4 };		// 11101101 101_____
+	static const uint8_t Overlong2{ 1 << 5 };		// 1100000_ 10______
+	static const uint8_t TooLarge1000{ 1 << 6 };	// 11110101 1000____ and above
+	static const uint8_t Overlong4{ 1 << 6 };		// 11110000 1000____
+	static const uint8_t TwoConts{ 1 << 7 };		// 10______ 10______
+	static const uint8_t Carry{ TooShort | TooLong | TwoConts };
+
+	// Make a 32 byte lookup table from 16 values (vpshufb looks up within each 128-bit lane).
+#	define EON_LOOKUP16( v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 )\
+	_mm256_setr_epi8(\
+		(char)( v0 ), (char)( v1 ), (char)( v2 ), (char)( v3 ), (char)( v4 ), (char)( v5 ), (char)( v6 ), (char)( v7 ),\
+		(char)( v8 ), (char)( v9 ), (char)( v10 ), (char)( v11 ), (char)( v12 ), (char)( v13 ), (char)( v14 ), (char)( v15 ),\
+		(char)( v0 ), (char)( v1 ), (char)( v2 ), (char)( v3 ), (char)( v4 ), (char)( v5 ), (char)( v6 ), (char)( v7 ),\
+		(char)( v8 ), (char)( v9 ), (char)( v10 ), (char)( v11 ), (char)( v12 ), (char)( v13 ), (char)( v14 ), (char)( v15 ) )
+
+	// Get 'input' shifted 'N' bytes towards higher positions, with the last bytes of 'prev' shifted in.
+	template<int N>
+	EON_TARGET_AVX2 static inline __m256i _prevBytes( __m256i input, __m256i prev ) noexcept {
+		return _mm256_alignr_epi8( input, _mm256_permute2x128_si256( prev, input, 0x21 ), 16 - N ); }
+
+	EON_TARGET_AVX2 static inline __m256i _highNibbles( __m256i input ) noexcept {
+		return _mm256_and_si256( _mm256_srli_epi16( input, 4 ), _mm256_set1_epi8( 0x0F ) ); }
+
+	EON_TARGET_AVX2 static inline __m256i _utf8Errors( __m256i input, __m256i prev_input ) noexcept
+	{
+		// Invalid pairs of bytes
+		auto prev1 = _prevBytes<1>( input, prev_input );
+		auto byte_1_high = _mm256_shuffle_epi8( EON_LOOKUP16(
+			TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong,
+			TwoConts, TwoConts, TwoConts, TwoConts,
+			TooShort | Overlong2,
+			TooShort,
+			TooShort | Overlong3 | Surrogate,
+			TooShort | TooLarge | TooLarge1000 | Overlong4 ), _highNibbles( prev1 ) );
+		auto byte_1_low = _mm256_shuffle_epi8( EON_LOOKUP16(
+			Carry | Overlong3 | Overlong2 | Overlong4,
+			Carry | Overlong2,
+			Carry,
+			Carry,
+			Carry | TooLarge,
+			Carry | TooLarge | TooLarge1000,
+			Carry | TooLarge | TooLarge1000,
+			Carry | TooLarge | TooLarge1000,
+			Carry | TooLarge | TooLarge1000,
+			Carry | TooLarge | TooLarge1000,
+			Carry | TooLarge | TooLarge1000,
+			Carry | TooLarge | TooLarge1000,
+			Carry | TooLarge | TooLarge1000,
+			Carry | TooLarge | TooLarge1000 | Surrogate,
+			Carry | TooLarge | TooLarge1000,
+			Carry | TooLarge | TooLarge1000 ), _mm256_and_si256( prev1, _mm256_set1_epi8( 0x0F ) ) );
+		auto byte_2_high = _mm256_shuffle_epi8( EON_LOOKUP16(
+			TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort,
+			TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge1000 | Overlong4,
+			TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge,
+			TooLong | Overlong2 | TwoConts | Surrogate | TooLarge,
+			TooLong | Overlong2 | TwoConts | Surrogate | TooLarge,
+			TooShort, TooShort, TooShort, TooShort ), _highNibbles( input ) );
+		auto special = _mm256_and_si256( _mm256_and_si256( byte_1_high, byte_1_low ), byte_2_high );
+
+		// Third and fourth bytes of 3 and 4 byte characters must be continuations, which
+		// the pair checks above reported as 'TwoConts'. Every other 'TwoConts' is an error.
+		auto third = _mm256_subs_epu8( _prevBytes<2>( input, prev_input ), _mm256_set1_epi8( char( 0xE0 - 0x80 ) ) );
+		auto fourth = _mm256_subs_epu8( _prevBytes<3>( input, prev_input ), _mm256_set1_epi8( char( 0xF0 - 0x80 ) ) );
+		auto must_be_cont = _mm256_and_si256( _mm256_or_si256( third, fourth ), _mm256_set1_epi8( char( 0x80 ) ) );
+		return _mm256_xor_si256( must_be_cont, special );
+	}
+
+	struct _Utf8Avx2State
+	{
+		__m256i Error, PrevInput, PrevIncomplete;
+		index_t NumChars{ 0 };
+	};
+
+	EON_TARGET_AVX2 static inline void _scanUtf8BlockAvx2( _Utf8Avx2State& state, __m256i input ) noexcept
+	{
+		// Bytes greater than -65 (signed) are not continuation bytes, and so start a character
+		state.NumChars += popCount( static_cast<uint32_t>(
+			_mm256_movemask_epi8( _mm256_cmpgt_epi8( input, _mm256_set1_epi8( -65 ) ) ) ) );
+		if( _mm256_movemask_epi8( input ) == 0 )
+		{
+			// ASCII fast path: only need to check that the previous block didn't end mid-character
+			state.Error = _mm256_or_si256( state.Error, state.PrevIncomplete );
+			state.PrevIncomplete = _mm256_setzero_si256();
 		}
-		if( state != UTF8_ACCEPT )
+		else
+		{
+			state.Error = _mm256_or_si256( state.Error, _utf8Errors( input, state.PrevInput ) );
+
+			// Anything above these in the last three bytes starts a character that continues in the next block
+			state.PrevIncomplete = _mm256_subs_epu8( input, _mm256_setr_epi8(
+				-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+				-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+				char( 0xF0 - 1 ), char( 0xE0 - 1 ), char( 0xC0 - 1 ) ) );
+		}
+		state.PrevInput = input;
+	}
+
+	EON_TARGET_AVX2 static bool _scanUtf8Avx2( const char* str, index_t size, index_t& num_chars ) noexcept
+	{
+		_Utf8Avx2State state;
+		state.Error = state.PrevInput = state.PrevIncomplete = _mm256_setzero_si256();
+		auto c = str, end = str + size;
+		for( ; end - c >= 32; c += 32 )
+		{
+			_scanUtf8BlockAvx2( state, _mm256_loadu_si256( reinterpret_cast<const __m256i*>( c ) ) );
+
+			// Bail out early on errors, but don't test for it on every block
+			if( ( ( c - str ) & 0x3FF ) == 0x3E0 && !_mm256_testz_si256( state.Error, state.Error ) )
+				return false;
+		}
+
+		// Always scan a final, zero padded, block. This will catch a character left incomplete at the end.
+		alignas( 32 ) char last[ 32 ]{ 0 };
+		if( c != end )
+			memcpy( last, c, end - c );
+		_scanUtf8BlockAvx2( state, _mm256_load_si256( reinterpret_cast<const __m256i*>( last ) ) );
+		num_chars = state.NumChars - ( 32 - ( end - c ) );
+		return _mm256_testz_si256( state.Error, state.Error ) != 0;
+	}
+	EON_NO_TEST( string_iterator, _scanUtf8Avx2 );
+#endif
+
+	index_t string_iterator::countUtf8Chars( const char* str, index_t size )
+	{
+		index_t num = 0;
+		if( !scanUtf8( str, size, num ) )
 			throw InvalidUTF8( "Not a valid UTF-8 string value" );
 		return num;
 	}
@@ -837,6 +1049,81 @@ namespace eon
 	EON_TEST( string_iterator, countUtf8Chars, UTF8,
 		EON_EQ( 6, string_iterator::countUtf8Chars( u8"\u00D8\u20A0\u0153\u2122\u00A9\u00B5", 14 ) ) );
 
+	bool string_iterator::scanUtf8( const char* str, index_t size, index_t& num_chars ) noexcept
+	{
+		// Setting up the SIMD kernels isn't worth it for very short strings
+		return size < 32 ? _scanUtf8Scalar( str, size, num_chars ) : scanUtf8( str, size, num_chars, cpuSimd() );
+	}
+	EON_TEST_2STEP( string_iterator, scanUtf8, empty,
+		index_t num_chars = 99,
+		EON_TRUE( string_iterator::scanUtf8( "", 0, num_chars ) && num_chars == 0 ) );
+	EON_TEST_2STEP( string_iterator, scanUtf8, short_UTF8,
+		index_t num_chars = 0,
+		EON_TRUE( string_iterator::scanUtf8( u8"Ø₠œ™©µ", 14, num_chars ) && num_chars == 6 ) );
+	EON_TEST_2STEP( string_iterator, scanUtf8, short_invalid,
+		index_t num_chars = 0,
+		EON_FALSE( string_iterator::scanUtf8( "ab\xC3", 3, num_chars ) ) );
+
+	bool string_iterator::scanUtf8( const char* str, index_t size, index_t& num_chars, simd kernel ) noexcept
+	{
+#ifdef EON_X86
+		switch( useSimd( kernel ) )
+		{
+			case simd::avx2:
+				return _scanUtf8Avx2( str, size, num_chars );
+			case simd::sse2:
+				return _scanUtf8Sse2( str, size, num_chars );
+			default:
+				break;
+		}
+#endif
+		return _scanUtf8Scalar( str, size, num_chars );
+	}
+#ifdef EON_TEST_MODE
+	// Scan 'copies' copies of 'piece', with 'prefix' in front and 'suffix' at the end, using the specified kernel.
+	// Returns number of characters or [eon::no_index] if invalid.
+	static index_t _testScanUtf8( simd kernel, const char* piece, index_t copies,
+		const char* prefix = "", const char* suffix = "" )
+	{
+		std::string input{ prefix };
+		for( index_t i = 0; i < copies; ++i )
+			input += piece;
+		input += suffix;
+		index_t num_chars{ 0 };
+		return string_iterator::scanUtf8( input.c_str(), input.size(), num_chars, kernel ) ? num_chars : no_index;
+	}
+#	define EON_SCANUTF8_TESTS( kernel )\
+	EON_TEST( string_iterator, scanUtf8, kernel##_ASCII,\
+		EON_EQ( 1000, _testScanUtf8( simd::kernel, "abcdefghij", 100 ) ) );\
+	EON_TEST( string_iterator, scanUtf8, kernel##_Latin,\
+		EON_EQ( 700, _testScanUtf8( simd::kernel, u8"blåbær ", 100 ) ) );\
+	EON_TEST( string_iterator, scanUtf8, kernel##_CJK,\
+		EON_EQ( 300, _testScanUtf8( simd::kernel, u8"日本語", 100 ) ) );\
+	EON_TEST( string_iterator, scanUtf8, kernel##_4byte,\
+		EON_EQ( 201, _testScanUtf8( simd::kernel, u8"\U0001F600a", 100, "x" ) ) );\
+	EON_TEST( string_iterator, scanUtf8, kernel##_boundary,\
+		EON_EQ( 131, _testScanUtf8( simd::kernel, u8"€", 100, "0123456789012345678901234567890" ) ) );\
+	EON_TEST( string_iterator, scanUtf8, kernel##_invalid_late,\
+		EON_EQ( no_index, _testScanUtf8( simd::kernel, "abcdefghij", 100, "", "\x80" ) ) );\
+	EON_TEST( string_iterator, scanUtf8, kernel##_invalid_mid,\
+		EON_EQ( no_index, _testScanUtf8( simd::kernel, "abcdefghij", 10, "", "\xC3z0123456789012345678901234567890123" ) ) );\
+	EON_TEST( string_iterator, scanUtf8, kernel##_truncated,\
+		EON_EQ( no_index, _testScanUtf8( simd::kernel, "abcdefghij", 100, "", "\xE6\x97" ) ) );\
+	EON_TEST( string_iterator, scanUtf8, kernel##_truncated_block,\
+		EON_EQ( no_index, _testScanUtf8( simd::kernel, "abcdefghij", 3, "", "0\xF0\x9F" ) ) );\
+	EON_TEST( string_iterator, scanUtf8, kernel##_overlong,\
+		EON_EQ( no_index, _testScanUtf8( simd::kernel, "abcdefghij", 10, "", "\xC0\xAF" ) ) );\
+	EON_TEST( string_iterator, scanUtf8, kernel##_surrogate,\
+		EON_EQ( no_index, _testScanUtf8( simd::kernel, "abcdefghij", 10, "", "\xED\xA0\x80" ) ) );\
+	EON_TEST( string_iterator, scanUtf8, kernel##_too_large,\
+		EON_EQ( no_index, _testScanUtf8( simd::kernel, "abcdefghij", 10, "", "\xF4\x90\x80\x80" ) ) );
+#else
+#	define EON_SCANUTF8_TESTS( kernel )
+#endif
+	EON_SCANUTF8_TESTS( none )
+	EON_SCANUTF8_TESTS( sse2 )
+	EON_SCANUTF8_TESTS( avx2 )
+
 
 
 	void string_iterator::_prep( const char* begin, const char* end, const char* pos ) noexcept
@@ -851,6 +1138,16 @@ namespace eon
 
 	void string_iterator::_utf8CharacterCount() noexcept
 	{
+		if( Pos == Source )
+		{
+			if( Source != SourceEnd )
+				NumChar = 0;
+			ValidUTF8 = scanUtf8( Source, SourceEnd - Source, NumSourceChars );
+			if( !ValidUTF8 )
+				NumSourceChars = SourceEnd - Source;
+			return;
+		}
+
 		char32_t state = 0;
 		char32_t cp = 0;
 		const char* cs{ nullptr };
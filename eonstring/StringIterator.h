@@ -19,6 +19,8 @@ namespace eon
 	using charsize_t = uint16_t;
 #endif
 
+	enum class simd : uint8_t;
+
 	constexpr int UTF8_ACCEPT = 0;
 	constexpr int UTF8_REJECT = 1;
 
@@ -526,6 +528,17 @@ namespace eon
 		// return the number of bytes it occupies. Zero if not invalid unicode.
 		static index_t bytesToUnicode( const char* start, const char* end, char_t& codepoint );
 
+		// Decode the character at 'pos' in a source already known to be
+		// valid UTF-8, set 'codepoint' and return the number of bytes it
+		// occupies (1-4). No checking at all!
+		static inline index_t decodeValidUtf8( const char* pos, char_t& codepoint ) noexcept {
+			auto byte = static_cast<uint8_t>( *pos );
+			if( byte < 0x80 ) { codepoint = byte; return 1; }
+			index_t size = byte >= 0xF0 ? 4 : byte >= 0xE0 ? 3 : 2;
+			codepoint = byte & ( 0x7F >> size );
+			for( index_t i = 1; i < size; ++i ) codepoint = ( codepoint << 6 ) | ( static_cast<uint8_t>( pos[ i ] ) & 0x3F );
+			return size; }
+
 		// Given a codepoint, convert it into bytes.
 		// The bytes are stored in the 'bytes' uint32_t, up to 4 of them.
 		// Returns the number of bytes used (1-4).
@@ -542,6 +555,16 @@ namespace eon
 		// Throws [eon::InvalidUTF8] if not valid!
 		static index_t countUtf8Chars( const char* str, index_t size );
 
+		// Validate the given string as UTF-8 and count the number of characters in it.
+		// Uses AVX2 or SSE2 (with an ASCII fast path) if the running CPU supports it.
+		// Returns false if not valid UTF-8, in which case 'num_chars' is undefined.
+		static bool scanUtf8( const char* str, index_t size, index_t& num_chars ) noexcept;
+
+		// Same as [scanUtf8] above, but use a specific kernel - or the best
+		// supported by the running CPU that is not above it.
+		// (Intended for testing and benchmarking.)
+		static bool scanUtf8( const char* str, index_t size, index_t& num_chars, simd kernel ) noexcept;
+
 
 
 
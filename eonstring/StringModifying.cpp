@@ -43,6 +43,7 @@ namespace eon
 	{
 		if( input.validUTF8() )
 		{
+			_dropCharIndex();
 			Bytes.append( input.begin().byteData(), input.numBytes() );
 			NumChars += input.numChars();
 			return *this;
@@ -91,6 +92,7 @@ namespace eon
 			*this += substr;
 			return iterator( Bytes.c_str(), Bytes.size(), NumChars, Bytes.c_str() + pos.numByte() );
 		}
+		_dropCharIndex();
 		Bytes.insert( pos.numByte(), substr.Bytes );
 		NumChars += substr.NumChars;
 		return iterator( Bytes.c_str(), Bytes.size(), NumChars, Bytes.c_str() + pos.numByte() );
@@ -126,6 +128,7 @@ namespace eon
 			return *this;
 		if( area.begin().numByte() + area.numBytes() > Bytes.size() )
 			area.end() = end();
+		_dropCharIndex();
 		Bytes.erase( area.begin().numByte(), area.numBytes() );
 		NumChars -= area.numChars();
 		return *this;
@@ -1,6 +1,7 @@
 ﻿#include "String.h"
 #include <eoninlinetest/InlineTest.h>
 #include <cctype>
+#include <charconv>
 #include <regex>
 #include <unordered_map>
 
@@ -12,35 +13,43 @@ namespace eon
 	// Static utility methods
 	//
 
+	// Format using std::to_chars, as the shortest representation that reads
+	// back as the same value. Fixed notation unless too long for the buffer,
+	// and always with a decimal point.
+	template<typename T>
+	static std::string _floatToString( T value )
+	{
+		char digits[ 512 ];
+		auto result = std::to_chars( digits, digits + sizeof( digits ), value, std::chars_format::fixed );
+		if( result.ec != std::errc() )
+			result = std::to_chars( digits, digits + sizeof( digits ), value );
+		std::string str( digits, result.ptr );
+		if( str.find_first_of( ".en" ) == std::string::npos )
+			str += ".0";
+		return str;
+	}
+
 	string string::toString( double value )
 	{
-		static char digits[ 480 ];
-#ifdef EON_WINDOWS
-		sprintf_s( digits, 480, "%.10f", value );
-#else
-		snprintf( digits, 480, "%.10f", value );
-#endif
-		auto size = strlen( digits );
-		for( ; digits[ size - 1 ] == '0' && digits[ size - 2 ] != '.';
-			--size )
-			;
-		return string( std::string( digits, size ), true );
+		return string( _floatToString( value ), true );
 	}
+	EON_TEST( string, toString, double_integer,
+		EON_EQ( "42.0", string::toString( 42.0 ) ) );
+	EON_TEST( string, toString, double_negative,
+		EON_EQ( "-1.23", string::toString( -1.230 ) ) );
+	EON_TEST( string, toString, double_round_trip,
+		EON_EQ( "0.30000000000000004", string::toString( 0.1 + 0.2 ) ) );
+	EON_TEST( string, toString, double_small,
+		EON_EQ( "0.000000000001", string::toString( 1e-12 ) ) );
+	EON_TEST( string, toString, double_huge,
+		EON_EQ( 303, string::toString( 1e300 ).numChars() ) );
 
 	string string::toString( long double value )
 	{
-		static char digits[ 480 ];
-#ifdef EON_WINDOWS
-		sprintf_s( digits, 480, "%.10Lf", value );
-#else
-		snprintf( digits, 480, "%.10Lf", value );
-#endif
-		auto size = strlen( digits );
-		for( ; digits[ size - 1 ] == '0' && digits[ size - 2 ] != '.';
-			--size )
-			;
-		return string( std::string( digits, size ), true );
+		return string( _floatToString( value ), true );
 	}
+	EON_TEST( string, toString, long_double,
+		EON_EQ( "12.5", string::toString( 12.5L ) ) );
 
 	const std::string& string::bom()
 	{
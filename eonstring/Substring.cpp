@@ -1,5 +1,6 @@
 ﻿#include "Substring.h"
 #include <eoninlinetest/InlineTest.h>
+#include <set>
 #include <cctype>
 
 
@@ -39,7 +40,33 @@ namespace eon
 
 	EON_NO_TEST( substring, hash32 );
 	EON_NO_TEST( substring, hash64 );
-	EON_NO_TEST( substring, hash );
+	EON_TEST( substring, hash, same_as_string,
+		EON_EQ( string( "alpha beta" ).hash(), substring( "alpha beta" ).hash() ) );
+
+#ifdef EON_TEST_MODE
+	// Hash all prefixes (length 0 to 'max_len') of a text, at two different alignments.
+	// Returns true if all prefixes hash differently and alignment doesn't matter.
+	static bool _testWyhash( size_t max_len )
+	{
+		std::string text;
+		for( size_t i = 0; i <= max_len; ++i )
+			text += static_cast<char>( 'a' + i % 26 );
+		std::string shifted = "x" + text;
+		std::set<uint64_t> seen;
+		for( size_t len = 0; len <= max_len; ++len )
+		{
+			auto value = substring::wyhash( text.c_str(), text.c_str() + len );
+			if( value != substring::wyhash( shifted.c_str() + 1, shifted.c_str() + 1 + len ) )
+				return false;
+			seen.insert( value );
+		}
+		return seen.size() == max_len + 1;
+	}
+#endif
+	EON_TEST( substring, wyhash, all_lengths,
+		EON_TRUE( _testWyhash( 200 ) ) );
+	EON_TEST( substring, wyhash, seed,
+		EON_TRUE( substring::wyhash( "alpha", "alpha" + 5, 1 ) != substring::wyhash( "alpha", "alpha" + 5, 2 ) ) );
 
 
 
@@ -154,6 +181,10 @@ namespace eon
 		EON_EQ( 1, substring( u8"Ø€Œ™©µ" ).count( char_t( 216 ) ) ) );
 	EON_TEST( substring, count, char_t_UTF8_many_in_many,
 		EON_EQ( 6, substring( u8"Ø€ØŒØ™Ø©ØµØ" ).count( char_t( 216 ) ) ) );
+	EON_TEST( substring, count, subst_UTF8_overlapping,
+		EON_EQ( 3, substring( u8"aØØØØb" ).count( substring( u8"ØØ" ) ) ) );
+	EON_TEST( substring, count, subst_UTF8_icase,
+		EON_EQ( 2, substring( u8"æØøå" ).count( substring( u8"ø" ), strcmp::icase_chr() ) ) );
 
 
 
@@ -164,7 +195,7 @@ namespace eon
 		if( !to_find.begin().bytesOnly() )
 			return substring( End.getEnd() );
 
-		auto found = _findFirst( Beg.Pos, numBytes(), to_find.begin().Pos, to_find.numBytes() );
+		auto found = findBytes( Beg.Pos, numBytes(), to_find.begin().Pos, to_find.numBytes() );
 		if( found != nullptr )
 		{
 			return substring( string_iterator( Beg, found, found - Beg.Source ),
@@ -225,6 +256,74 @@ namespace eon
 			return substring( End.getEnd() );
 	}
 
+	substring substring::_utf8FindFirst( const substring& to_find ) const noexcept
+	{
+		auto found = findBytes( Beg.Pos, numBytes(), to_find.Beg.Pos, to_find.numBytes() );
+		if( found == nullptr )
+			return substring( End.getEnd() );
+		index_t num_chars{ 0 };
+		string_iterator::scanUtf8( Beg.Pos, found - Beg.Pos, num_chars );
+		string_iterator first( Beg, found, Beg.NumChar + num_chars );
+		return substring( first, string_iterator( Beg, found + to_find.numBytes(), first.NumChar + to_find.numChars() ) );
+	}
+
+	substring substring::_utf8FindFirst( char_t to_find ) const noexcept
+	{
+		uint32_t bytes{ 0 };
+		if( !isValidCodepoint( to_find ) )
+			return substring( End.getEnd() );
+		auto size = string_iterator::unicodeToBytes( to_find, bytes );
+		auto found = findBytes( Beg.Pos, numBytes(), reinterpret_cast<const char*>( &bytes ), size );
+		if( found == nullptr )
+			return substring( End.getEnd() );
+		index_t num_chars{ 0 };
+		string_iterator::scanUtf8( Beg.Pos, found - Beg.Pos, num_chars );
+		string_iterator first( Beg, found, Beg.NumChar + num_chars );
+		return substring( first, string_iterator( Beg, found + size, first.NumChar + 1 ) );
+	}
+	EON_NO_TEST( substring, _utf8FindFirst );
+
+	substring substring::_utf8FindLast( const substring& to_find ) const noexcept
+	{
+		auto area = lowToHigh();
+		auto needle = to_find.lowToHigh();
+		auto found = findLastBytes( area.Beg.Pos, area.numBytes(), needle.Beg.Pos, needle.numBytes() );
+		if( found == nullptr )
+			return substring( End.getEnd() );
+		index_t num_chars{ 0 };
+		auto found_end = found + needle.numBytes();
+		string_iterator::scanUtf8( found_end, area.End.Pos - found_end, num_chars );
+		string_iterator last( area.End, found_end, area.End.NumChar - num_chars );
+		return substring( string_iterator( area.End, found, last.NumChar - needle.numChars() ), last );
+	}
+
+	substring substring::_utf8FindLast( char_t to_find ) const noexcept
+	{
+		uint32_t bytes{ 0 };
+		if( !isValidCodepoint( to_find ) )
+			return substring( End.getEnd() );
+		auto size = string_iterator::unicodeToBytes( to_find, bytes );
+		auto area = lowToHigh();
+		auto found = findLastBytes( area.Beg.Pos, area.numBytes(), reinterpret_cast<const char*>( &bytes ), size );
+		if( found == nullptr )
+			return substring( End.getEnd() );
+		index_t num_chars{ 0 };
+		string_iterator::scanUtf8( found + size, area.End.Pos - ( found + size ), num_chars );
+		string_iterator last( area.End, found + size, area.End.NumChar - num_chars );
+		return substring( string_iterator( area.End, found, last.NumChar - 1 ), last );
+	}
+	EON_NO_TEST( substring, _utf8FindLast );
+
+	index_t substring::_utf8Count( char_t to_count ) const noexcept
+	{
+		uint32_t bytes{ 0 };
+		if( !isValidCodepoint( to_count ) )
+			return 0;
+		auto size = string_iterator::unicodeToBytes( to_count, bytes );
+		return countBytes( Beg.Pos, numBytes(), reinterpret_cast<const char*>( &bytes ), size );
+	}
+	EON_NO_TEST( substring, _utf8Count );
+
 	void substring::_bypassSection( char_t start_sect, char_t end_sect, string_iterator& i ) const
 	{
 		int sections = 1;
@@ -254,21 +353,6 @@ namespace eon
 		}
 	}
 
-	const char* substring::_findFirst( const char* source, index_t source_size,
-		const char* substr, index_t substr_size ) const noexcept
-	{
-		if( substr_size > source_size )
-			return nullptr;
-		const char* end = source + source_size - ( substr_size - 1 );
-		for( auto c = _findFirst( source, end - source, *substr );
-			c != nullptr && c != end;
-			c = _findFirst( c + 1, end - ( c + 1 ), *substr ) )
-		{
-			if( memcmp( c + 1, substr + 1, substr_size - 1 ) == 0 )
-				return c;
-		}
-		return nullptr;
-	}
 	const char* substring::_findLast( const char* str, index_t str_size, char chr ) noexcept
 	{
 		for( auto c = str, end = str - str_size; c != end; --c )
@@ -2,6 +2,7 @@
 #include "StringIterator.h"
 #include "Locale.h"
 #include "Compare.h"
+#include <cstring>
 
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -254,6 +255,9 @@ namespace eon
 
 		// Convert unsigned or signed integer string into long_t (signed 64-bit integer).
 		// Assumes [numeralsOnly] or [isSignedInteger] is true. (Will not check!)
+		// NOTE: All number conversions parse ASCII digits directly (integers
+		//       eight digits at a time, floating point numbers using
+		//       std::from_chars), other numerals one character at a time.
 		long_t toLongT() const noexcept;
 
 		// Convert unsigned or signed integer string into int_t (signed 32-bit integer).
@@ -272,14 +276,12 @@ namespace eon
 		// Convert unsigned or signed floating point string into flt_t (64-bit float).
 		// Assumes [numeralsOnly] or [isFloatingPoint] is true. (Will not check!)
 		// Will use 'custom_locale' if specified and the default Eon locale if not!
-		inline high_t toFltT( const locale* custom_locale = nullptr ) const noexcept {
-			return static_cast<flt_t>( toHighT( custom_locale ) ); }
+		flt_t toFltT( const locale* custom_locale = nullptr ) const noexcept;
 
 		// Convert unsigned or signed floating point string into low_t (32-bit float).
 		// Assumes [numeralsOnly] or [isFloatingPoint] is true. (Will not check!)
 		// Will use 'custom_locale' if specified and the default Eon locale if not!
-		inline low_t toLowT( const locale* custom_locale = nullptr ) const noexcept {
-			return static_cast<low_t>( toHighT( custom_locale ) ); }
+		low_t toLowT( const locale* custom_locale = nullptr ) const noexcept;
 
 		// Convert unsigned integer string into index_t.
 		// Assumes [numeralsOnly] or [isUInt] is true. (Will not check!)
@@ -353,11 +355,11 @@ namespace eon
 		static const uint64_t FNV_OFFSET64{ 14695981039346656037LLU };
 		inline uint32_t hash32() const noexcept { return hash32( Beg.byteData(), End.byteData() ); }
 		inline uint64_t hash64() const noexcept { return hash64( Beg.byteData(), End.byteData() ); }
-#if defined(_WIN64) || defined(__x86_64__)
-		inline size_t hash() const noexcept { return hash64( Beg.byteData(), End.byteData() ); }
-#else
-		inline size_t hash() const noexcept { return hash32( Beg.byteData(), End.byteData() ); }
-#endif
+
+		// Get a 'size_t' size hash value for use in hash tables.
+		// Uses [eon::substring::wyhash], which is much faster than FNV-1a on
+		// all but the shortest strings.
+		inline size_t hash() const noexcept { return static_cast<size_t>( wyhash( Beg.byteData(), End.byteData() ) ); }
 
 		// Static hash method for raw bytes
 		static inline uint32_t hash32( const char* begin, const char* end, uint32_t h = FNV_OFFSET32 ) noexcept {
@@ -365,6 +367,87 @@ namespace eon
 		static inline uint64_t hash64( const char* begin, const char* end, uint64_t h = FNV_OFFSET64 ) noexcept {
 			for( auto c = begin; c != end; ++c ) { h ^= static_cast<unsigned char>( *c ); h *= FNV_PRIME64; } return h; }
 
+		// Word-at-a-time hash for raw bytes, based on Wang Yi's public domain
+		// wyhash (https://github.com/wangyi-fudan/wyhash). Reads 8 bytes at a
+		// time (16 or 48 per round) and mixes with 64x64->128 bit multiplies.
+		static inline uint64_t wyhash( const char* begin, const char* end, uint64_t seed = 0 ) noexcept
+		{
+			auto p = reinterpret_cast<const unsigned char*>( begin );
+			auto len = static_cast<size_t>( end - begin );
+			seed ^= _wyMix( seed ^ WY_SECRET[ 0 ], WY_SECRET[ 1 ] );
+			uint64_t a{ 0 }, b{ 0 };
+			if( len <= 16 )
+			{
+				if( len >= 4 )
+				{
+					auto quarter = ( len >> 3 ) << 2;
+					a = ( _wyRead4( p ) << 32 ) | _wyRead4( p + quarter );
+					b = ( _wyRead4( p + len - 4 ) << 32 ) | _wyRead4( p + len - 4 - quarter );
+				}
+				else if( len > 0 )
+					a = ( static_cast<uint64_t>( p[ 0 ] ) << 16 ) | ( static_cast<uint64_t>( p[ len >> 1 ] ) << 8 )
+						| p[ len - 1 ];
+			}
+			else
+			{
+				auto i = len;
+				if( i > 48 )
+				{
+					auto see1 = seed, see2 = seed;
+					do
+					{
+						seed = _wyMix( _wyRead8( p ) ^ WY_SECRET[ 1 ], _wyRead8( p + 8 ) ^ seed );
+						see1 = _wyMix( _wyRead8( p + 16 ) ^ WY_SECRET[ 2 ], _wyRead8( p + 24 ) ^ see1 );
+						see2 = _wyMix( _wyRead8( p + 32 ) ^ WY_SECRET[ 3 ], _wyRead8( p + 40 ) ^ see2 );
+						p += 48;
+						i -= 48;
+					} while( i > 48 );
+					seed ^= see1 ^ see2;
+				}
+				while( i > 16 )
+				{
+					seed = _wyMix( _wyRead8( p ) ^ WY_SECRET[ 1 ], _wyRead8( p + 8 ) ^ seed );
+					i -= 16;
+					p += 16;
+				}
+				a = _wyRead8( p + i - 16 );
+				b = _wyRead8( p + i - 8 );
+			}
+			a ^= WY_SECRET[ 1 ];
+			b ^= seed;
+			_wyMultiply( a, b );
+			return _wyMix( a ^ WY_SECRET[ 0 ] ^ len, b ^ WY_SECRET[ 1 ] );
+		}
+
+	private:
+		static constexpr uint64_t WY_SECRET[ 4 ]{
+			0xa0761d6478bd642fLLU, 0xe7037ed1a0b428dbLLU, 0x8ebc6af09c88c6e3LLU, 0x589965cc75374cc3LLU };
+
+		// Replace 'a' and 'b' with the low and high 64 bits of 'a * b'.
+		static inline void _wyMultiply( uint64_t& a, uint64_t& b ) noexcept
+		{
+#if defined( __SIZEOF_INT128__ )
+			auto product = static_cast<__uint128_t>( a ) * b;
+			a = static_cast<uint64_t>( product );
+			b = static_cast<uint64_t>( product >> 64 );
+#else
+			uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<uint32_t>( a ), lb = static_cast<uint32_t>( b );
+			uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + ( rm0 << 32 );
+			uint64_t carry = t < rl ? 1 : 0;
+			uint64_t lo = t + ( rm1 << 32 );
+			carry += lo < t ? 1 : 0;
+			uint64_t hi = rh + ( rm0 >> 32 ) + ( rm1 >> 32 ) + carry;
+			a = lo;
+			b = hi;
+#endif
+		}
+		static inline uint64_t _wyMix( uint64_t a, uint64_t b ) noexcept { _wyMultiply( a, b ); return a ^ b; }
+		static inline uint64_t _wyRead8( const unsigned char* p ) noexcept {
+			uint64_t value; std::memcpy( &value, p, 8 ); return value; }
+		static inline uint64_t _wyRead4( const unsigned char* p ) noexcept {
+			uint32_t value; std::memcpy( &value, p, 4 ); return value; }
+	public:
+
 
 
 
@@ -789,6 +872,8 @@ namespace eon
 				return findFirst( to_find.lowToHigh(), cmp );
 			if( Beg.bytesOnly() && typeid( cmp ) == typeid( strcmp::byte ) )
 				return _optimizedFindFirst( to_find );
+			else if( _exactCompare( cmp ) && Beg.ValidUTF8 && to_find.Beg.ValidUTF8 )
+				return _utf8FindFirst( to_find );
 			for( string_iterator i = begin(); i != end(); ++i )
 			{
 				string_iterator i_beg = i, j = to_find.begin();
@@ -816,6 +901,8 @@ namespace eon
 				return lowToHigh().findFirst( to_find, cmp );
 			if( Beg.bytesOnly() && typeid( cmp ) == typeid( strcmp::byte ) )
 				return _optimizedFindFirst( to_find );
+			else if( _exactCompare( cmp ) && Beg.ValidUTF8 )
+				return _utf8FindFirst( to_find );
 			for( string_iterator i = begin(); i != end(); ++i )
 			{
 				if( cmp( *i, to_find ) == 0 )
@@ -849,7 +936,9 @@ namespace eon
 				return highToLow().findLast( to_find.isLowToHigh() ? to_find.highToLow() : to_find, cmp );
 			else if( to_find.isLowToHigh() )
 				return findLast( to_find.highToLow(), cmp );
-			if( Beg.bytesOnly() && typeid( cmp ) == typeid( strcmp::byte ) )
+			if( _exactCompare( cmp ) && Beg.ValidUTF8 && to_find.Beg.ValidUTF8 )
+				return _utf8FindLast( to_find );
+			else if( Beg.bytesOnly() && typeid( cmp ) == typeid( strcmp::byte ) )
 				return _optimizedFindLast( to_find );
 			for( string_iterator pos = begin(); pos != end(); --pos )
 			{
@@ -878,7 +967,9 @@ namespace eon
 				return substring( End.getEnd() );
 			else if( isLowToHigh() )
 				return highToLow().findLast( to_find, cmp );
-			if( Beg.bytesOnly() && typeid( cmp ) == typeid( strcmp::byte ) )
+			if( _exactCompare( cmp ) && Beg.ValidUTF8 )
+				return _utf8FindLast( to_find );
+			else if( Beg.bytesOnly() && typeid( cmp ) == typeid( strcmp::byte ) )
 				return _optimizedFindLast( to_find );
 			for( string_iterator i = Beg; i != End; --i )
 			{
@@ -1262,6 +1353,8 @@ namespace eon
 				return lowToHigh().count( to_count.isHighToLow() ? to_count.lowToHigh() : to_count, cmp );
 			else if( to_count.isHighToLow() )
 				return count( to_count.lowToHigh(), cmp );
+			if( _exactCompare( cmp ) && Beg.ValidUTF8 && to_count.Beg.ValidUTF8 )
+				return countBytes( Beg.Pos, numBytes(), to_count.Beg.Pos, to_count.numBytes() );
 			index_t cnt = 0;
 			auto found = findFirst( to_count, cmp );
 			for( ; found; ++cnt )
@@ -1279,6 +1372,8 @@ namespace eon
 				return 0;
 			else if( isHighToLow() )
 				return lowToHigh().count( to_count, cmp );
+			if( _exactCompare( cmp ) && Beg.ValidUTF8 )
+				return _utf8Count( to_count );
 			index_t cnt = 0;
 			for( string_iterator i = begin(); i != end(); ++i )
 			{
@@ -1291,6 +1386,45 @@ namespace eon
 
 
 
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Raw Byte Searching
+		//
+		// Searching in valid UTF-8 using [eon::strcmp::byte] or
+		// [eon::strcmp::chr] is done on the raw bytes using these. (A valid
+		// UTF-8 sequence can only match another at character boundaries.)
+		//
+	public:
+
+		// Find first occurrence of 'needle' in 'source'.
+		// Candidate positions are found by comparing blocks of bytes with the
+		// first and last needle byte, using AVX2 or SSE2 if the running CPU
+		// supports it. Without SIMD, long needles are searched for using
+		// Boyer-Moore-Horspool.
+		// Returns nullptr if not found or if 'needle' is empty.
+		static const char* findBytes(
+			const char* source, index_t source_size, const char* needle, index_t needle_size ) noexcept;
+
+		// Find last occurrence of 'needle' in 'source'.
+		// Returns nullptr if not found or if 'needle' is empty.
+		static const char* findLastBytes(
+			const char* source, index_t source_size, const char* needle, index_t needle_size ) noexcept;
+
+		// Same as [findBytes] and [findLastBytes] above, but use a specific
+		// kernel - or the best supported by the running CPU that is not above
+		// it. (Intended for testing and benchmarking.)
+		static const char* findBytes( const char* source, index_t source_size,
+			const char* needle, index_t needle_size, simd kernel ) noexcept;
+		static const char* findLastBytes( const char* source, index_t source_size,
+			const char* needle, index_t needle_size, simd kernel ) noexcept;
+
+		// Count occurrences of 'needle' in 'source', including overlaps.
+		static index_t countBytes(
+			const char* source, index_t source_size, const char* needle, index_t needle_size ) noexcept;
+
+
+
+
 		///////////////////////////////////////////////////////////////////////
 		//
 		// Helpers
@@ -1302,12 +1436,23 @@ namespace eon
 		substring _optimizedFindLast( const substring& to_find ) const noexcept;
 		substring _optimizedFindLast( char_t to_find ) const noexcept;
 
+		// Check if a compare predicate compares code points as they are.
+		template<typename compare_predicate>
+		static inline bool _exactCompare( const compare_predicate& cmp ) noexcept {
+			return typeid( cmp ) == typeid( strcmp::byte ) || typeid( cmp ) == typeid( strcmp::chr ); }
+
+		// Search for the bytes of 'to_find' in (valid UTF-8) 'this', and
+		// count characters from the nearest end to get the match position.
+		substring _utf8FindFirst( const substring& to_find ) const noexcept;
+		substring _utf8FindFirst( char_t to_find ) const noexcept;
+		substring _utf8FindLast( const substring& to_find ) const noexcept;
+		substring _utf8FindLast( char_t to_find ) const noexcept;
+		index_t _utf8Count( char_t to_count ) const noexcept;
+
 		void _bypassSection( char_t start_sect, char_t end_sect, string_iterator& i ) const;
 
 		static inline const char* _findFirst( const char* str, index_t str_size, char c ) noexcept {
 			return (char*)memchr( str, c, str_size ); }
-		const char* _findFirst(
-			const char* source, index_t source_size, const char* substr, index_t substr_size ) const noexcept;
 
 		static const char* _findLast( const char* str, index_t str_size, char chr ) noexcept;
 		const char* _findLast(
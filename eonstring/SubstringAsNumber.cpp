@@ -1,6 +1,9 @@
 ﻿#include "Substring.h"
+#include "Simd.h"
 #include <eoninlinetest/InlineTest.h>
 #include <cctype>
+#include <charconv>
+#include <cstring>
 
 
 namespace eon
@@ -223,8 +226,119 @@ namespace eon
 		string_iterator I;
 	};
 
+	///////////////////////////////////////////////////////////////////////////
+	//
+	// ASCII fast path
+	//
+
+	// Check if eight bytes are all ASCII digits.
+	static inline bool _eightDigits( uint64_t bytes ) noexcept {
+		return ( ( ( bytes + 0x4646464646464646 ) | ( bytes - 0x3030303030303030 ) ) & 0x8080808080808080 ) == 0; }
+
+	// Get the value of eight ASCII digits (little endian, first digit in the lowest byte).
+	static inline uint64_t _eightDigitsValue( uint64_t bytes ) noexcept
+	{
+		bytes -= 0x3030303030303030;
+		bytes = ( bytes * 10 ) + ( bytes >> 8 );		// Pairs of digits
+		return ( ( ( bytes & 0x000000FF000000FF ) * ( 100 + ( 1000000ULL << 32 ) ) )
+			+ ( ( ( bytes >> 16 ) & 0x000000FF000000FF ) * ( 1 + ( 10000ULL << 32 ) ) ) ) >> 32;
+	}
+
+	// Parse ASCII digits from 'c' to 'end'.
+	// Returns false if there are other characters (or none at all).
+	static bool _parseDigits( const char* c, const char* end, uint64_t& value ) noexcept
+	{
+		if( c == end )
+			return false;
+		value = 0;
+#ifdef EON_LITTLE_ENDIAN
+		for( ; end - c >= 8; c += 8 )
+		{
+			uint64_t bytes{ 0 };
+			memcpy( &bytes, c, 8 );
+			if( !_eightDigits( bytes ) )
+				return false;
+			value = value * 100000000 + _eightDigitsValue( bytes );
+		}
+#endif
+		for( ; c != end; ++c )
+		{
+			auto digit = static_cast<uint8_t>( *c - '0' );
+			if( digit > 9 )
+				return false;
+			value = value * 10 + digit;
+		}
+		return true;
+	}
+#ifdef EON_TEST_MODE
+	static uint64_t _testParseDigits( const char* str )
+	{
+		uint64_t value{ 0 };
+		return _parseDigits( str, str + strlen( str ), value ) ? value : 999;
+	}
+#endif
+	EON_TEST( substring, _parseDigits, short,
+		EON_EQ( 1234567u, _testParseDigits( "1234567" ) ) );
+	EON_TEST( substring, _parseDigits, eight,
+		EON_EQ( 12345678u, _testParseDigits( "12345678" ) ) );
+	EON_TEST( substring, _parseDigits, long,
+		EON_EQ( 18446744073709551615u, _testParseDigits( "18446744073709551615" ) ) );
+	EON_TEST( substring, _parseDigits, leading_zeros,
+		EON_EQ( 90000001u, _testParseDigits( "000000000090000001" ) ) );
+	EON_TEST( substring, _parseDigits, not_digit_in_eight,
+		EON_EQ( 999u, _testParseDigits( "1234:678" ) ) );
+	EON_TEST( substring, _parseDigits, not_digit_below,
+		EON_EQ( 999u, _testParseDigits( "1234/678" ) ) );
+	EON_TEST( substring, _parseDigits, not_digit_high,
+		EON_EQ( 999u, _testParseDigits( "1234\xB0" "678" ) ) );
+	EON_TEST( substring, _parseDigits, empty,
+		EON_EQ( 999u, _testParseDigits( "" ) ) );
+
+	// Get the bytes of an ASCII-only, low-to-high substring.
+	static inline bool _asciiBytes( const substring& str, const char*& start, const char*& end ) noexcept
+	{
+		start = str.begin().byteData();
+		end = str.end().byteData();
+		return start != nullptr && start <= end && str.numBytes() == str.numChars();
+	}
+
+	// Parse ASCII number using std::from_chars.
+	// Returns false if not ASCII or not all could be parsed.
+	template<typename T>
+	static bool _fromChars( const substring& str, const locale* custom_locale, T& value ) noexcept
+	{
+		const char* start{ nullptr }, * end{ nullptr };
+		if( !_asciiBytes( str, start, end ) )
+			return false;
+		const locale& loc = custom_locale != nullptr ? *custom_locale : locale::get();
+		if( loc.decimalSep() != '.' )
+			return false;
+		if( start != end && *start == '+' )
+			++start;
+		auto result = std::from_chars( start, end, value );
+		return result.ec == std::errc() && result.ptr == end;
+	}
+	EON_NO_TEST( substring, _fromChars );
+
+
+
+
+	///////////////////////////////////////////////////////////////////////////
+	//
+	// Conversion
+	//
+
 	long_t substring::toLongT() const noexcept
 	{
+		const char* first{ nullptr }, * last{ nullptr };
+		if( _asciiBytes( *this, first, last ) && first != last )
+		{
+			bool negative = *first == '-';
+			uint64_t value{ 0 };
+			if( _parseDigits( negative || *first == '+' ? first + 1 : first, last, value ) )
+				return negative ? static_cast<long_t>( 0 - value ) : static_cast<long_t>( value );
+		}
+
 		ToNum<long_t> to_num( begin() );
 		if( empty() )
 			return to_num.Value;
@@ -244,6 +358,17 @@ namespace eon
 		EON_EQ( 1234, substring( "1234" ).toLongT() ) );
 	EON_TEST( substring, toLongT, UTF8,
 		EON_EQ( 1234, substring( u8"١۲߃४" ).toLongT() ) );
+	EON_TEST( substring, toLongT, ASCII_long_negative,
+		EON_EQ( -9223372036854775807, substring( "-9223372036854775807" ).toLongT() ) );
+	EON_TEST( substring, toLongT, ASCII_plus,
+		EON_EQ( 12345678901, substring( "+12345678901" ).toLongT() ) );
+	EON_TEST( substring, toLongT, ASCII_minus_only,
+		EON_EQ( 0, substring( "-" ).toLongT() ) );
+	EON_TEST( substring, toLongT, not_numeral,
+		EON_EQ( 0, substring( "123456789x" ).toLongT() ) );
+	EON_TEST_2STEP( substring, toLongT, ASCII_in_UTF8,
+		string source( u8"αβγ -12345678901 δ" ),
+		EON_EQ( -12345678901, source.substr( source.begin() + 4, source.begin() + 16 ).toLongT() ) );
 
 	EON_TEST( substring, toIntT, empty,
 		EON_EQ( 0, substring( "" ).toIntT() ) );
@@ -261,6 +386,10 @@ namespace eon
 
 	high_t substring::toHighT( const locale* custom_locale ) const noexcept
 	{
+		high_t value{ 0.0 };
+		if( _fromChars( *this, custom_locale, value ) )
+			return value;
+
 		ToNum<high_t> to_num( begin() );
 		if( empty() )
 			return to_num.Value;
@@ -292,6 +421,16 @@ namespace eon
 	EON_TEST( substring, toHighT, UTF8,
 		EON_RANGE( 12.339, substring( u8"١۲.߃४" ).toHighT(), 12.341 ) );
 
+	EON_TEST( substring, toHighT, UTF8_minus,
+		EON_RANGE( -12.341, substring( u8"-١۲.߃४" ).toHighT(), -12.339 ) );
+
+	flt_t substring::toFltT( const locale* custom_locale ) const noexcept
+	{
+		flt_t value{ 0.0 };
+		if( _fromChars( *this, custom_locale, value ) )
+			return value;
+		return static_cast<flt_t>( toHighT( custom_locale ) );
+	}
 	EON_TEST( substring, toFltT, empty,
 		EON_EQ( 0, substring( "" ).toFltT() ) );
 	EON_TEST( substring, toFltT, ASCII,
@@ -299,6 +438,27 @@ namespace eon
 	EON_TEST( substring, toFltT, UTF8,
 		EON_EQ( 12.34, substring( u8"١۲.߃४" ).toFltT() ) );
 
+	EON_TEST( substring, toFltT, ASCII_signed,
+		EON_EQ( -12.34, substring( "-12.34" ).toFltT() ) );
+	EON_TEST( substring, toFltT, ASCII_plus,
+		EON_EQ( 12.34, substring( "+12.34" ).toFltT() ) );
+	EON_TEST( substring, toFltT, ASCII_no_integer,
+		EON_EQ( 0.5, substring( ".5" ).toFltT() ) );
+	EON_TEST( substring, toFltT, ASCII_round_trip,
+		EON_EQ( 0.1 + 0.2, substring( "0.30000000000000004" ).toFltT() ) );
+#ifdef EON_TEST_LOCALE_NO
+	EON_TEST_2STEP( substring, toFltT, comma,
+		eon::locale loc( "nb_NO" _UTF8 ),
+		EON_EQ( 12.34, substring( "12,34" ).toFltT( &loc ) ) );
+#endif
+
+	low_t substring::toLowT( const locale* custom_locale ) const noexcept
+	{
+		low_t value{ 0.0 };
+		if( _fromChars( *this, custom_locale, value ) )
+			return value;
+		return static_cast<low_t>( toHighT( custom_locale ) );
+	}
 	EON_TEST( substring, toLowT, empty,
 		EON_EQ( 0, substring( "" ).toLowT() ) );
 	EON_TEST( substring, toLowT, ASCII,
@@ -308,7 +468,11 @@ namespace eon
 
 	uint64_t substring::toUInt64() const noexcept
 	{
+		const char* first{ nullptr }, * last{ nullptr };
 		uint64_t value = 0;
+		if( _asciiBytes( *this, first, last ) && _parseDigits( first, last, value ) )
+			return value;
+		value = 0;
 		for( auto chr : *this )
 		{
 			value *= 10;
@@ -322,6 +486,8 @@ namespace eon
 		EON_EQ( 1234, substring( "1234" ).toUInt64() ) );
 	EON_TEST( substring, toIndex, UTF8,
 		EON_EQ( 1234, substring( u8"١۲߃४" ).toUInt64() ) );
+	EON_TEST( substring, toIndex, ASCII_long,
+		EON_EQ( 12345678901234567890u, substring( "12345678901234567890" ).toUInt64() ) );
 
 	EON_TEST( substring, toInt32, empty,
 		EON_EQ( 0, substring( "" ).toInt32() ) );
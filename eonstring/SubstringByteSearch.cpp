@@ -0,0 +1,325 @@
+#include "Substring.h"
+#include "Simd.h"
+#include <eoninlinetest/InlineTest.h>
+#include <algorithm>
+#include <cstring>
+
+
+namespace eon
+{
+	///////////////////////////////////////////////////////////////////////////
+	//
+	// Raw Byte Searching
+	//
+	// All kernels assume 1 <= needle_size <= source_size.
+	//
+
+	// Without SIMD, needles at least this long are searched for using
+	// Boyer-Moore-Horspool, which can skip ahead by up to the needle size for
+	// each mismatch. (The SIMD kernels are several times faster than
+	// Horspool on text, even for long needles.)
+	static const index_t HorspoolMinSize{ 32 };
+
+	// Check the bytes between the first and the last of a candidate match.
+	static inline bool _sameMiddle( const char* candidate, const char* needle, index_t needle_size ) noexcept {
+		return needle_size <= 2 || memcmp( candidate + 1, needle + 1, needle_size - 2 ) == 0; }
+
+
+	static const char* _findBytesScalar(
+		const char* source, index_t source_size, const char* needle, index_t needle_size ) noexcept
+	{
+		auto last = needle[ needle_size - 1 ];
+		auto end = source + source_size - needle_size + 1;		// One past the last candidate
+		for( auto c = source; c < end; ++c )
+		{
+			c = static_cast<const char*>( memchr( c, *needle, end - c ) );
+			if( c == nullptr )
+				return nullptr;
+			if( c[ needle_size - 1 ] == last && _sameMiddle( c, needle, needle_size ) )
+				return c;
+		}
+		return nullptr;
+	}
+	EON_NO_TEST( substring, _findBytesScalar );
+
+	static const char* _findLastBytesScalar(
+		const char* source, index_t source_size, const char* needle, index_t needle_size ) noexcept
+	{
+		auto first = *needle, last = needle[ needle_size - 1 ];
+		for( auto c = source + source_size - needle_size + 1; c != source; )
+		{
+			--c;
+			if( *c == first && c[ needle_size - 1 ] == last && _sameMiddle( c, needle, needle_size ) )
+				return c;
+		}
+		return nullptr;
+	}
+	EON_NO_TEST( substring, _findLastBytesScalar );
+
+	static const char* _findBytesHorspool(
+		const char* source, index_t source_size, const char* needle, index_t needle_size ) noexcept
+	{
+		index_t skip[ 256 ];
+		std::fill( skip, skip + 256, needle_size );
+		for( index_t i = 0; i < needle_size - 1; ++i )
+			skip[ static_cast<uint8_t>( needle[ i ] ) ] = needle_size - 1 - i;
+
+		auto last = needle[ needle_size - 1 ];
+		for( index_t pos = 0; pos + needle_size <= source_size; )
+		{
+			auto c = source[ pos + needle_size - 1 ];
+			if( c == last && memcmp( source + pos, needle, needle_size - 1 ) == 0 )
+				return source + pos;
+			pos += skip[ static_cast<uint8_t>( c ) ];
+		}
+		return nullptr;
+	}
+	EON_NO_TEST( substring, _findBytesHorspool );
+
+#ifdef EON_X86
+	// The SIMD kernels compare a block of candidate positions against the
+	// first needle byte and the block 'needle_size - 1' bytes later against
+	// the last needle byte. Only positions where both match are checked in
+	// full. The remainder is left to the scalar kernels.
+
+	EON_TARGET_SSE2 static const char* _findBytesSse2(
+		const char* source, index_t source_size, const char* needle, index_t needle_size ) noexcept
+	{
+		auto first = _mm_set1_epi8( *needle ), last = _mm_set1_epi8( needle[ needle_size - 1 ] );
+		index_t pos = 0;
+		for( ; pos + needle_size - 1 + 16 <= source_size; pos += 16 )
+		{
+			auto block_first = _mm_loadu_si128( reinterpret_cast<const __m128i*>( source + pos ) );
+			auto block_last = _mm_loadu_si128( reinterpret_cast<const __m128i*>( source + pos + needle_size - 1 ) );
+			auto candidates = static_cast<uint32_t>( _mm_movemask_epi8(
+				_mm_and_si128( _mm_cmpeq_epi8( block_first, first ), _mm_cmpeq_epi8( block_last, last ) ) ) );
+			for( ; candidates != 0; candidates &= candidates - 1 )
+			{
+				auto c = source + pos + lowestBit( candidates );
+				if( _sameMiddle( c, needle, needle_size ) )
+					return c;
+			}
+		}
+		return _findBytesScalar( source + pos, source_size - pos, needle, needle_size );
+	}
+	EON_NO_TEST( substring, _findBytesSse2 );
+
+	EON_TARGET_SSE2 static const char* _findLastBytesSse2(
+		const char* source, index_t source_size, const char* needle, index_t needle_size ) noexcept
+	{
+		auto first = _mm_set1_epi8( *needle ), last = _mm_set1_epi8( needle[ needle_size - 1 ] );
+		auto end = source_size - needle_size + 1;		// One past the last candidate
+		for( ; end >= 16; end -= 16 )
+		{
+			auto block_first = _mm_loadu_si128( reinterpret_cast<const __m128i*>( source + end - 16 ) );
+			auto block_last = _mm_loadu_si128(
+				reinterpret_cast<const __m128i*>( source + end - 16 + needle_size - 1 ) );
+			auto candidates = static_cast<uint32_t>( _mm_movemask_epi8(
+				_mm_and_si128( _mm_cmpeq_epi8( block_first, first ), _mm_cmpeq_epi8( block_last, last ) ) ) );
+			for( ; candidates != 0; candidates &= ~( 1u << highestBit( candidates ) ) )
+			{
+				auto c = source + end - 16 + highestBit( candidates );
+				if( _sameMiddle( c, needle, needle_size ) )
+					return c;
+			}
+		}
+		return _findLastBytesScalar( source, end + needle_size - 1, needle, needle_size );
+	}
+	EON_NO_TEST( substring, _findLastBytesSse2 );
+
+	EON_TARGET_AVX2 static const char* _findBytesAvx2(
+		const char* source, index_t source_size, const char* needle, index_t needle_size ) noexcept
+	{
+		auto first = _mm256_set1_epi8( *needle ), last = _mm256_set1_epi8( needle[ needle_size - 1 ] );
+		index_t pos = 0;
+		for( ; pos + needle_size - 1 + 32 <= source_size; pos += 32 )
+		{
+			auto block_first = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( source + pos ) );
+			auto block_last = _mm256_loadu_si256(
+				reinterpret_cast<const __m256i*>( source + pos + needle_size - 1 ) );
+			auto candidates = static_cast<uint32_t>( _mm256_movemask_epi8(
+				_mm256_and_si256( _mm256_cmpeq_epi8( block_first, first ), _mm256_cmpeq_epi8( block_last, last ) ) ) );
+			for( ; candidates != 0; candidates &= candidates - 1 )
+			{
+				auto c = source + pos + lowestBit( candidates );
+				if( _sameMiddle( c, needle, needle_size ) )
+					return c;
+			}
+		}
+		return _findBytesSse2( source + pos, source_size - pos, needle, needle_size );
+	}
+	EON_NO_TEST( substring, _findBytesAvx2 );
+
+	EON_TARGET_AVX2 static const char* _findLastBytesAvx2(
+		const char* source, index_t source_size, const char* needle, index_t needle_size ) noexcept
+	{
+		auto first = _mm256_set1_epi8( *needle ), last = _mm256_set1_epi8( needle[ needle_size - 1 ] );
+		auto end = source_size - needle_size + 1;		// One past the last candidate
+		for( ; end >= 32; end -= 32 )
+		{
+			auto block_first = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( source + end - 32 ) );
+			auto block_last = _mm256_loadu_si256(
+				reinterpret_cast<const __m256i*>( source + end - 32 + needle_size - 1 ) );
+			auto candidates = static_cast<uint32_t>( _mm256_movemask_epi8(
+				_mm256_and_si256( _mm256_cmpeq_epi8( block_first, first ), _mm256_cmpeq_epi8( block_last, last ) ) ) );
+			for( ; candidates != 0; candidates &= ~( 1u << highestBit( candidates ) ) )
+			{
+				auto c = source + end - 32 + highestBit( candidates );
+				if( _sameMiddle( c, needle, needle_size ) )
+					return c;
+			}
+		}
+		return _findLastBytesSse2( source, end + needle_size - 1, needle, needle_size );
+	}
+	EON_NO_TEST( substring, _findLastBytesAvx2 );
+#endif
+
+
+	const char* substring::findBytes(
+		const char* source, index_t source_size, const char* needle, index_t needle_size ) noexcept
+	{
+		if( needle_size == 0 || needle_size > source_size )
+			return nullptr;
+		else if( needle_size == 1 )
+			return static_cast<const char*>( memchr( source, *needle, source_size ) );
+		else
+			return findBytes( source, source_size, needle, needle_size, cpuSimd() );
+	}
+	EON_TEST( substring, findBytes, empty_needle,
+		EON_TRUE( substring::findBytes( "abc", 3, "", 0 ) == nullptr ) );
+	EON_TEST( substring, findBytes, needle_too_long,
+		EON_TRUE( substring::findBytes( "abc", 3, "abcd", 4 ) == nullptr ) );
+	EON_TEST_2STEP( substring, findBytes, one_byte,
+		const char* source = "abcabc",
+		EON_TRUE( substring::findBytes( source, 6, "c", 1 ) == source + 2 ) );
+	EON_TEST_2STEP( substring, findBytes, whole,
+		const char* source = "abcabc",
+		EON_TRUE( substring::findBytes( source, 6, source, 6 ) == source ) );
+	EON_TEST_2STEP( substring, findBytes, long_needle,
+		std::string source = std::string( 100, 'a' ) + std::string( 40, 'b' ) + "c" + std::string( 40, 'b' ),
+		EON_EQ( 101, substring::findBytes( source.c_str(), source.size(), ( std::string( 39, 'b' ) + "c" ).c_str(), 40 )
+			- source.c_str() ) );
+
+	const char* substring::findBytes( const char* source, index_t source_size,
+		const char* needle, index_t needle_size, simd kernel ) noexcept
+	{
+		if( needle_size == 0 || needle_size > source_size )
+			return nullptr;
+#ifdef EON_X86
+		switch( useSimd( kernel ) )
+		{
+			case simd::avx2:
+				return _findBytesAvx2( source, source_size, needle, needle_size );
+			case simd::sse2:
+				return _findBytesSse2( source, source_size, needle, needle_size );
+			default:
+				break;
+		}
+#endif
+		return needle_size >= HorspoolMinSize ? _findBytesHorspool( source, source_size, needle, needle_size )
+			: _findBytesScalar( source, source_size, needle, needle_size );
+	}
+#ifdef EON_TEST_MODE
+	// Search for every substring of 1 to 40 bytes at every 7th position of
+	// a pseudo-random text, and for some that are not in it, using the
+	// specified kernel (or only Horspool if 'horspool'). Compare with
+	// [std::string::find] or [std::string::rfind].
+	// Returns number of failed searches.
+	static int _testFindBytes( simd kernel, bool last, bool horspool = false )
+	{
+		std::string text;
+		uint32_t random{ 7 };
+		for( int i = 0; i < 300; ++i )
+		{
+			random = random * 1103515245 + 12345;
+			text += static_cast<char>( "abcd\xC3\xB8"[ ( random >> 16 ) % 6 ] );
+		}
+		int failed{ 0 };
+		for( index_t size = 1; size <= 40; ++size )
+		{
+			for( index_t pos = 0; pos + size <= text.size(); pos += 7 )
+			{
+				for( auto& needle : { text.substr( pos, size ), text.substr( pos, size - 1 ) + 'x' } )
+				{
+					auto expected = last ? text.rfind( needle ) : text.find( needle );
+					auto found = last ? substring::findLastBytes( text.c_str(), text.size(), needle.c_str(), size, kernel )
+						: horspool ? _findBytesHorspool( text.c_str(), text.size(), needle.c_str(), size )
+						: substring::findBytes( text.c_str(), text.size(), needle.c_str(), size, kernel );
+					if( ( found == nullptr ? std::string::npos : static_cast<size_t>( found - text.c_str() ) ) != expected )
+						++failed;
+				}
+			}
+		}
+		return failed;
+	}
+#endif
+	EON_TEST( substring, findBytes, scalar,
+		EON_EQ( 0, _testFindBytes( simd::none, false ) ) );
+	EON_TEST( substring, findBytes, sse2,
+		EON_EQ( 0, _testFindBytes( simd::sse2, false ) ) );
+	EON_TEST( substring, findBytes, avx2,
+		EON_EQ( 0, _testFindBytes( simd::avx2, false ) ) );
+	EON_TEST( substring, findBytes, horspool,
+		EON_EQ( 0, _testFindBytes( simd::none, false, true ) ) );
+
+	const char* substring::findLastBytes(
+		const char* source, index_t source_size, const char* needle, index_t needle_size ) noexcept
+	{
+		return findLastBytes( source, source_size, needle, needle_size, cpuSimd() );
+	}
+	EON_TEST( substring, findLastBytes, empty_needle,
+		EON_TRUE( substring::findLastBytes( "abc", 3, "", 0 ) == nullptr ) );
+	EON_TEST_2STEP( substring, findLastBytes, one_byte,
+		const char* source = "abcabc",
+		EON_TRUE( substring::findLastBytes( source, 6, "a", 1 ) == source + 3 ) );
+	EON_TEST_2STEP( substring, findLastBytes, whole,
+		const char* source = "abcabc",
+		EON_TRUE( substring::findLastBytes( source, 6, source, 6 ) == source ) );
+
+	const char* substring::findLastBytes( const char* source, index_t source_size,
+		const char* needle, index_t needle_size, simd kernel ) noexcept
+	{
+		if( needle_size == 0 || needle_size > source_size )
+			return nullptr;
+#ifdef EON_X86
+		switch( useSimd( kernel ) )
+		{
+			case simd::avx2:
+				return _findLastBytesAvx2( source, source_size, needle, needle_size );
+			case simd::sse2:
+				return _findLastBytesSse2( source, source_size, needle, needle_size );
+			default:
+				break;
+		}
+#endif
+		return _findLastBytesScalar( source, source_size, needle, needle_size );
+	}
+	EON_TEST( substring, findLastBytes, scalar,
+		EON_EQ( 0, _testFindBytes( simd::none, true ) ) );
+	EON_TEST( substring, findLastBytes, sse2,
+		EON_EQ( 0, _testFindBytes( simd::sse2, true ) ) );
+	EON_TEST( substring, findLastBytes, avx2,
+		EON_EQ( 0, _testFindBytes( simd::avx2, true ) ) );
+
+	index_t substring::countBytes(
+		const char* source, index_t source_size, const char* needle, index_t needle_size ) noexcept
+	{
+		if( needle_size == 0 || needle_size > source_size )
+			return 0;
+		else if( needle_size == 1 )
+			return static_cast<index_t>( std::count( source, source + source_size, *needle ) );
+		index_t count{ 0 };
+		auto end = source + source_size;
+		for( auto found = findBytes( source, source_size, needle, needle_size );
+			found != nullptr;
+			found = findBytes( found + 1, end - ( found + 1 ), needle, needle_size ) )
+			++count;
+		return count;
+	}
+	EON_TEST( substring, countBytes, empty_needle,
+		EON_EQ( 0, substring::countBytes( "abc", 3, "", 0 ) ) );
+	EON_TEST( substring, countBytes, one_byte,
+		EON_EQ( 3, substring::countBytes( "abacda", 6, "a", 1 ) ) );
+	EON_TEST( substring, countBytes, overlapping,
+		EON_EQ( 3, substring::countBytes( "aaaa", 4, "aa", 2 ) ) );
+}
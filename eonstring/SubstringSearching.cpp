@@ -82,6 +82,15 @@ namespace eon
 	EON_TEST_2STEP( substring, findFirst, char_t_UTF8_at_end,
 		string obj( u8"Ø€Œ™©µ" ),
 		EON_EQ( obj.substr( 5, 1 ), obj.substr().findFirst( char_t( 181 ) ) ) );
+	EON_TEST_2STEP( substring, findFirst, substr_UTF8_long_source,
+		string obj( string( 40, string( u8"aØ€" ) ) + u8"Œ™" + string( 40, string( u8"aØ€" ) ) ),
+		EON_EQ( obj.substr( 120, 2 ), obj.substr().findFirst( substring( u8"Œ™" ) ) ) );
+	EON_TEST_2STEP( substring, findFirst, substr_UTF8_chr,
+		string obj( u8"Ø€Œ™©µØ€Œ™©µ" ),
+		EON_EQ( obj.substr( 2, 2 ), obj.substr().findFirst( substring( u8"Œ™" ), strcmp::chr::Cmp ) ) );
+	EON_TEST_2STEP( substring, findFirst, char_t_UTF8_long_source,
+		string obj( string( 40, string( u8"aØ€" ) ) + u8"Œ™" ),
+		EON_EQ( obj.substr( 121, 1 ), obj.substr().findFirst( char_t( 8482 ) ) ) );
 	EON_TEST_2STEP( substring, findFirst, char_t_beyond_end,
 		string obj( "abcdef" ),
 		EON_EQ( obj.end(), obj.substr().findFirst( char_t( 'g' ) ).begin() ) );
@@ -176,6 +185,12 @@ namespace eon
 	EON_TEST_2STEP( substring, findLast, char_t_UTF8_at_end,
 		string obj( u8"Ø€Œ™©µØ€Œ™©µ" ),
 		EON_EQ( obj.substr( 11, 1 ), obj.substr().findLast( char_t( 181 ) ) ) );
+	EON_TEST_2STEP( substring, findLast, substr_UTF8_long_source,
+		string obj( string( 40, string( u8"aØ€" ) ) + u8"Œ™" + string( 40, string( u8"aØ€" ) ) ),
+		EON_EQ( obj.substr( 120, 2 ), obj.substr().findLast( substring( u8"Œ™" ) ) ) );
+	EON_TEST_2STEP( substring, findLast, char_t_UTF8_long_source,
+		string obj( string( u8"Œ™" ) + string( 40, string( u8"aØ€" ) ) ),
+		EON_EQ( obj.substr( 1, 1 ), obj.substr().findLast( char_t( 8482 ) ) ) );
 	EON_TEST_2STEP( substring, findLast, char_t_beyond_end,
 		string obj( "abcdefabcdef" ),
 		EON_FALSE( obj.substr().findLast( char_t( 'g' ) ) ) );
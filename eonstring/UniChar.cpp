@@ -1,49 +1,15 @@
 #include "UniChar.h"
+#include <eoninlinetest/InlineTest.h>
 
 
 namespace eon
 {
-	Characters::Characters()
-	{
-#include "other_format.cpp"
-#include "letter_upper_case.cpp"
-#include "letter_lower_case.cpp"
-#include "letter_modifier.cpp"
-#include "letter_other.cpp"
-#include "mark_space_combining.cpp"
-#include "mark_nonspacing.cpp"
-#include "number_decimal_digit.cpp"
-#include "number_letter.cpp"
-#include "number_other.cpp"
-#include "punctuation_open.cpp"
-#include "punctuation_close.cpp"
-#include "punctuation_other.cpp"
-#include "symbol_currency.cpp"
-#include "symbol_modifier.cpp"
-#include "symbol_math.cpp"
-#include "symbol_other.cpp"
-	}
+	// The category lookup table, generated at build time
+#include "charcat_table.cpp"
 
-	Characters::~Characters()
-	{
-		delete other_format;
-		delete letter_upper_case;
-		delete letter_lower_case;
-		delete letter_modifier;
-		delete letter_other;
-		delete mark_spacing_combining;
-		delete mark_nonspacing;
-		delete number_decimal_digit;
-		delete number_letter;
-		delete number_other;
-		delete punctuation_open;
-		delete punctuation_close;
-		delete punctuation_other;
-		delete symbol_currency;
-		delete symbol_modifier;
-		delete symbol_math;
-		delete symbol_other;
-	}
+
+	Characters::Characters() {}
+	Characters::~Characters() {}
 
 
 
@@ -56,102 +22,26 @@ namespace eon
 		return *Cats;
 	}
 
-	bool Characters::isLetterUpperCase( char_t c ) const noexcept
-	{
-		if( c <= 0xDE )
-			return ( c >= 0x41 && c <= 0x5A ) || ( c >= 0xC0 && c <= 0xD6 ) || ( c >= 0xD8 && c <= 0xDE );
-		else
-			return std::binary_search( letter_upper_case->begin(), letter_upper_case->end(), c );
-	}
-	bool Characters::isLetterLowerCase( char_t c ) const noexcept
-	{
-		if( c <= 0xFF )
-			return ( c >= 0x61 && c <= 0x7A ) || ( c >= 0xDF && c <= 0xF6 ) || ( c >= 0xF8 && c <= 0xFF );
-		else
-			return std::binary_search( letter_lower_case->begin(), letter_lower_case->end(), c );
-	}
-	bool Characters::isLetterModifier( char_t c ) const noexcept
-	{
-		return ( c >= 0x2B0 && c <= 0x2C1 )
-			|| ( c >= 0x2C6 && c <= 0x2D1 )
-			|| std::binary_search( letter_modifier->begin(), letter_modifier->end(), c );
-	}
-
-
-
-
-	charcat Characters::category( char_t codepoint ) const noexcept
-	{
-		if( isLetterLowerCase( codepoint ) )
-			return charcat::letter_lowercase;
-		else if( isLetterUpperCase( codepoint ) )
-			return charcat::letter_uppercase;
-		else if( isLetterTitleCase( codepoint ) )
-			return charcat::letter_titlecase;
-		else if( isLetterModifier( codepoint ) )
-			return charcat::letter_modifier;
-		else if( isLetterOther( codepoint ) )
-			return charcat::letter_other;
-
-		else if( isMarkSpacingCombining( codepoint ) )
-			return charcat::mark_spacing_combining;
-		else if( isMarkEnclosing( codepoint ) )
-			return charcat::mark_enclosing;
-		else if( isMarkNonspacing( codepoint ) )
-			return charcat::mark_nonspacing;
-
-		else if( isNumberAsciiDigit( codepoint ) )
-			return charcat::number_ascii_digit | charcat::number_decimal_digit;
-		else if( isNumberDecimalDigit( codepoint ) )
-			return charcat::number_decimal_digit;
-		else if( isNumberLetter( codepoint ) )
-			return charcat::number_letter;
-		else if( isNumberOther( codepoint ) )
-			return charcat::number_other;
-
-		else if( isPunctuationConnector( codepoint ) )
-			return charcat::punctuation_connector;
-		else if( isPunctuationDash( codepoint ) )
-			return charcat::punctuation_dash;
-		else if( isPunctuationClose( codepoint ) )
-			return charcat::punctuation_close;
-		else if( isPunctuationFinalQuote( codepoint ) )
-			return charcat::punctuation_final_quote;
-		else if( isPunctuationInitialQuote( codepoint ) )
-			return charcat::punctuation_initial_quote;
-		else if( isPunctuationOther( codepoint ) )
-			return charcat::punctuation_other;
-		else if( isPunctuationOpen( codepoint ) )
-			return charcat::punctuation_open;
-
-		else if( isSymbolCurrency( codepoint ) )
-			return charcat::symbol_currency;
-		else if( isSymbolModifier( codepoint ) )
-			return charcat::symbol_modifier;
-		else if( isSymbolMath( codepoint ) )
-			return charcat::symbol_math;
-		else if( isSymbolOther( codepoint ) )
-			return charcat::symbol_other;
-
-		else if( isSeparatorLine( codepoint ) )
-			return charcat::separator_line;
-		else if( isSeparatorParagraph( codepoint ) )
-			return charcat::separator_paragraph;
-		else if( isSeparatorSpace( codepoint ) )
-			return charcat::separator_space;
-
-		else if( isOtherControl( codepoint ) )
-			return charcat::other_control;
-		else if( isOtherFormat( codepoint ) )
-			return charcat::other_format;
-		else if( isOtherPrivateUse( codepoint ) )
-			return charcat::other_private_use;
-		else if( isOtherSurrogate( codepoint ) )
-			return charcat::other_surrogate;
-
-		else
-			return charcat::undef;
-	}
+	EON_TEST( Characters, category, ascii,
+		EON_TRUE( Characters::get().category( 'a' ) == charcat::letter_lowercase
+			&& Characters::get().category( 'Z' ) == charcat::letter_uppercase
+			&& Characters::get().category( '7' ) == ( charcat::number_ascii_digit | charcat::number_decimal_digit )
+			&& Characters::get().category( ' ' ) == charcat::separator_space
+			&& Characters::get().category( '\n' ) == charcat::other_control ) );
+	EON_TEST( Characters, category, non_ascii,
+		EON_TRUE( Characters::get().category( 0x01C5 ) == charcat::letter_titlecase
+			&& Characters::get().category( 0x0663 ) == charcat::number_decimal_digit
+			&& Characters::get().category( 0x05D0 ) == charcat::letter_other
+			&& Characters::get().category( 0x20AC ) == charcat::symbol_currency
+			&& Characters::get().category( 0x1F600 ) == charcat::symbol_other ) );
+	EON_TEST( Characters, category, outside_unicode,
+		EON_TRUE( Characters::get().category( nochar ) == charcat::undef ) );
+	EON_TEST( Characters, isLetter, all_letter_categories,
+		EON_TRUE( Characters::get().isLetter( 'x' ) && Characters::get().isLetter( 0x01C5 )
+			&& Characters::get().isLetter( 0x02B0 ) && Characters::get().isLetter( 0x05D0 )
+			&& !Characters::get().isLetter( '5' ) && !Characters::get().isLetter( 0x110000 ) ) );
+	EON_TEST( Characters, isSeparator, line,
+		EON_TRUE( Characters::get().isSeparator( 0x2028 ) ) );
 
 
 
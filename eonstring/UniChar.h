@@ -240,6 +240,10 @@ namespace eon
 	// [eon::charcat] character category, including groups of related
 	// categories.
 	//
+	// All queries are O(1) lookups in a multi-stage table generated at build
+	// time from the per-category code point lists (see
+	// tools/CharCatTableGen.cpp).
+	//
 	class Characters
 	{
 	private:
@@ -275,46 +279,38 @@ namespace eon
 
 
 		// Check if a character belongs to any of the "other" categories.
-		inline bool isOther( char_t c ) const noexcept {
-			return isOtherControl( c ) || isOtherFormat( c ) || isOtherPrivateUse( c ) || isOtherSurrogate( c ); }
+		inline bool isOther( char_t c ) const noexcept { return _in( c, charcat::other ); }
 
 		// Check if a character belongs to the "other" "control" category.
-		inline bool isOtherControl( char_t c ) const noexcept {
-			return ( c >= 0x00 && c <= 0x1F ) || ( c >= 0x7F && c <= 0x9F ); }
+		inline bool isOtherControl( char_t c ) const noexcept { return _in( c, charcat::other_control ); }
 
 		// Check if a character belongs to the "other" "format" category.
-		inline bool isOtherFormat( char_t c ) const noexcept {
-			return std::binary_search( other_format->begin(), other_format->end(), c ); }
+		inline bool isOtherFormat( char_t c ) const noexcept { return _in( c, charcat::other_format ); }
 
 		// Check if a character belongs to the "other" "private use" category.
-		inline bool isOtherPrivateUse( char_t c ) const noexcept {
-			return c == 0xE000 || c == 0xF8FF || c == 0xF0000 || c == 0xFFFFD || c == 0x100000 || c == 0x10FFFD; }
+		inline bool isOtherPrivateUse( char_t c ) const noexcept { return _in( c, charcat::other_private_use ); }
 
 		// Check if a character belongs to the "other" "surrogate" category.
-		inline bool isOtherSurrogate( char_t c ) const noexcept {
-			return c == 0xD800 || c == 0xDB7F || c == 0xDB80 || c == 0xDBFF || c == 0xDC00 || c == 0xDFFF; }
+		inline bool isOtherSurrogate( char_t c ) const noexcept { return _in( c, charcat::other_surrogate ); }
 
 
 		// Check if a character belongs to any of the "letter" categories.
-		inline bool isLetter( char_t c ) const noexcept { return isLetterUpperCase( c ) || isLetterLowerCase( c )
-			|| isLetterTitleCase( c ) || isLetterModifier( c ) || isLetterOther( c ); }
+		inline bool isLetter( char_t c ) const noexcept { return _in( c, charcat::letter ); }
 
 		// Check if a character belongs to the "letter" "upper-case" category.
-		bool isLetterUpperCase( char_t c ) const noexcept;
+		inline bool isLetterUpperCase( char_t c ) const noexcept { return _in( c, charcat::letter_uppercase ); }
 
 		// Check if a character belongs to the "letter" "lower-case" catetory.
-		bool isLetterLowerCase( char_t c ) const noexcept;
+		inline bool isLetterLowerCase( char_t c ) const noexcept { return _in( c, charcat::letter_lowercase ); }
 
 		// Check if a character belongs to the "letter" "title-case" category.
-		inline bool isLetterTitleCase( char_t c ) const noexcept {
-			return std::binary_search( letter_title_case.begin(), letter_title_case.end(), c ); }
+		inline bool isLetterTitleCase( char_t c ) const noexcept { return _in( c, charcat::letter_titlecase ); }
 
 		// Check if a character belongs to the "letter" "modifier" category.
-		bool isLetterModifier( char_t c ) const noexcept;
+		inline bool isLetterModifier( char_t c ) const noexcept { return _in( c, charcat::letter_modifier ); }
 
 		// Check if a character belongs to the "letter" "other" category.
-		inline bool isLetterOther( char_t c ) const noexcept {
-			return c >= 0xAA && std::binary_search( letter_other->begin(), letter_other->end(), c ); }
+		inline bool isLetterOther( char_t c ) const noexcept { return _in( c, charcat::letter_other ); }
 
 
 		// Check if a character is an ASCII letter.
@@ -324,15 +320,13 @@ namespace eon
 
 		// Check if a character belongs to any of the "mark" categories.
 		inline bool isMarkSpacingCombining( char_t c ) const noexcept {
-			return std::binary_search( mark_spacing_combining->begin(), mark_spacing_combining->end(), c ); }
+			return _in( c, charcat::mark_spacing_combining ); }
 
 		// Check if a character belongs to the 'Mark, Nonspacing' category.
-		inline bool isMarkNonspacing( char_t c ) const noexcept {
-			return std::binary_search( mark_nonspacing->begin(), mark_nonspacing->end(), c ); }
+		inline bool isMarkNonspacing( char_t c ) const noexcept { return _in( c, charcat::mark_nonspacing ); }
 
 		// Check if a character belongs to the "mark" "enclosing" category.
-		inline bool isMarkEnclosing( char_t c ) const noexcept {
-			return std::binary_search( mark_enclosing.begin(), mark_enclosing.end(), c ); }
+		inline bool isMarkEnclosing( char_t c ) const noexcept { return _in( c, charcat::mark_enclosing ); }
 
 
 		// Check if a character is an ASCII digit.
@@ -340,80 +334,64 @@ namespace eon
 
 
 		// Check if a character belongs to any of the "number" categories.
-		inline bool isNumber( char_t c ) const noexcept {
-			return isNumberDecimalDigit( c ) || isNumberLetter( c ) || isNumberOther( c ); }
+		inline bool isNumber( char_t c ) const noexcept { return _in( c, charcat::number ); }
 
 		// Check if a character belongs to the "number" "decimal digit" category.
-		inline bool isNumberDecimalDigit( char_t c ) const noexcept { return c <= 0x39 ? c >= 0x30 && c <= 0x39
-			: std::binary_search( number_decimal_digit->begin(), number_decimal_digit->end(), c ); }
+		inline bool isNumberDecimalDigit( char_t c ) const noexcept { return _in( c, charcat::number_decimal_digit ); }
 
 		// Check if a character belongs to the "number" "letter" category.
-		inline bool isNumberLetter( char_t c ) const noexcept { return
-			( c >= 0x2160 && c <= 0x2182 ) || std::binary_search( number_letter->begin(), number_letter->end(), c ); }
+		inline bool isNumberLetter( char_t c ) const noexcept { return _in( c, charcat::number_letter ); }
 
 		// Check if a character belongs to the "number" "other" category.
-		inline bool isNumberOther( char_t c ) const noexcept {
-			return std::binary_search( number_other->begin(), number_other->end(), c ); }
+		inline bool isNumberOther( char_t c ) const noexcept { return _in( c, charcat::number_other ); }
 
 
 		// Check if a character belongs to any of the "punctuation" categories.
-		inline bool isPunctuation( char_t c ) const noexcept {
-			return isPunctuationConnector( c ) || isPunctuationDash( c ) || isPunctuationOpen( c ) || isPunctuationClose( c )
-			|| isPunctuationInitialQuote( c ) || isPunctuationFinalQuote( c ) || isPunctuationOther( c ); }
+		inline bool isPunctuation( char_t c ) const noexcept { return _in( c, charcat::punctuation ); }
 
 		// Check if a character belongs to the "punctuation" "connector" category.
 		inline bool isPunctuationConnector( char_t c ) const noexcept {
-			return std::binary_search( punctuation_connector.begin(), punctuation_connector.end(), c ); }
+			return _in( c, charcat::punctuation_connector ); }
 
 		// Check if a character belongs to the "punctuation" "dash" category.
-		inline bool isPunctuationDash( char_t c ) const noexcept {
-			return std::binary_search( punctuation_dash.begin(), punctuation_dash.end(), c ); }
+		inline bool isPunctuationDash( char_t c ) const noexcept { return _in( c, charcat::punctuation_dash ); }
 
 		// Check if a character belongs to the "punctuation" "open" category.
-		inline bool isPunctuationOpen( char_t c ) const noexcept {
-			return std::binary_search( punctuation_open->begin(), punctuation_open->end(), c ); }
+		inline bool isPunctuationOpen( char_t c ) const noexcept { return _in( c, charcat::punctuation_open ); }
 
 		// Check if a character belongs to the "punctuation" "close" category.
-		inline bool isPunctuationClose( char_t c ) const noexcept {
-			return std::binary_search( punctuation_close->begin(), punctuation_close->end(), c ); }
+		inline bool isPunctuationClose( char_t c ) const noexcept { return _in( c, charcat::punctuation_close ); }
 
 		// Check if a character belongs to the "punctuation" "initial quote" category.
 		inline bool isPunctuationInitialQuote( char_t c ) const noexcept {
-			return std::binary_search( punctuation_initial_quote.begin(), punctuation_initial_quote.end(), c ); }
+			return _in( c, charcat::punctuation_initial_quote ); }
 
 		// Check if a character belongs to the "punctuation" "final quote" category.
 		inline bool isPunctuationFinalQuote( char_t c ) const noexcept {
-			return std::binary_search( punctuation_final_quote.begin(), punctuation_final_quote.end(), c ); }
+			return _in( c, charcat::punctuation_final_quote ); }
 
 		// Check if a character belongs to the "punctuation" "other" category.
-		inline bool isPunctuationOther( char_t c ) const noexcept {
-			return std::binary_search( punctuation_other->begin(), punctuation_other->end(), c ); }
+		inline bool isPunctuationOther( char_t c ) const noexcept { return _in( c, charcat::punctuation_other ); }
 
 
 		// Check if a character belongs to any of the "symbol" categories.
-		inline bool isSymbol( char_t c ) const noexcept {
-			return isSymbolCurrency( c ) || isSymbolModifier( c ) || isSymbolMath( c ) || isSymbolOther( c ); }
+		inline bool isSymbol( char_t c ) const noexcept { return _in( c, charcat::symbol ); }
 
 		// Check if a character belongs to the "symbol" "currency" category.
-		inline bool isSymbolCurrency( char_t c ) const noexcept {
-			return std::binary_search( symbol_currency->begin(), symbol_currency->end(), c ); }
+		inline bool isSymbolCurrency( char_t c ) const noexcept { return _in( c, charcat::symbol_currency ); }
 
 		// Check if a character belongs to the "symbol" "modifier" category.
-		inline bool isSymbolModifier( char_t c ) const noexcept {
-			return std::binary_search( symbol_modifier->begin(), symbol_modifier->end(), c ); }
+		inline bool isSymbolModifier( char_t c ) const noexcept { return _in( c, charcat::symbol_modifier ); }
 
 		// Check if a character belongs to the "symbol" "math" category.
-		inline bool isSymbolMath( char_t c ) const noexcept {
-			return std::binary_search( symbol_math->begin(), symbol_math->end(), c ); }
+		inline bool isSymbolMath( char_t c ) const noexcept { return _in( c, charcat::symbol_math ); }
 
 		// Check if a character belongs to the "symbol" "other" category.
-		inline bool isSymbolOther( char_t c ) const noexcept {
-			return std::binary_search( symbol_other->begin(), symbol_other->end(), c ); }
+		inline bool isSymbolOther( char_t c ) const noexcept { return _in( c, charcat::symbol_other ); }
 
 
 		// Check if a character belongs to any of the "separator" categories.
-		inline bool isSeparator( char_t c ) const noexcept {
-			return isSeparatorSpace( c ) || isSeparatorLine( 0 ) || isSeparatorParagraph( c ); }
+		inline bool isSeparator( char_t c ) const noexcept { return _in( c, charcat::separator ); }
 
 		// Check if a character belongs to the "separator" "line" category.
 		inline bool isSeparatorLine( char_t c ) const noexcept { return c == 0x2028; }
@@ -422,8 +400,7 @@ namespace eon
 		inline bool isSeparatorParagraph( char_t c ) const noexcept { return c == 0x2029; }
 
 		// Check if a character belongs to the "separator" "space" category.
-		inline bool isSeparatorSpace( char_t c ) const noexcept { return c == 0x20 || c == 0xA0 || c == 0x1680
-			|| ( c >= 0x2000 && c <= 0x200A ) || c == 0x202F || c == 0x205F || c == 0x3000; }
+		inline bool isSeparatorSpace( char_t c ) const noexcept { return _in( c, charcat::separator_space ); }
 
 
 		// Check if a character belongs to a named [eon::charcat] character category.
@@ -433,7 +410,35 @@ namespace eon
 
 		// Get the [eon::charcat] character category for the specified character.
 		// Returns [eon::charcat::undef] if unable to categorize.
-		charcat category( char_t codepoint ) const noexcept;
+		// NOTE: Where a character is listed in more than one category, only the first one (in [eon::charcat]
+		//       order) is returned, while the 'is<category>' methods will report membership of all of them.
+		inline charcat category( char_t codepoint ) const noexcept {
+			return static_cast<charcat>( _catValue( codepoint ).Category ); }
+
+
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Helpers
+		//
+	private:
+
+		struct CatValue
+		{
+			uint32_t Members;		// All categories the character is listed in
+			uint32_t Category;		// The one category reported by [eon::Characters::category]
+		};
+
+		// Look up a character in the category table.
+		// Stage 1 maps each block of 256 code points to a (shared) stage 2 block,
+		// which maps each code point in the block to its category value.
+		inline const CatValue& _catValue( char_t c ) const noexcept {
+			return CatValues[ c < 0x110000
+				? CatStage2[ ( static_cast<size_t>( CatStage1[ c >> 8 ] ) << 8 ) | ( c & 0xFF ) ] : 0 ]; }
+
+		inline bool _in( char_t c, charcat category ) const noexcept {
+			return ( _catValue( c ).Members & static_cast<uint32_t>( category ) ) != 0; }
 
 
 
@@ -445,42 +450,11 @@ namespace eon
 	private:
 
 		std::locale Locale;
-		const std::vector<char_t>* other_format{ nullptr };
-
-		const std::vector<char_t>* letter_upper_case{ nullptr };
-		const std::vector<char_t> letter_title_case{ 0x01C5, 0x01C8, 0x01CB, 0x01F2, 0x1F88, 0x1F89, 0x1F8A, 0x1F8B, 0x1F8C,
-			0x1F8D, 0x1F8E, 0x1F8F, 0x1F98, 0x1F99, 0x1F9A, 0x1F9B, 0x1F9C, 0x1F9D, 0x1F9E, 0x1F9F, 0x1FA8, 0x1FA9, 0x1FAA,
-			0x1FAB, 0x1FAC, 0x1FAD, 0x1FAE, 0x1FAF, 0x1FBC, 0x1FCC, 0x1FFC };
-		const std::vector<char_t>* letter_lower_case{ nullptr };
-		const std::vector<char_t>* letter_modifier{ nullptr };
-		const std::vector<char_t>* letter_other{ nullptr };
-
-		const std::vector<char_t>* mark_spacing_combining{ nullptr };
-		const std::vector<char_t>* mark_nonspacing{ nullptr };
-		const std::vector<char_t> mark_enclosing{
-			0x0488, 0x0489, 0x1ABE, 0x20DD, 0x20DE, 0x20DF, 0x20E0, 0x20E2, 0x20E3, 0x20E4, 0xA670, 0xA671, 0xA672 };
-
-		const std::vector<char_t>* number_decimal_digit{ nullptr };
-		const std::vector<char_t>* number_letter{ nullptr };
-		const std::vector<char_t>* number_other{ nullptr };
-
-		const std::vector<char_t> punctuation_connector{
-			0x005F, 0x203F, 0x2040, 0x2054, 0xFE33, 0xFE34, 0xFE4D, 0xFE4E, 0xFE4F, 0xFF3F };
-		const std::vector<char_t> punctuation_dash{
-			0x002D, 0x058A, 0x05BE, 0x1400, 0x1806, 0x2010, 0x2011, 0x2012, 0x2013, 0x2014, 0x2015, 0x2E17, 0x2E1A, 0x2E3A,
-			0x2E3B, 0x2E40, 0x301C, 0x3030, 0x30A0, 0xFE31, 0xFE32, 0xFE58, 0xFE63, 0xFF0D, 0x10EAD };
-		const std::vector<char_t>* punctuation_open{ nullptr };
-		const std::vector<char_t>* punctuation_close{ nullptr };
-		const std::vector<char_t> punctuation_initial_quote{
-			0x00AB, 0x2018, 0x201B, 0x201C, 0x201F, 0x2039, 0x2E02, 0x2E04, 0x2E09, 0x2E0C, 0x2E1C, 0x2E20 };
-		const std::vector<char_t> punctuation_final_quote{
-			0x00BB, 0x2019, 0x201D, 0x203A, 0x2E03, 0x2E05, 0x2E0A, 0x2E0D, 0x2E1D, 0x2E21 };
-		const std::vector<char_t>* punctuation_other{ nullptr };
-
-		const std::vector<char_t>* symbol_currency{ nullptr };
-		const std::vector<char_t>* symbol_modifier{ nullptr };
-		const std::vector<char_t>* symbol_math{ nullptr };
-		const std::vector<char_t>* symbol_other{ nullptr };
+
+		// Generated by CharCatTableGen
+		static const CatValue CatValues[];
+		static const uint16_t CatStage1[];
+		static const uint8_t CatStage2[];
 	};
 
 
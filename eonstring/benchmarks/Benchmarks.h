@@ -0,0 +1,149 @@
+#pragma once
+
+#include <eonbenchmark/Benchmark.h>
+#include <eonstring/String.h>
+#include <eonstring/Simd.h>
+#include <eonstring/tools/CharCatSource.h>
+#include <eonstring/NameData.h>
+#include <eonstring/HashedString.h>
+#include <eonstring/AsciiCase.h>
+
+
+namespace eon
+{
+	class Utf8Scan : public eonbench::EonBenchmark
+	{
+	protected:
+		// Get about 'size' bytes of text made by repeating 'sample'.
+		static std::string text( const char* sample, size_t size );
+
+		// Count UTF-8 characters the way [eon::string_iterator::countUtf8Chars] did before the SIMD kernels:
+		// running Bjoern Hoehrmann's DFA decoder over every byte.
+		static index_t dfaCount( const char* str, size_t size );
+
+		// Measure all kernels available on the running CPU against the DFA decoder.
+		void scanAll( const eon::string& input_name, const std::string& input );
+	};
+
+
+	class CharCategory : public eonbench::EonBenchmark
+	{
+	protected:
+		void prepare() override;
+
+		// Measure 'query' on all code points with the lookup table and with
+		// the binary search rules it was generated from.
+		template<typename NewQuery, typename OldQuery>
+		void compare( const eon::string& query_name, NewQuery new_query, OldQuery old_query )
+		{
+			auto bytes = CodePoints.size() * sizeof( char_t );
+			measure( query_name + ": binary search (before)", bytes, [&]() {
+				size_t hits{ 0 };
+				for( auto c : CodePoints )
+					hits += old_query( c ) ? 1 : 0;
+				eonbench::keep( hits ); } );
+			measure( query_name + ": lookup table", bytes, [&]() {
+				size_t hits{ 0 };
+				for( auto c : CodePoints )
+					hits += new_query( c ) ? 1 : 0;
+				eonbench::keep( hits ); } );
+		}
+
+	protected:
+		std::vector<char_t> CodePoints;
+		std::unique_ptr<CategorySource> Old;
+	};
+
+
+	class NameInterning : public eonbench::EonBenchmark
+	{
+	protected:
+		// Resolve and intern names from 1, 2, 4, ... threads, up to the number of cores (at least 4).
+		// 'Data' is [eon::NameData] or the old single-mutex design, measured for comparison.
+		template<typename Data>
+		void run( const eon::string& data_name, Data& data );
+
+		// Get the names used by the benchmarks.
+		static const std::vector<string>& names();
+
+		// Intern 'num' new names of mixed lengths and report heap use per name.
+		template<typename Data>
+		void memory( const eon::string& data_name, size_t num );
+	};
+
+
+	class StringHashing : public eonbench::EonBenchmark
+	{
+	protected:
+		void prepare() override;
+
+		// Look up all queries (hits and misses) in a map from keys to position.
+		template<typename Key, typename Hasher>
+		void lookup( const eon::string& label, const std::vector<Key>& keys, const std::vector<Key>& queries );
+
+	protected:
+		std::vector<string> Keys, Queries;
+		std::vector<hashed_string> HashedKeys, HashedQueries;
+		size_t QueryBytes{ 0 };
+	};
+
+
+	class CharIndex : public eonbench::EonBenchmark
+	{
+	protected:
+		void prepare() override;
+
+	protected:
+		string Document;
+		std::vector<std::pair<index_t, index_t>> Slices;	// (position, length)
+	};
+
+
+	class SubstringSearch : public eonbench::EonBenchmark
+	{
+	protected:
+		void prepare() override;
+
+		// Measure searching for a needle that is only found at the very end of the haystack.
+		void search( const eon::string& haystack_name, const string& haystack, const string& needle );
+
+	protected:
+		string Ascii, Utf8;
+	};
+
+
+	class SplitView : public eonbench::EonBenchmark
+	{
+	protected:
+		void prepare() override;
+
+		// Measure splitting into a vector (before) and with the lazy split view.
+		template<typename separator_t>
+		void split( const string& label, const string& text, separator_t separator );
+
+	protected:
+		string Log, Utf8Log;
+	};
+
+
+	class CaseConversion : public eonbench::EonBenchmark
+	{
+	protected:
+		void prepare() override;
+
+	protected:
+		string Ascii, Utf8, AsciiOther, Utf8Other;
+	};
+
+
+	class NumberConversion : public eonbench::EonBenchmark
+	{
+	protected:
+		void prepare() override;
+
+	protected:
+		string Integers, Floats;
+		std::vector<substring> IntegerFields, FloatFields;
+		std::vector<double> Doubles;
+	};
+}
@@ -0,0 +1,104 @@
+#include "Benchmarks.h"
+
+
+namespace eon
+{
+	// Same as [eon::strcmp::icase_utf8] was before the ASCII kernel and the
+	// lower-case table: every differing character pair goes to the facet.
+	class FacetICase
+	{
+	public:
+		inline FacetICase() : CType( &std::use_facet<std::ctype<wchar_t>>( Loc ) ) {}
+		int operator()(
+			const string_iterator& a_start,
+			const string_iterator& a_end,
+			const string_iterator& b_start,
+			const string_iterator& b_end ) const noexcept
+		{
+			string_iterator a_i = a_start, b_i = b_start;
+			int equal = 0;
+			for( ; a_i != a_end && b_i != b_end; ++a_i, ++b_i )
+			{
+				++equal;
+				if( *a_i != *b_i )
+				{
+					auto lw_a = CType->tolower( static_cast<wchar_t>( *a_i ) );
+					auto lw_b = CType->tolower( static_cast<wchar_t>( *b_i ) );
+					if( lw_a != lw_b )
+						return lw_a < lw_b ? -equal : equal;
+				}
+			}
+			return a_i != a_end ? equal + 1 : b_i != b_end ? -( equal + 1 ) : 0;
+		}
+
+	private:
+		std::locale Loc{ eon::locale::get().name().c_str() };
+		const std::ctype<wchar_t>* CType{ nullptr };
+	};
+
+	static const size_t TextSize{ 1024 * 1024 };
+
+	static string text( const char* sample, bool swap_case )
+	{
+		string str;
+		while( str.numBytes() < TextSize )
+			str += sample;
+		return swap_case ? str.upper() : str;
+	}
+
+	void CaseConversion::prepare()
+	{
+		Ascii = text( "The Quick Brown Fox jumps over the Lazy Dog, then sits down for a rest. ", false );
+		AsciiOther = text( "The Quick Brown Fox jumps over the Lazy Dog, then sits down for a rest. ", true );
+		Utf8 = text( u8"Høstens første snø falt over Ålesund; Ελληνικά κείμενα και Ωραία. ", false );
+		Utf8Other = text( u8"Høstens første snø falt over Ålesund; Ελληνικά κείμενα και Ωραία. ", true );
+	}
+
+	BENCHMARK( CaseConversion, transform )
+	{
+		for( auto str : { &Ascii, &Utf8 } )
+		{
+			string label( str == &Ascii ? "ASCII" : "UTF-8" );
+			measure( label + ": upper, character by character (before)", str->numBytes(), [&]() {
+				eonbench::keep( str->transform( str->substr(), []( char_t c, const eon::locale& loc ) {
+					return loc.toUpper( static_cast<wchar_t>( c ) ); } ).numBytes() ); } );
+			measure( label + ": upper", str->numBytes(), [&]() {
+				eonbench::keep( str->upper().numBytes() ); } );
+			measure( label + ": lower, character by character (before)", str->numBytes(), [&]() {
+				eonbench::keep( str->transform( str->substr(), []( char_t c, const eon::locale& loc ) {
+					return loc.toLower( static_cast<wchar_t>( c ) ); } ).numBytes() ); } );
+			measure( label + ": lower", str->numBytes(), [&]() {
+				eonbench::keep( str->lower().numBytes() ); } );
+		}
+	}
+
+	BENCHMARK( CaseConversion, compare )
+	{
+		FacetICase facet_cmp;
+		for( auto pair : { std::make_pair( &Ascii, &AsciiOther ), std::make_pair( &Utf8, &Utf8Other ) } )
+		{
+			string label( pair.first == &Ascii ? "ASCII" : "UTF-8" );
+			auto a = pair.first->substr(), b = pair.second->substr();
+			measure( label + ": icase compare, facet (before)", a.numBytes(), [&]() {
+				eonbench::keep( a.compare( b, facet_cmp ) ); } );
+			measure( label + ": icase compare", a.numBytes(), [&]() {
+				eonbench::keep( a.compare( b, strcmp::icase_utf8::Cmp ) ); } );
+		}
+	}
+
+	BENCHMARK( CaseConversion, kernels )
+	{
+		std::string bytes( Ascii.stdstr() );
+		for( auto kernel : { simd::none, simd::sse2, simd::avx2 } )
+		{
+			if( useSimd( kernel ) != kernel )
+				continue;
+			measure( string( "asciiUpper: " ) + simdName( kernel ), bytes.size(), [&]() {
+				asciiUpper( &bytes[ 0 ], bytes.size(), kernel );
+				eonbench::keep( bytes[ 0 ] ); } );
+			measure( string( "asciiCompareICase: " ) + simdName( kernel ), bytes.size(), [&]() {
+				eonbench::keep( asciiCompareICase(
+					Ascii.c_str(), Ascii.numBytes(), AsciiOther.c_str(), AsciiOther.numBytes(), kernel ) ); } );
+		}
+	}
+}
@@ -0,0 +1,43 @@
+#include "Benchmarks.h"
+
+
+namespace eon
+{
+	// Mixed scripts: Latin, Greek, Cyrillic, Hebrew, Arabic, Devanagari, CJK, digits, punctuation and symbols
+	static const char* Mixed{ u8"Price: 42,50 € — «Ærø» Ελληνικά Русский текст שלום عربي हिन्दी 東京 ½ + x² = y! (ok)\n" };
+	static const size_t NumCodePoints{ 1024 * 1024 };
+
+	void CharCategory::prepare()
+	{
+		eon::string sample{ Mixed };
+		CodePoints.reserve( NumCodePoints + sample.numChars() );
+		while( CodePoints.size() < NumCodePoints )
+		{
+			for( auto c : sample )
+				CodePoints.push_back( c );
+		}
+		Old = std::make_unique<CategorySource>();
+	}
+
+	BENCHMARK( CharCategory, category )
+	{
+		auto& chars = Characters::get();
+		compare( "category",
+			[&]( char_t c ) { return chars.category( c ) == charcat::letter_lowercase; },
+			[&]( char_t c ) { return Old->category( c ) == charcat::letter_lowercase; } );
+	}
+	BENCHMARK( CharCategory, isLetter )
+	{
+		auto& chars = Characters::get();
+		compare( "isLetter",
+			[&]( char_t c ) { return chars.isLetter( c ); },
+			[&]( char_t c ) { return Old->isLetter( c ); } );
+	}
+	BENCHMARK( CharCategory, isNumber )
+	{
+		auto& chars = Characters::get();
+		compare( "isNumber",
+			[&]( char_t c ) { return chars.isNumber( c ); },
+			[&]( char_t c ) { return Old->isNumber( c ); } );
+	}
+}
@@ -0,0 +1,62 @@
+#include "Benchmarks.h"
+#include <random>
+
+
+namespace eon
+{
+	static const size_t DocumentSize{ 10 * 1024 * 1024 };
+	static const size_t NumSlices{ 100 };
+
+	void CharIndex::prepare()
+	{
+		// Mostly Latin text with some Greek and CJK, about 10 MB
+		static const char* sample{ u8"Lorem ipsum dolor sit amet, æøå αβγδ 中文 consectetur.\n" };
+		std::string bytes;
+		bytes.reserve( DocumentSize + 128 );
+		while( bytes.size() < DocumentSize )
+			bytes += sample;
+		Document = std::move( bytes );
+
+		std::mt19937_64 random( 42 );
+		std::uniform_int_distribution<index_t> position( 0, Document.numChars() - 1 );
+		std::uniform_int_distribution<index_t> length( 1, 200 );
+		for( size_t i = 0; i < NumSlices; ++i )
+			Slices.push_back( { position( random ), length( random ) } );
+	}
+
+	BENCHMARK( CharIndex, substr )
+	{
+		// How [eon::string::substr] found character positions before: counting from the nearest end
+		measure( "100 random substr: counting (before)", 0, [&]() {
+			size_t bytes{ 0 };
+			auto all = Document.substr( Document.begin(), Document.end() );
+			for( auto& slice : Slices )
+				bytes += substring( all.iterator( slice.first ), all.iterator( slice.first + slice.second ) ).numBytes();
+			eonbench::keep( bytes ); } );
+		measure( "100 random substr: indexed", 0, [&]() {
+			size_t bytes{ 0 };
+			for( auto& slice : Slices )
+				bytes += Document.substr( slice.first, slice.second ).numBytes();
+			eonbench::keep( bytes ); } );
+	}
+
+	BENCHMARK( CharIndex, slice )
+	{
+		measure( "100 random slice: indexed", 0, [&]() {
+			size_t bytes{ 0 };
+			for( auto& slice : Slices )
+				bytes += Document.slice( slice.first, slice.first + slice.second ).numBytes();
+			eonbench::keep( bytes ); } );
+	}
+
+	BENCHMARK( CharIndex, build )
+	{
+		// Cost of the first positional access, which builds the index
+		measure( "Copy document and build index", Document.numBytes(), [&]() {
+			string copy( Document );
+			eonbench::keep( copy.charPos( copy.numChars() / 2 ) ); } );
+		measure( "Copy document only", Document.numBytes(), [&]() {
+			string copy( Document );
+			eonbench::keep( copy ); } );
+	}
+}
@@ -0,0 +1,163 @@
+#include "Benchmarks.h"
+#include <thread>
+#include <atomic>
+#include <new>
+#include <unordered_map>
+
+
+// Count heap allocations while 'CountAllocations' is set
+static std::atomic<bool> CountAllocations{ false };
+static std::atomic<size_t> NumAllocations{ 0 }, AllocatedBytes{ 0 };
+void* operator new( size_t size )
+{
+	if( CountAllocations.load( std::memory_order_relaxed ) )
+	{
+		++NumAllocations;
+		AllocatedBytes += size;
+	}
+	if( auto ptr = std::malloc( size > 0 ? size : 1 ) )
+		return ptr;
+	throw std::bad_alloc();
+}
+void operator delete( void* ptr ) noexcept { std::free( ptr ); }
+void operator delete( void* ptr, size_t ) noexcept { std::free( ptr ); }
+
+
+
+namespace eon
+{
+	struct hash_name { inline size_t operator()( const string* a ) const noexcept { return a->hash(); } };
+	struct eq_name { inline bool operator()( const string* a, const string* b ) const noexcept { return *a == *b; } };
+
+	// NameData the way it was before it became concurrent: one mutex for everything.
+	class MutexNameData
+	{
+	public:
+		~MutexNameData() { for( auto elm : Names ) delete elm; }
+
+		inline const string& str( const name_t& name ) { std::scoped_lock<std::mutex> lock( Lock );
+			return ( name > no_name && name.value() <= Names.size() ) ? *Names[ name.value() - 1 ] : NullStr; }
+
+		name_t name( string&& str )
+		{
+			if( !NameData::validName( str ) )
+				return no_name;
+			std::scoped_lock<std::mutex> lock( Lock );
+			if( auto found = Lookup.find( &str ); found != Lookup.end() )
+			{
+				str.clear();
+				return found->second;
+			}
+			Names.push_back( new string( std::move( str ) ) );
+			name_t id( Names.size() );
+			Lookup[ Names[ Names.size() - 1 ] ] = id;
+			return id;
+		}
+
+	private:
+		std::vector<string*> Names;
+		std::unordered_map<const string*, name_t, hash_name, eq_name> Lookup;
+		std::mutex Lock;
+		const string NullStr;
+	};
+
+
+	static const size_t NumNames{ 10000 };
+	static const size_t OpsPerThread{ 200000 };
+
+	const std::vector<string>& NameInterning::names()
+	{
+		static std::vector<string> names;
+		if( names.empty() )
+		{
+			for( size_t i = 0; i < NumNames; ++i )
+				names.push_back( string( "identifier_" + std::to_string( i * 7919 ) ) );
+		}
+		return names;
+	}
+
+	template<typename Data>
+	void NameInterning::run( const eon::string& data_name, Data& data )
+	{
+		auto& source = names();
+		std::vector<name_t> ids;
+		for( auto& str : source )
+			ids.push_back( data.name( string( str ) ) );
+
+		auto max_threads = std::max( 4u, std::thread::hardware_concurrency() );
+		for( bool intern : { false, true } )
+		{
+			for( unsigned num_threads = 1; num_threads <= max_threads; num_threads *= 2 )
+			{
+				eon::string label{ data_name + ( intern ? ": intern, " : ": resolve, " )
+					+ string( static_cast<index_t>( num_threads ) ) + " threads" };
+				auto ns = measure( label, 0, [&]() {
+					std::vector<std::thread> threads;
+					for( unsigned t = 0; t < num_threads; ++t )
+					{
+						threads.push_back( std::thread( [&, t]() {
+							size_t sum{ 0 };
+							for( size_t i = 0, pos = t * 997; i < OpsPerThread; ++i, pos = ( pos + 13 ) % NumNames )
+							{
+								if( intern )
+									sum += data.name( string( source[ pos ] ) ).value();
+								else
+									sum += data.str( ids[ pos ] ).numBytes();
+							}
+							eonbench::keep( sum ); } ) );
+					}
+					for( auto& thread : threads )
+						thread.join(); } );
+				report( label + ", ops/s", string( static_cast<index_t>( 1e9 * OpsPerThread * num_threads / ns ) ) );
+			}
+		}
+	}
+
+	template<typename Data>
+	void NameInterning::memory( const eon::string& data_name, size_t num )
+	{
+		// Identifiers of 5 to 27 bytes
+		static const char* prefixes[]{ "x", "count_", "field_name_", "some_much_longer_name_" };
+		std::vector<string> source;
+		for( size_t i = 0; i < num; ++i )
+			source.push_back( string( prefixes[ i % 4 ] + std::to_string( 10000 + i ) ) );
+
+		auto data = std::make_unique<Data>();
+		NumAllocations = 0;
+		AllocatedBytes = 0;
+		CountAllocations = true;
+		for( auto& str : source )
+			data->name( string( str ) );
+		CountAllocations = false;
+
+		// malloc typically adds 8-16 bytes per allocation, not included here
+		report( data_name + ": heap bytes per name",
+			string( static_cast<index_t>( AllocatedBytes / num ) ) );
+		report( data_name + ": heap allocations per name",
+			string( static_cast<double>( NumAllocations ) / num ).trimFloat() );
+		measure( data_name + ": intern " + string( static_cast<index_t>( num ) ) + " new names", 0, [&]() {
+			Data data;
+			for( auto& str : source )
+				data.name( string( str ) ); } );
+	}
+
+	BENCHMARK( NameInterning, memory_mutex )
+	{
+		memory<MutexNameData>( "Heap strings (before)", 200000 );
+	}
+	BENCHMARK( NameInterning, memory_arena )
+	{
+		memory<NameData>( "Arena", 200000 );
+	}
+
+	BENCHMARK( NameInterning, mutex )
+	{
+		MutexNameData data;
+		run( "Single mutex (before)", data );
+	}
+	BENCHMARK( NameInterning, concurrent )
+	{
+		NameData data;
+		run( "NameData", data );
+	}
+}
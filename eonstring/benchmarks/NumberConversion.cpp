@@ -0,0 +1,135 @@
+#include "Benchmarks.h"
+#include <random>
+
+
+namespace eon
+{
+	// Integer conversion the way [eon::substring::toLongT] did it before the
+	// ASCII fast path: one numeral value lookup per character.
+	static long_t numeralToLong( const substring& str ) noexcept
+	{
+		auto i = str.begin();
+		long_t sign = isMinus( *i ) ? -1 : 1;
+		if( isMinus( *i ) || isPlus( *i ) )
+			++i;
+		long_t value{ 0 };
+		for( ; i != str.end(); ++i )
+			value = value * 10 + numeralValue( *i );
+		return value * sign;
+	}
+
+	// Floating point conversion the way [eon::substring::toHighT] did it
+	// before the ASCII fast path.
+	static high_t numeralToHigh( const substring& str ) noexcept
+	{
+		auto i = str.begin();
+		high_t sign = isMinus( *i ) ? -1.0 : 1.0;
+		if( isMinus( *i ) || isPlus( *i ) )
+			++i;
+		auto decimal_sep = locale::get().decimalSep();
+		high_t value{ 0.0 }, decimals{ 0.0 }, decimal_power{ 1.0 };
+		bool before_sep{ true };
+		for( ; i != str.end(); ++i )
+		{
+			if( before_sep )
+			{
+				if( *i == decimal_sep )
+					before_sep = false;
+				else
+					value = value * 10 + numeralValue( *i );
+			}
+			else
+			{
+				decimals = decimals * 10 + numeralValue( *i );
+				decimal_power *= 10.0;
+			}
+		}
+		return sign * ( value + decimals / decimal_power );
+	}
+
+	// Formatting the way [eon::string::toString( double )] did it before
+	// std::to_chars.
+	static string printfToString( double value )
+	{
+		char digits[ 480 ];
+		snprintf( digits, 480, "%.10f", value );
+		auto size = strlen( digits );
+		for( ; digits[ size - 1 ] == '0' && digits[ size - 2 ] != '.'; --size )
+			;
+		return string( std::string( digits, size ) );
+	}
+
+	static const size_t NumNumbers{ 100000 };
+
+	void NumberConversion::prepare()
+	{
+		// A numeric table, as found in large EDF documents
+		std::mt19937_64 random( 42 );
+		std::uniform_int_distribution<long_t> integer( -10000000000LL, 10000000000LL );
+		std::uniform_real_distribution<double> real( -100000.0, 100000.0 );
+		std::string integers, floats;
+		for( size_t i = 0; i < NumNumbers; ++i )
+		{
+			integers += std::to_string( integer( random ) ) + "\n";
+			Doubles.push_back( real( random ) );
+			char digits[ 64 ];
+			snprintf( digits, 64, "%.6f\n", Doubles.back() );
+			floats += digits;
+		}
+		Integers = std::move( integers );
+		Floats = std::move( floats );
+		for( auto& field : Integers.splitView( '\n' ) )
+		{
+			if( !field.empty() )
+				IntegerFields.push_back( field );
+		}
+		for( auto& field : Floats.splitView( '\n' ) )
+		{
+			if( !field.empty() )
+				FloatFields.push_back( field );
+		}
+	}
+
+	BENCHMARK( NumberConversion, parse )
+	{
+		measure( "100k integers: per numeral (before)", Integers.numBytes(), [&]() {
+			long_t sum{ 0 };
+			for( auto& field : IntegerFields )
+				sum += numeralToLong( field );
+			eonbench::keep( sum ); } );
+		measure( "100k integers: toLongT", Integers.numBytes(), [&]() {
+			long_t sum{ 0 };
+			for( auto& field : IntegerFields )
+				sum += field.toLongT();
+			eonbench::keep( sum ); } );
+		measure( "100k floats: per numeral (before)", Floats.numBytes(), [&]() {
+			double sum{ 0 };
+			for( auto& field : FloatFields )
+				sum += static_cast<double>( numeralToHigh( field ) );
+			eonbench::keep( sum ); } );
+		measure( "100k floats: toDouble", Floats.numBytes(), [&]() {
+			double sum{ 0 };
+			for( auto& field : FloatFields )
+				sum += field.toDouble();
+			eonbench::keep( sum ); } );
+		measure( "100k floats: toHighT", Floats.numBytes(), [&]() {
+			high_t sum{ 0 };
+			for( auto& field : FloatFields )
+				sum += field.toHighT();
+			eonbench::keep( sum ); } );
+	}
+
+	BENCHMARK( NumberConversion, format )
+	{
+		measure( "100k doubles: snprintf (before)", 0, [&]() {
+			index_t size{ 0 };
+			for( auto value : Doubles )
+				size += printfToString( value ).numBytes();
+			eonbench::keep( size ); } );
+		measure( "100k doubles: toString", 0, [&]() {
+			index_t size{ 0 };
+			for( auto value : Doubles )
+				size += string::toString( value ).numBytes();
+			eonbench::keep( size ); } );
+	}
+}
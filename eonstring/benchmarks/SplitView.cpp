@@ -0,0 +1,63 @@
+#include "Benchmarks.h"
+
+
+namespace eon
+{
+	static const size_t NumLines{ 100000 };
+
+	void SplitView::prepare()
+	{
+		std::string ascii, utf8;
+		for( size_t i = 0; i < NumLines; ++i )
+		{
+			auto num = std::to_string( i );
+			ascii += "2024-05-01T12:00:00Z INFO [worker-" + std::to_string( i % 8 ) + "] request id=" + num
+				+ " status=200 path=/api/v1/items/" + num + " took=12ms\n";
+			utf8 += u8"2024-05-01T12:00:00Z INFO [arbeider-" + std::to_string( i % 8 ) + u8"] forespørsel id=" + num
+				+ u8" status=200 sti=/api/v1/æøå/" + num + u8" αβγ 中文 tok=12ms\n";
+		}
+		Log = std::move( ascii );
+		Utf8Log = std::move( utf8 );
+	}
+
+	template<typename separator_t>
+	void SplitView::split( const string& label, const string& text, separator_t separator )
+	{
+		measure( label + ": splitSequential<std::vector<substring>> (before)", text.numBytes(), [&]() {
+			eonbench::keep( text.splitSequential<std::vector<substring>>( separator ).size() ); } );
+		measure( label + ": splitView", text.numBytes(), [&]() {
+			index_t num{ 0 };
+			for( auto& element : text.splitView( separator ) )
+				num += element.numBytes();
+			eonbench::keep( num ); } );
+	}
+
+	BENCHMARK( SplitView, lines )
+	{
+		split( "ASCII log on '\\n'", Log, char_t( '\n' ) );
+		split( "UTF-8 log on '\\n'", Utf8Log, char_t( '\n' ) );
+	}
+
+	BENCHMARK( SplitView, fields )
+	{
+		split( "ASCII log on ' '", Log, char_t( ' ' ) );
+		split( "UTF-8 log on ' '", Utf8Log, char_t( ' ' ) );
+		split( "ASCII log on \" status=\"", Log, string( " status=" ) );
+		split( "UTF-8 log on \" status=\"", Utf8Log, string( " status=" ) );
+	}
+
+	BENCHMARK( SplitView, category )
+	{
+		// splitSequential has no category variant, so compare with splitting on space only
+		measure( "ASCII log on ' ': splitSequential<std::vector<substring>> (before)", Log.numBytes(), [&]() {
+			eonbench::keep( Log.splitSequential<std::vector<substring>>( char_t( ' ' ) ).size() ); } );
+		for( auto text : { &Log, &Utf8Log } )
+		{
+			measure( string( text == &Log ? "ASCII" : "UTF-8" ) + " log on space: splitView( charcat )", text->numBytes(), [&]() {
+				index_t num{ 0 };
+				for( auto& element : text->splitView( charcat::separator_space | charcat::other_control ) )
+					num += element.numBytes();
+				eonbench::keep( num ); } );
+		}
+	}
+}
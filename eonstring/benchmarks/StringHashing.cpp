@@ -0,0 +1,75 @@
+#include "Benchmarks.h"
+#include <unordered_map>
+
+
+namespace eon
+{
+	// How [eon::string] was hashed before: FNV-1a, one byte at a time
+	struct FnvHash
+	{
+		inline size_t operator()( const string& str ) const noexcept {
+			return static_cast<size_t>( substring::hash64( str.c_str(), str.c_str() + str.numBytes() ) ); }
+	};
+	struct WyHash
+	{
+		inline size_t operator()( const string& str ) const noexcept { return str.hash(); }
+	};
+
+
+	static const size_t NumKeys{ 10000 };
+
+	void StringHashing::prepare()
+	{
+		// Keys of 2 to 40 bytes, every other query misses
+		static const char* words[]{ "id", "value", "token_type", "section_heading", "some_rather_long_identifier_name" };
+		for( size_t i = 0; i < NumKeys; ++i )
+			Keys.push_back( string( words[ i % 5 ] + std::to_string( i ) ) );
+		for( size_t i = 0; i < NumKeys; ++i )
+		{
+			Queries.push_back( i % 2 == 0 ? Keys[ ( i * 7 ) % NumKeys ] : string( words[ i % 5 ] + std::to_string( i + NumKeys ) ) );
+			QueryBytes += Queries.back().numBytes();
+		}
+		for( auto& key : Keys )
+			HashedKeys.push_back( hashed_string( key ) );
+		for( auto& query : Queries )
+			HashedQueries.push_back( hashed_string( query ) );
+	}
+
+	template<typename Key, typename Hasher>
+	void StringHashing::lookup( const eon::string& label, const std::vector<Key>& keys, const std::vector<Key>& queries )
+	{
+		std::unordered_map<Key, size_t, Hasher> map;
+		for( size_t i = 0; i < keys.size(); ++i )
+			map[ keys[ i ] ] = i;
+		measure( label, QueryBytes, [&]() {
+			size_t sum{ 0 };
+			for( auto& query : queries )
+			{
+				auto found = map.find( query );
+				if( found != map.end() )
+					sum += found->second;
+			}
+			eonbench::keep( sum ); } );
+	}
+
+	BENCHMARK( StringHashing, hash )
+	{
+		measure( "Hash all queries: FNV-1a (before)", QueryBytes, [&]() {
+			size_t sum{ 0 };
+			for( auto& query : Queries )
+				sum += FnvHash()( query );
+			eonbench::keep( sum ); } );
+		measure( "Hash all queries: wyhash", QueryBytes, [&]() {
+			size_t sum{ 0 };
+			for( auto& query : Queries )
+				sum += query.hash();
+			eonbench::keep( sum ); } );
+	}
+
+	BENCHMARK( StringHashing, unordered_map )
+	{
+		lookup<string, FnvHash>( "unordered_map<string>: FNV-1a (before)", Keys, Queries );
+		lookup<string, WyHash>( "unordered_map<string>: wyhash", Keys, Queries );
+		lookup<hashed_string, std::hash<hashed_string>>( "unordered_map<hashed_string>", HashedKeys, HashedQueries );
+	}
+}
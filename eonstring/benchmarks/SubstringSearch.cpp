@@ -0,0 +1,101 @@
+#include "Benchmarks.h"
+
+
+namespace eon
+{
+	// Same as [eon::strcmp::chr], but not recognized as such, so searching is
+	// done the way it was before the raw byte search: one code point at a time.
+	struct CodepointCmp
+	{
+		inline int operator()( char_t a, char_t b ) const noexcept { return a < b ? -1 : b < a ? 1 : 0; }
+	};
+
+	static const size_t HaystackSize{ 4 * 1024 * 1024 };
+
+	static string haystack( const char* sample )
+	{
+		std::string bytes;
+		bytes.reserve( HaystackSize + 128 );
+		while( bytes.size() < HaystackSize )
+			bytes += sample;
+		return string( std::move( bytes ) );
+	}
+
+	void SubstringSearch::prepare()
+	{
+		Ascii = haystack( "The quick brown fox jumps over the lazy dog, then sits down for a rest. " );
+		Utf8 = haystack( u8"Høstens første snø falt over Ålesund; Ελληνικά κείμενα και 中文文本. " );
+	}
+
+	void SubstringSearch::search( const eon::string& haystack_name, const string& haystack, const string& needle )
+	{
+		auto text = haystack + needle, reversed = needle + haystack;
+		auto label = haystack_name + ", " + string( needle.numBytes() ) + " byte needle";
+		auto all = text.substr();
+		if( text.numBytes() == text.numChars() )
+		{
+			// ASCII was already searched for in raw bytes, by first byte and memcmp
+			measure( label + ": findFirst (before)", text.numBytes(), [&]() {
+				auto pos = static_cast<const char*>( memchr( text.c_str(), *needle.c_str(), text.numBytes() ) );
+				for( auto end = text.c_str() + text.numBytes() - needle.numBytes() + 1;
+					pos != nullptr && memcmp( pos, needle.c_str(), needle.numBytes() ) != 0;
+					pos = static_cast<const char*>( memchr( pos + 1, *needle.c_str(), end - ( pos + 1 ) ) ) )
+					;
+				eonbench::keep( pos ); } );
+		}
+		else
+		{
+			measure( label + ": findFirst (before)", text.numBytes(), [&]() {
+				eonbench::keep( all.findFirst( needle.substr(), CodepointCmp() ) ); } );
+		}
+		measure( label + ": findFirst", text.numBytes(), [&]() {
+			eonbench::keep( all.findFirst( needle.substr() ) ); } );
+		if( needle.numChars() == 1 )
+		{
+			measure( label + ": findLast", text.numBytes(), [&]() {
+				eonbench::keep( reversed.substr().findLast( *needle.begin() ) ); } );
+		}
+		else
+		{
+			measure( label + ": findLast", text.numBytes(), [&]() {
+				eonbench::keep( reversed.substr().findLast( needle.substr() ) ); } );
+		}
+		measure( label + ": count", text.numBytes(), [&]() {
+			eonbench::keep( all.count( needle.substr() ) ); } );
+	}
+
+	BENCHMARK( SubstringSearch, ascii )
+	{
+		search( "ASCII", Ascii, "#" );
+		search( "ASCII", Ascii, "jumped" );
+		search( "ASCII", Ascii, "the lazy dog, then sits down on the grass" );
+		search( "ASCII", Ascii, "The quick brown fox jumps over the lazy dog, then sits down for a rest and a nap." );
+	}
+
+	BENCHMARK( SubstringSearch, utf8 )
+	{
+		search( "UTF-8", Utf8, u8"€" );
+		search( "UTF-8", Utf8, u8"Ålesunds" );
+		search( "UTF-8", Utf8, u8"Ελληνικά κείμενα και 中文文本 ved Ålesund" );
+		search( "UTF-8", Utf8, u8"Høstens første snø falt over Ålesund; Ελληνικά κείμενα και 中文文本 i går." );
+	}
+
+	BENCHMARK( SubstringSearch, kernels )
+	{
+		// Raw byte search for needles of increasing size using each kernel
+		for( const char* needle : { "jumped", "the lazy dog, then sits down on", "the lazy dog, then sits down on the grass for a while" } )
+		{
+			auto text = Ascii + needle;
+			auto size = strlen( needle );
+			for( auto kernel : { simd::none, simd::sse2, simd::avx2 } )
+			{
+				if( useSimd( kernel ) != kernel )
+					continue;
+				measure( string( size ) + " byte needle: " + simdName( kernel ), text.numBytes(), [&]() {
+					eonbench::keep( substring::findBytes( text.c_str(), text.numBytes(), needle, size, kernel ) ); } );
+			}
+			measure( string( size ) + " byte needle: default", text.numBytes(), [&]() {
+				eonbench::keep( substring::findBytes( text.c_str(), text.numBytes(), needle, size ) ); } );
+		}
+	}
+}
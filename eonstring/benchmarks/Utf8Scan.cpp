@@ -0,0 +1,89 @@
+#include "Benchmarks.h"
+
+
+namespace eon
+{
+	// Copyright (c) 2008-2009 Bjoern Hoehrmann <bjoern@hoehrmann.de>
+	// See http://bjoern.hoehrmann.de/utf-8/decoder/dfa/ for details.
+	static const uint8_t utf8d[] = {
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 00..1f
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 20..3f
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 40..5f
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 60..7f
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, // 80..9f
+		7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, // a0..bf
+		8, 8, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, // c0..df
+		0xa, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x4, 0x3, 0x3, // e0..ef
+		0xb, 0x6, 0x6, 0x6, 0x5, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, 0x8, // f0..ff
+		0x0, 0x1, 0x2, 0x3, 0x5, 0x8, 0x7, 0x1, 0x1, 0x1, 0x4, 0x6, 0x1, 0x1, 0x1, 0x1, // s0..s0
+		1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, // s1..s2
+		1, 2, 1, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, // s3..s4
+		1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 3, 1, 1, 1, 1, 1, 1, // s5..s6
+		1, 3, 1, 1, 1, 1, 1, 3, 1, 3, 1, 1, 1, 1, 1, 1, 1, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // s7..s8
+	};
+	static inline char32_t _dfaDecode( char32_t& state, char32_t& codep, char32_t byte ) noexcept
+	{
+		char32_t type = utf8d[ byte ];
+		codep = ( state != UTF8_ACCEPT ) ? ( byte & 0x3fu ) | ( codep << 6 ) : ( 0xff >> type ) & ( byte );
+		state = utf8d[ 256 + state * 16 + type ];
+		return state;
+	}
+
+	std::string Utf8Scan::text( const char* sample, size_t size )
+	{
+		std::string sample_str{ sample }, output;
+		output.reserve( size + sample_str.size() );
+		while( output.size() < size )
+			output += sample_str;
+		return output;
+	}
+
+	index_t Utf8Scan::dfaCount( const char* str, size_t size )
+	{
+		char32_t cp{ 0 }, state{ UTF8_ACCEPT };
+		index_t num = 0;
+		for( auto c = str, end_c = str + size; c != end_c; ++c )
+		{
+			if( !_dfaDecode( state, cp, static_cast<unsigned char>( *c ) ) )
+				++num;
+		}
+		if( state != UTF8_ACCEPT )
+			throw InvalidUTF8();
+		return num;
+	}
+
+
+	static const size_t Size{ 4 * 1024 * 1024 };
+	static const char* ASCII{ "The quick brown fox jumps over the lazy dog; key = \"value\", count = 42.\n" };
+	static const char* Latin{ u8"Høvdingen på Ærø spiste blåbærsyltetøy, crème brûlée og smørbrød.\n" };
+	static const char* CJK{ u8"東京都の天気は晴れのち曇り、最高気温は二十五度です。\n" };
+
+	void Utf8Scan::scanAll( const eon::string& input_name, const std::string& input )
+	{
+		index_t num_chars{ 0 };
+		measure( input_name + ": DFA decoder (before)", input.size(),
+			[&]() { eonbench::keep( dfaCount( input.c_str(), input.size() ) ); } );
+		for( auto kernel : { simd::none, simd::sse2, simd::avx2 } )
+		{
+			if( useSimd( kernel ) != kernel )
+				continue;
+			measure( input_name + ": scanUtf8 " + simdName( kernel ), input.size(),
+				[&]() { string_iterator::scanUtf8( input.c_str(), input.size(), num_chars, kernel ); } );
+		}
+		measure( input_name + ": eon::string( std::string )", input.size(),
+			[&]() { eonbench::keep( eon::string( input ) ); } );
+	}
+
+	BENCHMARK( Utf8Scan, ascii )
+	{
+		scanAll( "ASCII", text( ASCII, Size ) );
+	}
+	BENCHMARK( Utf8Scan, latin )
+	{
+		scanAll( "Latin", text( Latin, Size ) );
+	}
+	BENCHMARK( Utf8Scan, cjk )
+	{
+		scanAll( "CJK", text( CJK, Size ) );
+	}
+}
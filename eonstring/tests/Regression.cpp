@@ -458,7 +458,7 @@ namespace eon
 	TEST( String, hash )
 	{
 		std::string str( "Hello World!" );
-		size_t expected = sizeof( size_t ) == 4 ? 2984921202 : 10092224619179044402llu;
+		size_t expected = sizeof( size_t ) == 4 ? 4094363224 : 6179077832607204952llu;
 		WANT_EQ( expected, eon::string( str ).hash() ) << "Wrong hash value";
 	}
 	TEST( String, hash_speed )
@@ -805,10 +805,10 @@ namespace eon
 		WANT_EQ( "-56746754767", string::toString( i64_2 ) ) << "Wrong int64_t value";
 		WANT_EQ( "9034658634325425", string::toString( ui64 ) ) << "Wrong uint64_t value";
 		WANT_EQ( "1.23", string::toString( dbl_1 ) ) << "Wrong double value";
-		WANT_EQ( "-3546346.0234139999", string::toString( dbl_2 ) ) << "Wrong double value";
+		WANT_EQ( "-3546346.023414", string::toString( dbl_2 ) ) << "Wrong double value";
 		WANT_EQ( 311, string::toString( DBL_MAX ).numChars() ) << "Wrong double max";
-		WANT_EQ( "123456789.0112345666", string::toString( ldbl_1 ) ) << "Wrong long double value";
-		WANT_EQ( "-98765432109.8765411377", string::toString( ldbl_2 ) ) << "Wrong long double value";
+		WANT_EQ( "123456789.01123456657", string::toString( ldbl_1 ) ) << "Wrong long double value";
+		WANT_EQ( "-98765432109.87654114", string::toString( ldbl_2 ) ) << "Wrong long double value";
 	}
 
 	TEST( String, real_issue_seen1 )
@@ -0,0 +1,258 @@
+#pragma once
+#include "../UniChar.h"
+#include <cstdint>
+#include <vector>
+
+
+
+namespace eon
+{
+	// The code point lists and category rules that [eon::Characters] used to
+	// apply at run-time (binary search per category). Now only used to
+	// generate the lookup table, and as reference in the benchmarks.
+	class CategorySource
+	{
+	public:
+		CategorySource()
+		{
+#include "../other_format.cpp"
+#include "../letter_upper_case.cpp"
+#include "../letter_lower_case.cpp"
+#include "../letter_modifier.cpp"
+#include "../letter_other.cpp"
+#include "../mark_space_combining.cpp"
+#include "../mark_nonspacing.cpp"
+#include "../number_decimal_digit.cpp"
+#include "../number_letter.cpp"
+#include "../number_other.cpp"
+#include "../punctuation_open.cpp"
+#include "../punctuation_close.cpp"
+#include "../punctuation_other.cpp"
+#include "../symbol_currency.cpp"
+#include "../symbol_modifier.cpp"
+#include "../symbol_math.cpp"
+#include "../symbol_other.cpp"
+		}
+		~CategorySource()
+		{
+			for( auto table : { other_format, letter_upper_case, letter_lower_case, letter_modifier, letter_other,
+				mark_spacing_combining, mark_nonspacing, number_decimal_digit, number_letter, number_other,
+				punctuation_open, punctuation_close, punctuation_other, symbol_currency, symbol_modifier, symbol_math,
+				symbol_other } )
+				delete table;
+		}
+
+		// Get all categories the code point is a member of.
+		uint32_t members( char_t c ) const
+		{
+			static const std::pair<bool( CategorySource::* )( char_t ) const noexcept, charcat> tests[]{
+				{ &CategorySource::isLetterLowerCase, charcat::letter_lowercase },
+				{ &CategorySource::isLetterUpperCase, charcat::letter_uppercase },
+				{ &CategorySource::isLetterTitleCase, charcat::letter_titlecase },
+				{ &CategorySource::isLetterModifier, charcat::letter_modifier },
+				{ &CategorySource::isLetterOther, charcat::letter_other },
+				{ &CategorySource::isMarkSpacingCombining, charcat::mark_spacing_combining },
+				{ &CategorySource::isMarkEnclosing, charcat::mark_enclosing },
+				{ &CategorySource::isMarkNonspacing, charcat::mark_nonspacing },
+				{ &CategorySource::isNumberAsciiDigit, charcat::number_ascii_digit },
+				{ &CategorySource::isNumberDecimalDigit, charcat::number_decimal_digit },
+				{ &CategorySource::isNumberLetter, charcat::number_letter },
+				{ &CategorySource::isNumberOther, charcat::number_other },
+				{ &CategorySource::isPunctuationConnector, charcat::punctuation_connector },
+				{ &CategorySource::isPunctuationDash, charcat::punctuation_dash },
+				{ &CategorySource::isPunctuationClose, charcat::punctuation_close },
+				{ &CategorySource::isPunctuationFinalQuote, charcat::punctuation_final_quote },
+				{ &CategorySource::isPunctuationInitialQuote, charcat::punctuation_initial_quote },
+				{ &CategorySource::isPunctuationOther, charcat::punctuation_other },
+				{ &CategorySource::isPunctuationOpen, charcat::punctuation_open },
+				{ &CategorySource::isSymbolCurrency, charcat::symbol_currency },
+				{ &CategorySource::isSymbolModifier, charcat::symbol_modifier },
+				{ &CategorySource::isSymbolMath, charcat::symbol_math },
+				{ &CategorySource::isSymbolOther, charcat::symbol_other },
+				{ &CategorySource::isSeparatorLine, charcat::separator_line },
+				{ &CategorySource::isSeparatorParagraph, charcat::separator_paragraph },
+				{ &CategorySource::isSeparatorSpace, charcat::separator_space },
+				{ &CategorySource::isOtherControl, charcat::other_control },
+				{ &CategorySource::isOtherFormat, charcat::other_format },
+				{ &CategorySource::isOtherPrivateUse, charcat::other_private_use },
+				{ &CategorySource::isOtherSurrogate, charcat::other_surrogate } };
+			uint32_t members{ 0 };
+			for( auto& test : tests )
+			{
+				if( ( this->*test.first )( c ) )
+					members |= static_cast<uint32_t>( test.second );
+			}
+			return members;
+		}
+
+		// Get the single category for a code point.
+		// Where a code point is listed in more than one category, the first
+		// one found here wins.
+		charcat category( char_t c ) const noexcept
+		{
+			if( isLetterLowerCase( c ) )
+				return charcat::letter_lowercase;
+			else if( isLetterUpperCase( c ) )
+				return charcat::letter_uppercase;
+			else if( isLetterTitleCase( c ) )
+				return charcat::letter_titlecase;
+			else if( isLetterModifier( c ) )
+				return charcat::letter_modifier;
+			else if( isLetterOther( c ) )
+				return charcat::letter_other;
+
+			else if( isMarkSpacingCombining( c ) )
+				return charcat::mark_spacing_combining;
+			else if( isMarkEnclosing( c ) )
+				return charcat::mark_enclosing;
+			else if( isMarkNonspacing( c ) )
+				return charcat::mark_nonspacing;
+
+			else if( isNumberAsciiDigit( c ) )
+				return charcat::number_ascii_digit | charcat::number_decimal_digit;
+			else if( isNumberDecimalDigit( c ) )
+				return charcat::number_decimal_digit;
+			else if( isNumberLetter( c ) )
+				return charcat::number_letter;
+			else if( isNumberOther( c ) )
+				return charcat::number_other;
+
+			else if( isPunctuationConnector( c ) )
+				return charcat::punctuation_connector;
+			else if( isPunctuationDash( c ) )
+				return charcat::punctuation_dash;
+			else if( isPunctuationClose( c ) )
+				return charcat::punctuation_close;
+			else if( isPunctuationFinalQuote( c ) )
+				return charcat::punctuation_final_quote;
+			else if( isPunctuationInitialQuote( c ) )
+				return charcat::punctuation_initial_quote;
+			else if( isPunctuationOther( c ) )
+				return charcat::punctuation_other;
+			else if( isPunctuationOpen( c ) )
+				return charcat::punctuation_open;
+
+			else if( isSymbolCurrency( c ) )
+				return charcat::symbol_currency;
+			else if( isSymbolModifier( c ) )
+				return charcat::symbol_modifier;
+			else if( isSymbolMath( c ) )
+				return charcat::symbol_math;
+			else if( isSymbolOther( c ) )
+				return charcat::symbol_other;
+
+			else if( isSeparatorLine( c ) )
+				return charcat::separator_line;
+			else if( isSeparatorParagraph( c ) )
+				return charcat::separator_paragraph;
+			else if( isSeparatorSpace( c ) )
+				return charcat::separator_space;
+
+			else if( isOtherControl( c ) )
+				return charcat::other_control;
+			else if( isOtherFormat( c ) )
+				return charcat::other_format;
+			else if( isOtherPrivateUse( c ) )
+				return charcat::other_private_use;
+			else if( isOtherSurrogate( c ) )
+				return charcat::other_surrogate;
+
+			else
+				return charcat::undef;
+		}
+
+
+		bool isLetter( char_t c ) const noexcept { return isLetterUpperCase( c ) || isLetterLowerCase( c )
+			|| isLetterTitleCase( c ) || isLetterModifier( c ) || isLetterOther( c ); }
+		bool isLetterLowerCase( char_t c ) const noexcept { return c <= 0xFF
+			? ( c >= 0x61 && c <= 0x7A ) || ( c >= 0xDF && c <= 0xF6 ) || ( c >= 0xF8 && c <= 0xFF )
+			: in( *letter_lower_case, c ); }
+		bool isLetterUpperCase( char_t c ) const noexcept { return c <= 0xDE
+			? ( c >= 0x41 && c <= 0x5A ) || ( c >= 0xC0 && c <= 0xD6 ) || ( c >= 0xD8 && c <= 0xDE )
+			: in( *letter_upper_case, c ); }
+		bool isLetterTitleCase( char_t c ) const noexcept { return in( letter_title_case, c ); }
+		bool isLetterModifier( char_t c ) const noexcept {
+			return ( c >= 0x2B0 && c <= 0x2C1 ) || ( c >= 0x2C6 && c <= 0x2D1 ) || in( *letter_modifier, c ); }
+		bool isLetterOther( char_t c ) const noexcept { return c >= 0xAA && in( *letter_other, c ); }
+
+		bool isMarkSpacingCombining( char_t c ) const noexcept { return in( *mark_spacing_combining, c ); }
+		bool isMarkEnclosing( char_t c ) const noexcept { return in( mark_enclosing, c ); }
+		bool isMarkNonspacing( char_t c ) const noexcept { return in( *mark_nonspacing, c ); }
+
+		bool isNumberAsciiDigit( char_t c ) const noexcept { return c >= '0' && c <= '9'; }
+		bool isNumber( char_t c ) const noexcept {
+			return isNumberDecimalDigit( c ) || isNumberLetter( c ) || isNumberOther( c ); }
+		bool isNumberDecimalDigit( char_t c ) const noexcept {
+			return c <= 0x39 ? c >= 0x30 && c <= 0x39 : in( *number_decimal_digit, c ); }
+		bool isNumberLetter( char_t c ) const noexcept {
+			return ( c >= 0x2160 && c <= 0x2182 ) || in( *number_letter, c ); }
+		bool isNumberOther( char_t c ) const noexcept { return in( *number_other, c ); }
+
+		bool isPunctuationConnector( char_t c ) const noexcept { return in( punctuation_connector, c ); }
+		bool isPunctuationDash( char_t c ) const noexcept { return in( punctuation_dash, c ); }
+		bool isPunctuationOpen( char_t c ) const noexcept { return in( *punctuation_open, c ); }
+		bool isPunctuationClose( char_t c ) const noexcept { return in( *punctuation_close, c ); }
+		bool isPunctuationInitialQuote( char_t c ) const noexcept { return in( punctuation_initial_quote, c ); }
+		bool isPunctuationFinalQuote( char_t c ) const noexcept { return in( punctuation_final_quote, c ); }
+		bool isPunctuationOther( char_t c ) const noexcept { return in( *punctuation_other, c ); }
+
+		bool isSymbolCurrency( char_t c ) const noexcept { return in( *symbol_currency, c ); }
+		bool isSymbolModifier( char_t c ) const noexcept { return in( *symbol_modifier, c ); }
+		bool isSymbolMath( char_t c ) const noexcept { return in( *symbol_math, c ); }
+		bool isSymbolOther( char_t c ) const noexcept { return in( *symbol_other, c ); }
+
+		bool isSeparatorLine( char_t c ) const noexcept { return c == 0x2028; }
+		bool isSeparatorParagraph( char_t c ) const noexcept { return c == 0x2029; }
+		bool isSeparatorSpace( char_t c ) const noexcept { return c == 0x20 || c == 0xA0 || c == 0x1680
+			|| ( c >= 0x2000 && c <= 0x200A ) || c == 0x202F || c == 0x205F || c == 0x3000; }
+
+		bool isOtherControl( char_t c ) const noexcept { return c <= 0x1F || ( c >= 0x7F && c <= 0x9F ); }
+		bool isOtherFormat( char_t c ) const noexcept { return in( *other_format, c ); }
+		bool isOtherPrivateUse( char_t c ) const noexcept {
+			return c == 0xE000 || c == 0xF8FF || c == 0xF0000 || c == 0xFFFFD || c == 0x100000 || c == 0x10FFFD; }
+		bool isOtherSurrogate( char_t c ) const noexcept {
+			return c == 0xD800 || c == 0xDB7F || c == 0xDB80 || c == 0xDBFF || c == 0xDC00 || c == 0xDFFF; }
+
+	private:
+		static bool in( const std::vector<char_t>& table, char_t c ) {
+			return std::binary_search( table.begin(), table.end(), c ); }
+
+	private:
+		std::vector<char_t>* other_format{ nullptr };
+
+		std::vector<char_t>* letter_upper_case{ nullptr };
+		const std::vector<char_t> letter_title_case{ 0x01C5, 0x01C8, 0x01CB, 0x01F2, 0x1F88, 0x1F89, 0x1F8A, 0x1F8B,
+			0x1F8C, 0x1F8D, 0x1F8E, 0x1F8F, 0x1F98, 0x1F99, 0x1F9A, 0x1F9B, 0x1F9C, 0x1F9D, 0x1F9E, 0x1F9F, 0x1FA8,
+			0x1FA9, 0x1FAA, 0x1FAB, 0x1FAC, 0x1FAD, 0x1FAE, 0x1FAF, 0x1FBC, 0x1FCC, 0x1FFC };
+		std::vector<char_t>* letter_lower_case{ nullptr };
+		std::vector<char_t>* letter_modifier{ nullptr };
+		std::vector<char_t>* letter_other{ nullptr };
+
+		std::vector<char_t>* mark_spacing_combining{ nullptr };
+		std::vector<char_t>* mark_nonspacing{ nullptr };
+		const std::vector<char_t> mark_enclosing{
+			0x0488, 0x0489, 0x1ABE, 0x20DD, 0x20DE, 0x20DF, 0x20E0, 0x20E2, 0x20E3, 0x20E4, 0xA670, 0xA671, 0xA672 };
+
+		std::vector<char_t>* number_decimal_digit{ nullptr };
+		std::vector<char_t>* number_letter{ nullptr };
+		std::vector<char_t>* number_other{ nullptr };
+
+		const std::vector<char_t> punctuation_connector{
+			0x005F, 0x203F, 0x2040, 0x2054, 0xFE33, 0xFE34, 0xFE4D, 0xFE4E, 0xFE4F, 0xFF3F };
+		const std::vector<char_t> punctuation_dash{
+			0x002D, 0x058A, 0x05BE, 0x1400, 0x1806, 0x2010, 0x2011, 0x2012, 0x2013, 0x2014, 0x2015, 0x2E17, 0x2E1A,
+			0x2E3A, 0x2E3B, 0x2E40, 0x301C, 0x3030, 0x30A0, 0xFE31, 0xFE32, 0xFE58, 0xFE63, 0xFF0D, 0x10EAD };
+		std::vector<char_t>* punctuation_open{ nullptr };
+		std::vector<char_t>* punctuation_close{ nullptr };
+		const std::vector<char_t> punctuation_initial_quote{
+			0x00AB, 0x2018, 0x201B, 0x201C, 0x201F, 0x2039, 0x2E02, 0x2E04, 0x2E09, 0x2E0C, 0x2E1C, 0x2E20 };
+		const std::vector<char_t> punctuation_final_quote{
+			0x00BB, 0x2019, 0x201D, 0x203A, 0x2E03, 0x2E05, 0x2E0A, 0x2E0D, 0x2E1D, 0x2E21 };
+		std::vector<char_t>* punctuation_other{ nullptr };
+
+		std::vector<char_t>* symbol_currency{ nullptr };
+		std::vector<char_t>* symbol_modifier{ nullptr };
+		std::vector<char_t>* symbol_math{ nullptr };
+		std::vector<char_t>* symbol_other{ nullptr };
+	};
+}
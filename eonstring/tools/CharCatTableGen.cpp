@@ -0,0 +1,92 @@
+// Build-time generator for the [eon::charcat] lookup table used by
+// [eon::Characters].
+//
+// Applies the old per-category rules (see CharCatSource.h) to every code
+// point and writes the three arrays behind [eon::Characters::_catValue]:
+//   - Values: every distinct (membership, category) pair, index 0 is undef
+//   - Stage1: block number for each 256 code point block
+//   - Stage2: the distinct blocks, one value index per code point
+//
+// Usage: CharCatTableGen <output file>
+
+#include "CharCatSource.h"
+#include <cstdio>
+#include <map>
+
+
+
+int main( int argc, char** argv )
+{
+	using namespace eon;
+	if( argc != 2 )
+	{
+		std::fprintf( stderr, "Usage: %s <output file>\n", argv[ 0 ] );
+		return 1;
+	}
+
+	static const char_t num_codepoints{ 0x110000 };
+	static const char_t block_size{ 256 };
+
+	CategorySource source;
+	std::vector<std::pair<uint32_t, uint32_t>> values{ { 0, 0 } };
+	std::map<std::pair<uint32_t, uint32_t>, uint8_t> value_index{ { { 0, 0 }, 0 } };
+	std::vector<std::vector<uint8_t>> blocks;
+	std::map<std::vector<uint8_t>, uint16_t> block_index;
+	std::vector<uint16_t> stage1;
+
+	for( char_t start = 0; start < num_codepoints; start += block_size )
+	{
+		std::vector<uint8_t> block( block_size, 0 );
+		for( char_t i = 0; i < block_size; ++i )
+		{
+			auto members = source.members( start + i );
+			std::pair<uint32_t, uint32_t> value{ members, static_cast<uint32_t>( source.category( start + i ) ) };
+			auto found = value_index.find( value );
+			if( found == value_index.end() )
+			{
+				if( values.size() == 256 )
+				{
+					std::fprintf( stderr, "Too many distinct character category combinations!\n" );
+					return 1;
+				}
+				found = value_index.insert( { value, static_cast<uint8_t>( values.size() ) } ).first;
+				values.push_back( value );
+			}
+			block[ i ] = found->second;
+		}
+		auto found = block_index.find( block );
+		if( found == block_index.end() )
+		{
+			found = block_index.insert( { block, static_cast<uint16_t>( blocks.size() ) } ).first;
+			blocks.push_back( block );
+		}
+		stage1.push_back( found->second );
+	}
+
+	auto out = std::fopen( argv[ 1 ], "w" );
+	if( out == nullptr )
+	{
+		std::fprintf( stderr, "Cannot write %s\n", argv[ 1 ] );
+		return 1;
+	}
+	std::fprintf( out, "// Generated by CharCatTableGen - do not edit!\n" );
+	std::fprintf( out, "// %zu values, %zu blocks of %u code points\n\n", values.size(), blocks.size(), block_size );
+
+	auto sep = []( size_t i, size_t per_line ) { return i == 0 ? "\n\t" : i % per_line == 0 ? ",\n\t" : ", "; };
+
+	std::fprintf( out, "alignas( 64 ) const Characters::CatValue Characters::CatValues[]{" );
+	for( size_t i = 0; i < values.size(); ++i )
+		std::fprintf( out, "%s{ 0x%08X, 0x%08X }", sep( i, 4 ), values[ i ].first, values[ i ].second );
+	std::fprintf( out, " };\n\n" );
+
+	std::fprintf( out, "alignas( 64 ) const uint16_t Characters::CatStage1[]{" );
+	for( size_t i = 0; i < stage1.size(); ++i )
+		std::fprintf( out, "%s%u", sep( i, 32 ), stage1[ i ] );
+	std::fprintf( out, " };\n\n" );
+
+	std::fprintf( out, "alignas( 64 ) const uint8_t Characters::CatStage2[]{" );
+	for( size_t i = 0; i < blocks.size() * block_size; ++i )
+		std::fprintf( out, "%s%u", sep( i, 32 ), blocks[ i / block_size ][ i % block_size ] );
+	std::fprintf( out, " };\n" );
+	return std::fclose( out ) == 0 ? 0 : 1;
+}
@@ -5,10 +5,10 @@ namespace eon
 {
 	bool ReTokenizer::RemoveRule::match( TokenParser& parser, std::vector<Token>& output ) const noexcept
 	{
-		auto& pos = parser.viewed().source().start();
+		auto initial = parser.viewedPos();
 		while( !parser.atEnd() && Remove.find( parser.viewed().type() ) != Remove.end() )
 			parser.forward();
-		return parser.viewed().source().start() != pos;
+		return parser.viewedPos() != initial;
 	}
 	bool ReTokenizer::EncloseRule::match( TokenParser& parser, std::vector<Token>& output ) const noexcept
 	{
@@ -258,11 +258,40 @@ namespace eon
 
 
 
+	void ReTokenizer::addRule( std::shared_ptr<RuleDef> rule )
+	{
+		auto start = rule->start();
+		auto pos = Rules.size();
+		Rules.push_back( rule );
+		if( !start.Types.empty() )
+		{
+			for( auto type : start.Types )
+			{
+				auto found = ByType.find( type );
+				if( found == ByType.end() )
+					found = ByType.emplace( type, Anywhere ).first;
+				found->second.push_back( pos );
+			}
+		}
+		else if( start.Chr != 0 )
+			ByChar[ start.Chr ].push_back( pos );
+		else
+		{
+			Anywhere.push_back( pos );
+			for( auto& rules : ByType )
+				rules.second.push_back( pos );
+		}
+	}
+
+
+
+
 	std::vector<Token> ReTokenizer::operator()( TokenParser& parser ) const noexcept
 	{
 		std::vector<Token> output;
 		while( !parser.atEnd() )
 		{
+			parser.hold( parser.viewedPos() );
 			if( !_matchARule( parser, output ) )
 			{
 				output.push_back( parser.viewed() );
@@ -272,14 +301,56 @@ namespace eon
 		return output;
 	}
 
+	bool ReTokenizer::read( TokenParser& parser, std::vector<Token>& output, size_t max ) const noexcept
+	{
+		auto num = output.size();
+		while( !parser.atEnd() && output.size() - num < max )
+		{
+			// Rules may look far ahead before failing, and then move back
+			parser.hold( parser.viewedPos() );
+			if( !_matchARule( parser, output ) )
+			{
+				output.push_back( parser.viewed() );
+				parser.forward();
+			}
+		}
+		return output.size() > num;
+	}
+
+	TokenParser ReTokenizer::stream( const Tokenizer& tokenizer, const source::Ref& source, size_t window ) const
+	{
+		auto raw_tokens = std::make_shared<Tokenizer::Stream>( tokenizer, source );
+		auto raw = std::make_shared<TokenParser>(
+			[raw_tokens]( std::vector<Token>& tokens, size_t max ) { return raw_tokens->read( tokens, max ); },
+			window );
+		return TokenParser(
+			[this, raw]( std::vector<Token>& tokens, size_t max ) { return read( *raw, tokens, max ); }, window );
+	}
+
 
 
 
 	bool ReTokenizer::_matchARule( TokenParser& parser, std::vector<Token>& output ) const noexcept
 	{
-		for( auto& rule : Rules )
+		auto found_type = ByType.find( parser.viewed().type() );
+		auto& typed = found_type != ByType.end() ? found_type->second : Anywhere;
+		auto found_chr = ByChar.empty() ? ByChar.end() : ByChar.find( parser.viewed().source().chr() );
+		if( found_chr == ByChar.end() )
+		{
+			for( auto pos : typed )
+			{
+				if( Rules[ pos ]->match( parser, output ) )
+					return true;
+			}
+			return false;
+		}
+
+		// Merge with the rules for the first character, keeping the order
+		auto& prefixed = found_chr->second;
+		for( auto t = typed.begin(), p = prefixed.begin(); t != typed.end() || p != prefixed.end(); )
 		{
-			if( rule->match( parser, output ) )
+			auto pos = p == prefixed.end() || ( t != typed.end() && *t < *p ) ? *t++ : *p++;
+			if( Rules[ pos ]->match( parser, output ) )
 				return true;
 		}
 		return false;
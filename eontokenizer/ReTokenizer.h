@@ -1,6 +1,8 @@
 #pragma once
 #include "TokenParser.h"
+#include "Tokenizer.h"
 #include <eonregex/RegEx.h>
+#include <unordered_map>
 
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -105,6 +107,20 @@ namespace eon
 			inline name_t name() const noexcept { return Name; }
 			virtual bool match( TokenParser& parser, std::vector<Token>& output ) const noexcept = 0;
 
+			// What a match must start on: A token of one of the 'Types', or
+			// (if no types) a token starting with the 'Chr' character.
+			// Anything if neither.
+			struct Start
+			{
+				std::set<name_t> Types;
+				char_t Chr{ 0 };
+			};
+
+			// Get what a match must start on, so that the rule is only tried
+			// where it can match
+			// Rules that can start on any token don't need to override this.
+			virtual Start start() const { return Start(); }
+
 		private:
 			name_t Name{ no_name };
 		};
@@ -115,6 +131,7 @@ namespace eon
 			inline explicit RemoveRule( std::set<name_t>&& remove ) noexcept : RuleDef( no_name ) {
 				Remove = std::move( remove ); }
 			bool match( TokenParser& parser, std::vector<Token>& output ) const noexcept override;
+			inline Start start() const override { return Start{ Remove }; }
 		private:
 			std::set<name_t> Remove;
 		};
@@ -127,6 +144,7 @@ namespace eon
 			inline EncloseRule( name_t name, name_t enclose_start, name_t enclose_end, bool nested ) noexcept
 				: RuleDef( name ), EncloseStart( enclose_start ), EncloseEnd( enclose_end ), Nested( nested ) {}
 			bool match( TokenParser& parser, std::vector<Token>& output ) const noexcept override;
+			inline Start start() const override { return Start{ { EncloseStart } }; }
 		protected:
 			bool _match( size_t initial, Token matched, TokenParser& parser, std::vector<Token>& output ) const noexcept;
 			inline name_t _encloseStart() const noexcept { return EncloseStart; }
@@ -146,6 +164,7 @@ namespace eon
 			inline PrefixEncloseRule( name_t name, string prefix, name_t enclose_start, name_t enclose_end, bool nested )
 				noexcept : EncloseRule( name, enclose_start, enclose_end, nested ), Prefix( std::move( prefix ) ) {}
 			bool match( TokenParser& parser, std::vector<Token>& output ) const noexcept override;
+			inline Start start() const override { return _prefixStart( Prefix ); }
 		private:
 			string Prefix;
 		};
@@ -156,6 +175,7 @@ namespace eon
 			inline ComboRule( name_t name, std::set<name_t>&& combo, regex&& exclude = regex() )
 				: RuleDef( name ), Combo( std::move( combo ) ), Exclude( std::move( exclude ) ) {}
 			bool match( TokenParser& parser, std::vector<Token>& output ) const noexcept override;
+			inline Start start() const override { return Start{ Combo }; }
 		protected:
 			bool _match( size_t initial, Token matched, TokenParser& parser, std::vector<Token>& output ) const noexcept;
 		private:
@@ -169,6 +189,7 @@ namespace eon
 			inline PrefixComboRule( name_t name, string prefix, std::set<name_t>&& combo, regex&& exclude = regex() )
 				: ComboRule( name, std::move( combo ), std::move( exclude ) ), Prefix( std::move( prefix ) ) {}
 			bool match( TokenParser& parser, std::vector<Token>&output ) const noexcept override;
+			inline Start start() const override { return _prefixStart( Prefix ); }
 		private:
 			string Prefix;
 		};
@@ -179,6 +200,7 @@ namespace eon
 			inline AlternatingRule( name_t name, name_t a, name_t b, bool end_on_a = true )
 				: RuleDef( name ), A( a ), B( b ), EndOnA( end_on_a ) {}
 			bool match( TokenParser& parser, std::vector<Token>& output ) const noexcept override;
+			inline Start start() const override { return Start{ { A } }; }
 		protected:
 			bool _match( size_t initial, Token matched, TokenParser& parser, std::vector<Token>& output ) const noexcept;
 		private:
@@ -193,6 +215,7 @@ namespace eon
 			inline PrefixAlternatingRule( name_t name, string prefix, name_t a, name_t b, bool end_on_a = true )
 				: AlternatingRule( name, a, b, end_on_a ), Prefix( std::move( prefix ) ) {}
 			bool match( TokenParser& parser, std::vector<Token>& output ) const noexcept override;
+			inline Start start() const override { return _prefixStart( Prefix ); }
 		private:
 			string Prefix;
 		};
@@ -203,6 +226,7 @@ namespace eon
 			inline SequenceRule( name_t name, std::vector<name_t>&& sequence, regex&& exclude = regex() )
 				: RuleDef( name ), Sequence( std::move( sequence ) ), Exclude( std::move( exclude ) ) {}
 			bool match( TokenParser& parser, std::vector<Token>& output ) const noexcept override;
+			inline Start start() const override { return Sequence.empty() ? Start() : Start{ { Sequence[ 0 ] } }; }
 		private:
 			std::vector<name_t> Sequence;
 			regex Exclude;
@@ -214,6 +238,7 @@ namespace eon
 			inline LiteralNameRule( name_t name, std::set<string>&& names )
 				: RuleDef( name ), Names( std::move( names ) ) {}
 			bool match( TokenParser& parser, std::vector<Token>& output ) const noexcept override;
+			inline Start start() const override { return Start{ { name_name } }; }
 		private:
 			std::set<string> Names;
 		};
@@ -223,6 +248,7 @@ namespace eon
 		public:
 			inline RegexRule( name_t name, regex&& pattern ) : RuleDef( name ), Pattern( std::move( pattern ) ) {}
 			bool match( TokenParser& parser, std::vector<Token>& output ) const noexcept override;
+			inline Start start() const override { return Start{ { name_name } }; }
 		private:
 			regex Pattern;
 		};
@@ -232,6 +258,7 @@ namespace eon
 		public:
 			inline LinestartRule( name_t name, name_t linestart ) : RuleDef( name ), Linestart( linestart ) {}
 			bool match( TokenParser& parser, std::vector<Token>& output ) const noexcept override;
+			inline Start start() const override { return Start{ { Linestart } }; }
 		private:
 			name_t Linestart{ no_name };
 		};
@@ -242,7 +269,9 @@ namespace eon
 		inline explicit operator bool() const noexcept { return !Rules.empty(); }
 
 		// Add a rule
-		inline void addRule( std::shared_ptr<RuleDef> rule ) { Rules.push_back( rule ); }
+		// Rules are tried in the order added, but only those that can start
+		// on the token at hand. (See [eon::ReTokenizer::RuleDef::start].)
+		void addRule( std::shared_ptr<RuleDef> rule );
 
 
 
@@ -256,6 +285,22 @@ namespace eon
 		// Run re-tokenizing
 		std::vector<Token> operator()( TokenParser& parser ) const noexcept;
 
+		// Re-tokenize from the current position of 'parser' until at least
+		// 'max' tokens are added to 'output', or to the end
+		// Returns false if there were no more tokens.
+		bool read( TokenParser& parser, std::vector<Token>& output, size_t max ) const noexcept;
+
+		// Get a token parser reading re-tokenized tokens of 'source' as they
+		// are needed, streaming through the 'tokenizer' and 'this'
+		// re-tokenizer
+		// Only a window of raw tokens and one of re-tokenized tokens (of
+		// 'window' tokens each) are kept, instead of all of them. (See
+		// [eon::TokenParser].)
+		// NOTE: The tokenizer, 'this' re-tokenizer, and the source must
+		//       outlive the parser!
+		TokenParser stream( const Tokenizer& tokenizer, const source::Ref& source,
+			size_t window = TokenParser::DefWindow ) const;
+
 
 
 
@@ -267,6 +312,9 @@ namespace eon
 
 		bool _matchARule( TokenParser& parser, std::vector<Token>& output ) const noexcept;
 
+		static inline RuleDef::Start _prefixStart( const string& prefix ) {
+			return RuleDef::Start{ {}, prefix.empty() ? char_t( 0 ) : *prefix.begin() }; }
+
 
 
 
@@ -276,5 +324,13 @@ namespace eon
 		//
 	private:
 		std::vector<std::shared_ptr<RuleDef>> Rules;
+
+		// Rules (as positions in Rules) to try for tokens of each type
+		// (including those for any token), for tokens starting with each
+		// character, and for tokens of any other type - all in the order
+		// added
+		std::unordered_map<name_t, std::vector<size_t>> ByType;
+		std::unordered_map<char_t, std::vector<size_t>> ByChar;
+		std::vector<size_t> Anywhere;
 	};
 };
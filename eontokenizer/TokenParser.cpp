@@ -1,6 +1,7 @@
 #include "TokenParser.h"
 #include <eonsource/String.h>
 #include "Tokenizer.h"
+#include <algorithm>
 
 
 namespace eon
@@ -28,6 +29,32 @@ namespace eon
 			tokenizer.registerSingleCharAsToken( ' ', name_space );
 			Obj = TokenParser( tokenizer( source::Ref( Src ) ) );
 		}
+		// Stream the tokens of 'Obj', 3 at a time
+		TokenParser stream( size_t window )
+		{
+			return TokenParser( [this]( std::vector<Token>& tokens, size_t max ) {
+				size_t num = 0;
+				for( ; num < std::min( max, size_t( 3 ) ) && Obj.viewedPos() + num < Obj.size(); ++num )
+					tokens.push_back( Obj.peek( Obj.viewedPos() + num ) );
+				Obj.forward( num );
+				return num > 0; }, window );
+		}
+		bool step( TokenParser& parser, size_t steps )
+		{
+			for( ; steps > 0; --steps )
+			{
+				if( !parser.forward() )
+					return false;
+			}
+			return true;
+		}
+		string all( TokenParser& parser )
+		{
+			string str;
+			for( ; !parser.atEnd(); parser.forward() )
+				str << parser.viewed().str() << "|";
+			return str;
+		}
 		source::String Src;
 		TokenParser Obj;
 	};
@@ -35,6 +62,34 @@ namespace eon
 
 
 
+	TokenParser::TokenParser( tokenstream stream, size_t window )
+	{
+		Stream = std::move( stream );
+		Window = std::max( window, size_t( 4 ) );
+		Ahead = Window / 4;
+		Tokens.reserve( Window );
+		_read( 0 );
+	}
+	EON_TEST_3STEP( TokenParser, TokenParser, stream,
+		TestParser obj( "one two three four five six" ),
+		TokenParser stream = obj.stream( 8 ),
+		EON_EQ( "one| |two| |three| |four| |five| |six|", obj.all( stream ) ) );
+	EON_TEST_3STEP( TokenParser, TokenParser, stream_window,
+		TestParser obj( "one two three four five six" ),
+		TokenParser stream = obj.stream( 8 ),
+		EON_TRUE( obj.step( stream, 7 ) && stream.size() - stream.Base <= 8 ) );
+	EON_TEST_3STEP( TokenParser, TokenParser, stream_backtrack,
+		TestParser obj( "one two three four five six" ),
+		TokenParser stream = obj.stream( 8 ),
+		EON_FALSE( obj.step( stream, 7 ) && stream.setView( 0 ) ) );
+	EON_TEST_3STEP( TokenParser, TokenParser, stream_hold,
+		TestParser obj( "one two three four five six" ),
+		TokenParser stream = obj.stream( 8 ),
+		EON_TRUE( ( stream.hold( 1 ), obj.step( stream, 10 ) ) && stream.setView( 1 ) && stream.viewed().str() == " " ) );
+
+
+
+
 	EON_TEST_3STEP( TokenParser, operator_asgn, move1,
 		TestParser old,
 		TokenParser obj = std::move( old.Obj ),
@@ -197,14 +252,33 @@ namespace eon
 		TestParser obj,
 		EON_EQ( "6", obj.Obj.last().str() ) );
 
+	void TokenParser::_read( size_t pos ) noexcept
+	{
+		auto keep = std::min( View, Hold );
+		keep = keep > Ahead ? keep - Ahead : 0;
+		if( keep > Base )
+		{
+			Tokens.erase( Tokens.begin(), Tokens.begin() + ( keep - Base ) );
+			Base = keep;
+		}
+		while( !Done && pos + Ahead >= Base + Tokens.size() )
+		{
+			if( !Stream( Tokens, Window > Tokens.size() ? Window - Tokens.size() : Ahead ) )
+				Done = true;
+		}
+	}
+
+
+
+
 	size_t TokenParser::lineStart() const
 	{
-		for( size_t i = View; i > 0; --i )
+		for( size_t i = View; i > Base; --i )
 		{
 			if( peek( i - 1 ).is( name_newline ) )
 				return i;
 		}
-		return 0;
+		return Base;
 	}
 	EON_TEST_2STEP( TokenParser, lineStart, singleton,
 		TestParser obj,
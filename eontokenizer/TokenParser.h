@@ -1,5 +1,6 @@
 #pragma once
 #include "Token.h"
+#include <functional>
 
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -17,8 +18,30 @@ namespace eon
 	// backward as while iterating the tokens, allowing for a more precise
 	// identification of token types and sequences based on their context.
 	//
+	// Tokens can also be read from a stream, as they are needed. Only a
+	// window of them is then kept, and the parser can only look a limited
+	// number of tokens ahead ([exists], [peekAhead]) and move back to
+	// tokens within the window.
+	//
 	class TokenParser
 	{
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Definitions
+		//
+	public:
+
+		// Function reading more tokens into 'tokens' (appending), about
+		// 'max' of them
+		// Returns false if there were no more tokens.
+		using tokenstream = std::function<bool( std::vector<Token>& tokens, size_t max )>;
+
+		// Default window size (number of tokens) when reading from a stream
+		static const size_t DefWindow{ 4096 };
+
+
+
+
 		///////////////////////////////////////////////////////////////////////
 		//
 		// Construction
@@ -33,6 +56,13 @@ namespace eon
 		//       When the parser is done, they can be reclaimed if necessary.
 		inline explicit TokenParser( std::vector<Token>&& tokens ) noexcept : Tokens( std::move( tokens ) ) {}
 
+		// Construct parser reading tokens from a 'stream' as they are needed
+		// Only 'window' tokens are kept (as a rule), from a quarter of the
+		// window behind the 'token view' (or the position given to [hold],
+		// if before that). It is possible to look a quarter of the window
+		// ahead.
+		TokenParser( tokenstream stream, size_t window = DefWindow );
+
 		// Cannot copy-construct a token parser.
 		TokenParser( const TokenParser& ) = delete;
 
@@ -54,16 +84,20 @@ namespace eon
 		TokenParser& operator=( TokenParser&& ) noexcept = default;
 
 		// Reclaim the tokens (makes the parser void).
-		inline std::vector<Token>&& reclaim() noexcept { View = 0; return std::move( Tokens ); }
+		// NOTE: When reading from a stream, only the tokens in the window are
+		//       reclaimed!
+		inline std::vector<Token>&& reclaim() noexcept { View = 0; Base = 0; return std::move( Tokens ); }
 
 
 		// Move 'token view' one or more steps forward.
 		// Returns true unless zero or too many steps.
 		inline bool forward( size_t steps = 1 ) noexcept
 		{
-			if( Tokens.size() - View < steps )
+			_need( View + steps );
+			if( Base + Tokens.size() - View < steps )
 				return false;
 			View += steps;
+			_need( View );
 			return true;
 		}
 
@@ -71,7 +105,7 @@ namespace eon
 		// Returns true unless zero or too many steps.
 		inline bool backward( size_t steps = 1 ) noexcept
 		{
-			if( View < steps )
+			if( View - Base < steps )
 				return false;
 			View -= steps;
 			return true;
@@ -83,24 +117,33 @@ namespace eon
 		inline bool forwardIf( name_t type ) noexcept { return !atEnd() && viewed().is( type ) && forward(); }
 
 		// Move 'token view' to the first newline token (end of line in source).
-		inline void moveToEol() noexcept { for( ; !atEnd() && !viewed().is( name_newline ); ++View ); }
+		inline void moveToEol() noexcept { for( ; !atEnd() && !viewed().is( name_newline ); forward() ); }
 
 		// Move 'token view' to the first token on the next line in the source.
 		// NOTE: This can be another newline if the next line is empty!
 		inline void movePastEol() noexcept {
-			for( ; !atEnd(); ++View ) { if( viewed().is( name_newline ) ) { ++View; break; } } }
+			for( ; !atEnd(); forward() ) { if( viewed().is( name_newline ) ) { forward(); break; } } }
 
 		// Move 'token view' to the token at the specified position within the tokens vector.
 		// Returns true unless the new view position is out of range!
 		// NOTE: Setting to one past the last element is legal!
 		inline bool setView( size_t pos ) noexcept
 		{
-			if( pos > Tokens.size() )
+			if( pos < Base )
+				return false;
+			_need( pos );
+			if( pos > Base + Tokens.size() )
 				return false;
 			View = pos;
 			return true;
 		}
 
+		// When reading from a stream, keep all tokens from position 'pos'
+		// (which must not be dropped already), for moving back to it later
+		// The window grows if needed! Holding a new position releases the
+		// previous.
+		inline void hold( size_t pos ) noexcept { Hold = pos; }
+
 
 
 
@@ -110,18 +153,20 @@ namespace eon
 		//
 
 		// Check if at the end of the token sequence.
-		inline bool atEnd() const noexcept { return View >= Tokens.size(); }
+		inline bool atEnd() const noexcept { return View >= Base + Tokens.size(); }
 
 		// Get currently viewed token.
 		// WARNING: The 'token view' must be less than [size()]!
-		inline const Token& viewed() const { return Tokens[ View ]; }
+		inline const Token& viewed() const { return Tokens[ View - Base ]; }
 
 		// Check if there is a token at the specified number of steps forward
 		// (positive argument) or backward (negative argument) of the current
 		// 'token view'.
+		// NOTE: When reading from a stream, only tokens within the window
+		//       exist!
 		inline bool exists( int steps = 1 ) const noexcept {
-			return steps < 0 ? static_cast<size_t>( -steps ) <= View
-				: View + static_cast<size_t>( steps ) < Tokens.size(); }
+			return steps < 0 ? static_cast<size_t>( -steps ) <= View - Base
+				: View + static_cast<size_t>( steps ) < Base + Tokens.size(); }
 
 		// Peek at a token a number of steps ahead of 'token view'.
 		// NOTE: Use [exists(int)] to make sure there is such a token!
@@ -133,9 +178,11 @@ namespace eon
 
 		// Peek at a token in a specific position in the tokens vector.
 		// WARNING: The position must be less than [size()]!
-		inline const Token& peek( size_t pos ) const { return Tokens[ pos ]; }
+		inline const Token& peek( size_t pos ) const { return Tokens[ pos - Base ]; }
 
 		// Peek at the token at the very end of the tokens vector.
+		// NOTE: When reading from a stream, this is the last token read so
+		//       far - only the very last at the end!
 		inline const Token& last() const { return Tokens[ Tokens.size() - 1 ]; }
 
 		// Get the position of the first token that is on the same line in the source as the currently viewed.
@@ -145,7 +192,25 @@ namespace eon
 		inline size_t viewedPos() const noexcept { return View; }
 
 		// Get total number of tokens in tokens vector.
-		inline size_t size() const noexcept { return Tokens.size(); }
+		// NOTE: When reading from a stream, this is the number read so far!
+		inline size_t size() const noexcept { return Base + Tokens.size(); }
+
+
+
+
+		///////////////////////////////////////////////////////////////////////
+		//
+		// Helpers
+		//
+	private:
+
+		// Make sure tokens up to a quarter window beyond 'pos' are read from
+		// the stream, unless there are no more tokens
+		inline void _need( size_t pos ) noexcept {
+			if( Stream && !Done && pos + Ahead >= Base + Tokens.size() ) _read( pos ); }
+
+		// Read from the stream, dropping tokens no longer needed first
+		void _read( size_t pos ) noexcept;
 
 
 
@@ -158,5 +223,13 @@ namespace eon
 
 		std::vector<Token> Tokens;
 		size_t View{ 0 };
+
+		// When reading from a stream
+		tokenstream Stream;
+		size_t Base{ 0 };							// Position of the first token in the window
+		size_t Window{ 0 };
+		size_t Ahead{ 0 };							// Lookahead, and how far back to keep
+		size_t Hold{ SIZE_MAX };
+		bool Done{ false };
 	};
 };
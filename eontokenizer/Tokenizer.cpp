@@ -1,5 +1,6 @@
 #include "Tokenizer.h"
 #include <eonsource/String.h>
+#include <algorithm>
 
 
 namespace eon
@@ -63,6 +64,13 @@ namespace eon
 			}
 			return string( ";" ).join( results );
 		}
+		string charTable( char_t chr )
+		{
+			string result;
+			for( auto& candidate : Obj.Conf.CharTable[ chr ] )
+				result << next( result ) << eon::str( candidate.Name ) << ":" << grp( candidate.Grouping );
+			return result;
+		}
 		void basicPrep()
 		{
 			Obj.registerSingleCharAsToken( ' ', name_space );
@@ -84,6 +92,34 @@ namespace eon
 			}
 			return str;
 		}
+		string tokenizeStream( size_t max )
+		{
+			Tokenizer::Stream stream( Obj, Src );
+			std::vector<Token> tokens;
+			while( stream.read( tokens, max ) )
+				;
+			string str;
+			for( auto& token : tokens )
+			{
+				if( !str.empty() )
+					str += "|";
+				str << eon::str( token.type() ) << "=" << token.str();
+			}
+			return str;
+		}
+		string tokenizeRaw()
+		{
+			auto tokens = Tokenizer::Scanner<Tokenizer::RawReader>(
+				Obj.Conf, Src, Tokenizer::RawReader( Src ) ).scan();
+			string str;
+			for( auto& token : tokens )
+			{
+				if( !str.empty() )
+					str += "|";
+				str << eon::str( token.type() ) << "=" << token.str();
+			}
+			return str;
+		}
 		source::String Src;
 		Tokenizer Obj;
 	};
@@ -137,10 +173,82 @@ namespace eon
 
 
 
+	void Tokenizer::Configuration::addChar( char_t chr, name_t as_token, CharacterGrouping grouping )
+	{
+		CharMap[ chr ] = std::make_pair( as_token, grouping );
+		if( chr < NumTableChars )
+			_compileChar( chr );
+	}
+
+	void Tokenizer::Configuration::addCategory( charcat in_category, name_t as_token, CharacterGrouping grouping )
+	{
+		CatMap[ in_category ] = std::make_pair( as_token, grouping );
+		for( char_t chr = 0; chr < NumTableChars; ++chr )
+			_compileChar( chr );
+	}
+
+	void Tokenizer::Configuration::addSequence( string&& sequence, name_t as_token )
+	{
+		if( sequence.empty() )
+			return;
+		if( SeqTrie.empty() )
+			SeqTrie.emplace_back();
+		uint32_t node = 0;
+		for( auto byte : sequence.stdstr() )
+		{
+			auto& next = SeqTrie[ node ].Next;
+			auto found = std::find_if( next.begin(), next.end(),
+				[byte]( const std::pair<uint8_t, uint32_t>& edge ) { return edge.first == static_cast<uint8_t>( byte ); } );
+			if( found != next.end() )
+				node = found->second;
+			else
+			{
+				next.emplace_back( static_cast<uint8_t>( byte ), static_cast<uint32_t>( SeqTrie.size() ) );
+				node = static_cast<uint32_t>( SeqTrie.size() );
+				SeqTrie.emplace_back();
+			}
+		}
+		SeqTrie[ node ].Name = as_token;
+		SeqTrie[ node ].NumChars = sequence.numChars();
+		SeqMap[ std::move( sequence ) ] = as_token;
+	}
+
+	void Tokenizer::Configuration::_compileChar( char_t chr )
+	{
+		auto& candidates = CharTable[ chr ];
+		candidates.clear();
+		if( auto found = CharMap.find( chr ); found != CharMap.end() )
+			candidates.push_back( Candidate{ found->second.first, found->second.second } );
+		auto category = Characters::get().category( chr );
+		for( auto& [pos, cat] : CatMap )
+		{
+			if( pos & category )
+				candidates.push_back( Candidate{ cat.first, cat.second } );
+		}
+	}
+
+	EON_TEST_3STEP( Tokenizer, Configuration, char_table,
+		TestTokenizer obj,
+		obj.basicPrep(),
+		EON_EQ( "def:sequence", obj.charTable( 'e' ) ) );
+	EON_TEST_3STEP( Tokenizer, Configuration, char_table_category,
+		TestTokenizer obj,
+		obj.basicPrep(),
+		EON_EQ( "int:sequence", obj.charTable( '7' ) ) );
+	EON_TEST_3STEP( Tokenizer, Configuration, seq_trie,
+		TestTokenizer obj,
+		obj.basicPrep(),
+		EON_EQ( 4, obj.Obj.Conf.SeqTrie.size() ) );
+
+
+
+
 	std::vector<Token> Tokenizer::operator()( const source::Ref& src ) const
 	{
-		Scanner scanner( Conf, src );
-		return scanner.scan();
+		if( auto data = src.source().data(); data != nullptr )
+			return Scanner<MemoryReader>( Conf, src, MemoryReader( data, src.source().numBytesInSource() ) ).scan();
+		source::Ref source{ src };
+		return Scanner<RawReader>( Conf, src, RawReader( source.source() ) ).scan();
 	}
 	EON_TEST_3STEP( Tokenizer, operator_call, basic,
 		TestTokenizer obj,
@@ -151,23 +259,120 @@ namespace eon
 
 
 
-	Tokenizer::Scanner::Scanner( const Configuration& conf, const source::Ref& source )
+	EON_TEST_3STEP( Tokenizer, operator_call, raw_reader,
+		TestTokenizer obj,
+		obj.basicPrep(),
+		EON_EQ( obj.tokenize(), obj.tokenizeRaw() ) );
+
+
+
+
+	Tokenizer::Stream::Stream( const Tokenizer& tokenizer, const source::Ref& src )
+	{
+		if( auto data = src.source().data(); data != nullptr )
+			Memory.emplace( tokenizer.Conf, src, MemoryReader( data, src.source().numBytesInSource() ) );
+		else
+		{
+			source::Ref source{ src };
+			Raw.emplace( tokenizer.Conf, src, RawReader( source.source() ) );
+		}
+	}
+
+	bool Tokenizer::Stream::read( std::vector<Token>& tokens, size_t max )
+	{
+		return Memory ? Memory->_scanSome( tokens, max ) : Raw->_scanSome( tokens, max );
+	}
+	EON_TEST_3STEP( Tokenizer, Stream, read,
+		TestTokenizer obj,
+		obj.basicPrep(),
+		EON_EQ( obj.tokenize(), obj.tokenizeStream( 4 ) ) );
+	EON_TEST_3STEP( Tokenizer, Stream, read_one,
+		TestTokenizer obj,
+		obj.basicPrep(),
+		EON_EQ( obj.tokenize(), obj.tokenizeStream( 1 ) ) );
+
+
+
+
+	bool Tokenizer::RawReader::next( source::Pos& pos ) noexcept
+	{
+		try
+		{
+			auto next = Source->getPosAtOffset( pos, 1 );
+			if( next == pos )
+				return false;
+			pos = next;
+			return true;
+		}
+		catch( ... )
+		{
+			return false;
+		}
+	}
+
+	bool Tokenizer::MemoryReader::next( source::Pos& pos ) noexcept
+	{
+		if( pos.BytePos >= Size )
+			return false;
+		auto byte = static_cast<uint8_t>( Data[ pos.BytePos ] );
+		if( byte == NewlineChr )
+		{
+			++pos.Line;
+			pos.PosOnLine = 0;
+		}
+		else
+			++pos.PosOnLine;
+		++pos.CharPos;
+		pos.BytePos += byte < 0x80 ? 1 : byte >= 0xF0 ? 4 : byte >= 0xE0 ? 3 : 2;
+		return true;
+	}
+
+
+
+
+	template<typename Reader>
+	Tokenizer::Scanner<Reader>::Scanner( const Configuration& conf, const source::Ref& source, Reader reader )
+		: Read( reader )
 	{
 		Conf = &conf;
 		Source = source;
-		CurMatch = source::Ref( Source.source(), Source.start(), Source.source().getPosAtOffset( Source.start(), 1 ) );
+		Start = Source.start();
+		End = Start;
+		Last = Start;
+		Read.next( End );
 		Chars = &Characters::get();
-		Unmatched = source::Ref( Source.source(), Source.start(), Source.start() );
+		UnmatchedStart = UnmatchedEnd = Start;
 	}
 
-	std::vector<Token> Tokenizer::Scanner::scan()
+	template<typename Reader>
+	std::vector<Token> Tokenizer::Scanner<Reader>::scan()
 	{
-		while( !Source.atEnd( CurMatch.last() ) && _scan() )
+		while( End != Start && !Source.atEnd( Last ) && _scan() )
 			;
 		return std::move( Tokens );
 	}
 
-	bool Tokenizer::Scanner::_scan()
+	template<typename Reader>
+	bool Tokenizer::Scanner<Reader>::_scanSome( std::vector<Token>& tokens, size_t max )
+	{
+		// The last token can still be extended (see _extendWithNewType), so
+		// it is only handed out at the end
+		while( !Done && Tokens.size() <= max )
+		{
+			if( End == Start || Source.atEnd( Last ) || !_scan() )
+				Done = true;
+		}
+		auto num = std::min( max, Done ? Tokens.size() : Tokens.size() - 1 );
+		if( num == 0 )
+			return false;
+		tokens.insert( tokens.end(),
+			std::make_move_iterator( Tokens.begin() ), std::make_move_iterator( Tokens.begin() + num ) );
+		Tokens.erase( Tokens.begin(), Tokens.begin() + num );
+		return true;
+	}
+
+	template<typename Reader>
+	bool Tokenizer::Scanner<Reader>::_scan()
 	{
 		auto type_name = _identifyType();
 		if( type_name != no_name )
@@ -176,7 +381,7 @@ namespace eon
 			_processOldType();
 		else
 			_processUnmatched();
-		if( !CurMatch.moveEnd( 1 ) )
+		if( !_moveEnd() )
 		{
 			_processEndOfSource( type_name );
 			return false;
@@ -184,15 +389,29 @@ namespace eon
 		return true;
 	}
 
-	name_t Tokenizer::Scanner::_identifyType()
+	template<typename Reader>
+	bool Tokenizer::Scanner<Reader>::_moveEnd() noexcept
 	{
-		auto chr = CurMatch.source().chr( CurMatch.last() );
+		auto next = End;
+		if( !Read.next( next ) )
+			return false;
+		Last = End;
+		End = next;
+		return true;
+	}
+
+	template<typename Reader>
+	name_t Tokenizer::Scanner<Reader>::_identifyType()
+	{
+		auto chr = Read.chr( Last );
 		if( chr == NewlineChr )
-			return CurMatch.numChars() == 1 ? name_newline : no_name;
+			return _numChars() == 1 ? name_newline : no_name;
 
 		auto type_name = _extendToMaximum();
 		if( type_name == no_name )
 		{
+			if( chr < Configuration::NumTableChars )
+				return _matchCharTable( chr );
 			type_name = _matchCharMap( chr );
 			if( type_name == no_name )
 				return _matchCategoryMap( chr );
@@ -200,50 +419,60 @@ namespace eon
 		return type_name;
 	}
 
-	name_t Tokenizer::Scanner::_extendToMaximum()
+	template<typename Reader>
+	name_t Tokenizer::Scanner<Reader>::_extendToMaximum()
 	{
-		if( Conf->LongestSeq == 0 )
+		// A sequence can only start a new token, never extend the current
+		if( Conf->SeqTrie.empty() || CurMatchName != no_name )
 			return no_name;
-		auto source = _maximizeSource();
-		return _shrinkToMaxPossible( source );
-	}
 
-	name_t Tokenizer::Scanner::_shrinkToMaxPossible( source::Ref& source )
-	{
-		for( ; source.numChars() > 0; source.moveEnd( -1 ) )
+		// Follow the trie for as long as the source bytes allow, and keep
+		// the longest sequence seen
+		auto byte_pos = Last.BytePos;
+		const Configuration::SeqNode* node = &Conf->SeqTrie[ 0 ];
+		const Configuration::SeqNode* longest = nullptr;
+		for( int byte = Read.byte( byte_pos ); byte >= 0; byte = Read.byte( ++byte_pos ) )
 		{
-			auto found = Conf->SeqMap.find( source.str() );
-			if( found != Conf->SeqMap.end() )
-			{
-				if( CurMatchName != no_name )
-					break;
-				CurMatch.moveEnd( static_cast<int>( source.numChars() ) - 1 );
-				return found->second;
-			}
+			auto next = std::find_if( node->Next.begin(), node->Next.end(),
+				[byte]( const std::pair<uint8_t, uint32_t>& edge ) { return edge.first == byte; } );
+			if( next == node->Next.end() )
+				break;
+			node = &Conf->SeqTrie[ next->second ];
+			if( node->Name != no_name )
+				longest = node;
 		}
-		return no_name;
+		if( longest == nullptr )
+			return no_name;
+		for( index_t i = 1; i < longest->NumChars; ++i )
+			_moveEnd();
+		return longest->Name;
 	}
 
-	source::Ref Tokenizer::Scanner::_maximizeSource()
+	template<typename Reader>
+	name_t Tokenizer::Scanner<Reader>::_matchCharTable( char_t chr ) const
 	{
-		source::Ref source = CurMatch;
-		source.start( CurMatch.last() );
-		for( index_t i = 1; i < Conf->LongestSeq && source.moveEnd( 1 ); ++i )
-			;
-		return source;
+		for( auto& candidate : Conf->CharTable[ chr ] )
+		{
+			if( ( CurMatchName == no_name || CurMatchName == candidate.Name )
+				&& ( candidate.Grouping == CharacterGrouping::sequence || _numChars() == 1 ) )
+				return candidate.Name;
+		}
+		return no_name;
 	}
 
-	name_t Tokenizer::Scanner::_matchCharMap( char_t chr ) const
+	template<typename Reader>
+	name_t Tokenizer::Scanner<Reader>::_matchCharMap( char_t chr ) const
 	{
 		if( auto found = Conf->CharMap.find( chr );
 			found != Conf->CharMap.end()
 			&& ( CurMatchName == no_name || CurMatchName == found->second.first )
-			&& ( found->second.second == CharacterGrouping::sequence || CurMatch.numChars() == 1 ) )
+			&& ( found->second.second == CharacterGrouping::sequence || _numChars() == 1 ) )
 			return found->second.first;
 		return no_name;
 	}
 
-	name_t Tokenizer::Scanner::_matchCategoryMap( char_t chr ) const
+	template<typename Reader>
+	name_t Tokenizer::Scanner<Reader>::_matchCategoryMap( char_t chr ) const
 	{
 		auto category = Chars->category( chr );
 		for( auto& [pos, cat] : Conf->CatMap )
@@ -251,69 +480,78 @@ namespace eon
 			if( pos
 				& category
 				&& ( CurMatchName == no_name || CurMatchName == cat.first )
-				&& ( cat.second == CharacterGrouping::sequence || CurMatch.numChars() == 1 ) )
+				&& ( cat.second == CharacterGrouping::sequence || _numChars() == 1 ) )
 				return cat.first;
 		}
 		return no_name;
 	}
 
-	void Tokenizer::Scanner::_processNewType( name_t type_name )
+	template<typename Reader>
+	void Tokenizer::Scanner<Reader>::_processNewType( name_t type_name )
 	{
-		if( Unmatched )
+		if( _unmatched() )
 		{
-			Tokens.emplace_back( Unmatched, name_undef );
-			Unmatched = source::Ref();
+			Tokens.emplace_back( _ref( UnmatchedStart, UnmatchedEnd ), name_undef );
+			UnmatchedStart = UnmatchedEnd = source::Pos();
 		}
 		CurMatchName = type_name;
 	}
 
-	void Tokenizer::Scanner::_processOldType()
+	template<typename Reader>
+	void Tokenizer::Scanner<Reader>::_processOldType()
 	{
-		CurMatch.moveEnd( -1 );
+		End = Last;
 		if( !_extendWithNewType() && !_recordNameToken() )
-			Tokens.emplace_back( CurMatch, CurMatchName );
-		CurMatch.moveStartToEnd();
+			Tokens.emplace_back( _ref( Start, End ), CurMatchName );
+		Start = End;
 		CurMatchName = no_name;
 	}
 
-	bool Tokenizer::Scanner::_extendWithNewType()
+	template<typename Reader>
+	bool Tokenizer::Scanner<Reader>::_extendWithNewType()
 	{
 		if( Conf->MatchEonNames && !Tokens.empty()
 			&& _isNameCandidate( Tokens.back().type() ) && _isNameCandidate( CurMatchName ) )
 		{
-			Tokens.back().extendWithNewType( CurMatch.end(), name_name );
+			Tokens.back().extendWithNewType( End, name_name );
 			return true;
 		}
 		return false;
 	}
 
-	bool Tokenizer::Scanner::_recordNameToken()
+	template<typename Reader>
+	bool Tokenizer::Scanner<Reader>::_recordNameToken()
 	{
 		if( Conf->MatchEonNames && ( CurMatchName == name_letters || CurMatchName == name_underscore ) )
 		{
-			Tokens.emplace_back( CurMatch, name_name );
+			Tokens.emplace_back( _ref( Start, End ), name_name );
 			return true;
 		}
 		return false;
 	}
 
-	void Tokenizer::Scanner::_processUnmatched()
+	template<typename Reader>
+	void Tokenizer::Scanner<Reader>::_processUnmatched()
 	{
-		if( !Unmatched )
-			Unmatched = CurMatch;
-		else
-			Unmatched.moveEnd( 1 );
-		CurMatch.moveStart( 1 );
+		// Only ever a single character here, following any earlier ones
+		if( !_unmatched() )
+			UnmatchedStart = Start;
+		UnmatchedEnd = End;
+		Start = End;
 	}
 
-	void Tokenizer::Scanner::_processEndOfSource( name_t type_name )
+	template<typename Reader>
+	void Tokenizer::Scanner<Reader>::_processEndOfSource( name_t type_name )
 	{
 		if( type_name != no_name )
 		{
 			if( !_extendWithNewType() && !_recordNameToken() )
-				Tokens.emplace_back( CurMatch, type_name );
+				Tokens.emplace_back( _ref( Start, End ), type_name );
 		}
-		else if( Unmatched )
-			Tokens.emplace_back( Unmatched, name_undef );
+		else if( _unmatched() )
+			Tokens.emplace_back( _ref( UnmatchedStart, UnmatchedEnd ), name_undef );
 	}
+
+	template struct Tokenizer::Scanner<Tokenizer::RawReader>;
+	template struct Tokenizer::Scanner<Tokenizer::MemoryReader>;
 }
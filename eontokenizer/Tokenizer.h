@@ -3,6 +3,7 @@
 #include <unordered_map>
 #include <map>
 #include <vector>
+#include <optional>
 
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -75,32 +76,31 @@ namespace eon
 
 		// Register a single character as a token type.
 		inline void registerSingleCharAsToken( char_t chr, name_t as_token ) {
-			Conf.CharMap[ chr ] = std::make_pair( as_token, CharacterGrouping::single ); }
+			Conf.addChar( chr, as_token, CharacterGrouping::single ); }
 
 		// Register a sequence of a single charcter as a token type.
 		inline void registerSingleCharSequenceAsToken( char_t chr, name_t as_token ) {
-			Conf.CharMap[ chr ] = std::make_pair( as_token, CharacterGrouping::sequence ); }
+			Conf.addChar( chr, as_token, CharacterGrouping::sequence ); }
 
 		// Register any single character from a list of characters as a token type.
 		inline void registerAnySingleCharAsToken( const string& characters, name_t as_token ) {
-			for( auto c : characters ) Conf.CharMap[ c ] = std::make_pair( as_token, CharacterGrouping::single ); }
+			for( auto c : characters ) Conf.addChar( c, as_token, CharacterGrouping::single ); }
 
 		// Register a sequence of characters in any order from a list as a token type.
 		inline void registryAnySingleCharSequenceAsToken( const string& characters, name_t as_token ) {
-			for( auto c : characters ) Conf.CharMap[ c ] = std::make_pair( as_token, CharacterGrouping::sequence ); }
+			for( auto c : characters ) Conf.addChar( c, as_token, CharacterGrouping::sequence ); }
 
 		// Register any single character from a character catetory as a token type.
 		inline void registerAnySingleCharAsToken( charcat in_category, name_t as_token ) {
-			Conf.CatMap[ in_category ] = std::make_pair( as_token, CharacterGrouping::single ); }
+			Conf.addCategory( in_category, as_token, CharacterGrouping::single ); }
 
 		// Register any sequence of characters from a character category as a token type.
 		inline void registerCharSequenceAsToken( charcat in_category, name_t as_token ) {
-			Conf.CatMap[ in_category ] = std::make_pair( as_token, CharacterGrouping::sequence ); }
+			Conf.addCategory( in_category, as_token, CharacterGrouping::sequence ); }
 
 		// Register a specific sequence of characters as a token type.
 		inline void registerCharSequenceAsToken( string&& sequence, name_t as_type ) {
-			if( sequence.numChars() > Conf.LongestSeq ) Conf.LongestSeq = sequence.numChars();
-			Conf.SeqMap[ std::move( sequence ) ] = as_type; }
+			Conf.addSequence( std::move( sequence ), as_type ); }
 
 		// Register any valid Eon name as token type 'name' [eon::name_name].
 		inline void registerEonNamesAsTokens() noexcept { Conf.MatchEonNames = true; }
@@ -115,8 +115,15 @@ namespace eon
 	public:
 
 		// Get sequence of [eon::Token]s from an [eon::source::Ref]
+		// Sources held in contiguous memory (see [eon::source::Raw::data])
+		// are read directly, others through the [eon::source::Raw] methods.
 		std::vector<Token> operator()( const source::Ref& src ) const;
 
+		// Pull-based tokenizing, only scanning the source as far as needed
+		// for the tokens read so far
+		// NOTE: The tokenizer and the source must outlive the stream!
+		class Stream;
+
 
 
 
@@ -130,31 +137,90 @@ namespace eon
 			name_t Name;
 		};
 
+		// The registered token types, also compiled into tables that are kept
+		// up to date when registering, and only read when tokenizing:
+		// Candidate token types for each of the first 256 characters (in the
+		// order they are to be tried), and a trie of the UTF-8 bytes of all
+		// character sequences, for finding the longest one without having to
+		// look up every possible length.
 		struct Configuration
 		{
 			inline explicit operator bool() const noexcept {
 				return !CharMap.empty() || !CatMap.empty() || !SeqMap.empty(); }
+
+			void addChar( char_t chr, name_t as_token, CharacterGrouping grouping );
+			void addCategory( charcat in_category, name_t as_token, CharacterGrouping grouping );
+			void addSequence( string&& sequence, name_t as_token );
+
+			void _compileChar( char_t chr );
+
 			std::unordered_map<char_t, std::pair<name_t, CharacterGrouping>> CharMap;
 			std::map<charcat, std::pair<name_t, CharacterGrouping>> CatMap;
 			std::unordered_map<string, name_t> SeqMap;
 			bool MatchEonNames{ false };
-			index_t LongestSeq{ 0 };
+
+			struct Candidate
+			{
+				name_t Name{ no_name };
+				CharacterGrouping Grouping{ CharacterGrouping::single };
+			};
+			static const char_t NumTableChars{ 256 };
+			std::vector<Candidate> CharTable[ NumTableChars ];
+
+			struct SeqNode
+			{
+				std::vector<std::pair<uint8_t, uint32_t>> Next;
+				name_t Name{ no_name };			// Sequence ending here, if any
+				index_t NumChars{ 0 };
+			};
+			std::vector<SeqNode> SeqTrie;		// Root at 0 (once there are sequences)
 		};
 		Configuration Conf;
 
+		// Reading the source through the virtual [eon::source::Raw] interface
+		struct RawReader
+		{
+			inline explicit RawReader( source::Raw& source ) noexcept : Source( &source ) {}
+			inline char_t chr( const source::Pos& pos ) noexcept { return Source->chr( pos ); }
+			inline int byte( index_t pos ) noexcept { return Source->byte( pos ); }
+			bool next( source::Pos& pos ) noexcept;
+			source::Raw* Source{ nullptr };
+		};
+
+		// Reading a source held in contiguous memory, as raw (valid) UTF-8
+		struct MemoryReader
+		{
+			inline MemoryReader( const char* data, index_t size ) noexcept : Data( data ), Size( size ) {}
+			inline char_t chr( const source::Pos& pos ) noexcept {
+				char_t cp{ nochar }; if( pos.BytePos < Size ) string_iterator::decodeValidUtf8( Data + pos.BytePos, cp );
+				return cp; }
+			inline int byte( index_t pos ) noexcept { return pos < Size ? static_cast<uint8_t>( Data[ pos ] ) : -1; }
+			bool next( source::Pos& pos ) noexcept;
+			const char* Data{ nullptr };
+			index_t Size{ 0 };
+		};
+
+		// The current match is tracked as positions (start, end, and the
+		// last character), only reading the source through the 'Reader'
+		template<typename Reader>
 		struct Scanner
 		{
-			Scanner( const Configuration& conf, const source::Ref& source );
+			Scanner( const Configuration& conf, const source::Ref& source, Reader reader );
 			std::vector<Token> scan();
 			bool _scan();
+			bool _moveEnd() noexcept;
+			bool _scanSome( std::vector<Token>& tokens, size_t max );
 			name_t _identifyType();
 			name_t _extendToMaximum();
-			source::Ref _maximizeSource();
-			name_t _shrinkToMaxPossible( source::Ref& source );
+			name_t _matchCharTable( char_t chr ) const;
 			name_t _matchCharMap( char_t chr ) const;
 			name_t _matchCategoryMap( char_t chr ) const;
 			inline bool _isNameCandidate( name_t name ) const noexcept {
 				return name == name_letters || name == name_digits || name == name_underscore || name == name_name; }
+			inline index_t _numChars() const noexcept { return End.CharPos - Start.CharPos; }
+			inline bool _unmatched() const noexcept { return UnmatchedEnd.BytePos > UnmatchedStart.BytePos; }
+			inline source::Ref _ref( const source::Pos& start, const source::Pos& end ) {
+				return source::Ref( Source.source(), start, end ); }
 			void _processNewType( name_t type_name );
 			void _processOldType();
 			bool _extendWithNewType();
@@ -163,12 +229,32 @@ namespace eon
 			void _processEndOfSource( name_t type_name );
 
 			const Configuration* Conf{ nullptr };
+			Reader Read;
 			source::Ref Source;
-			source::Ref CurMatch;
+			source::Pos Start, End, Last;
 			name_t CurMatchName{ no_name };
 			const Characters* Chars{ nullptr };
-			source::Ref Unmatched;
+			source::Pos UnmatchedStart, UnmatchedEnd;
 			std::vector<Token> Tokens;
+			bool Done{ false };
+		};
+
+	public:
+		class Stream
+		{
+		public:
+			Stream( const Tokenizer& tokenizer, const source::Ref& src );
+
+			Stream( const Stream& ) = delete;
+			Stream( Stream&& ) = delete;
+
+			// Read up to 'max' more tokens into 'tokens' (appending)
+			// Returns false if there were no more tokens.
+			bool read( std::vector<Token>& tokens, size_t max );
+
+		private:
+			std::optional<Scanner<MemoryReader>> Memory;
+			std::optional<Scanner<RawReader>> Raw;
 		};
 	};
 }
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <eonbenchmark/Benchmark.h>
+#include <eontokenizer/Tokenizer.h>
+#include <eontokenizer/ReTokenizer.h>
+#include <eonsource/String.h>
+
+
+namespace eon
+{
+	class Tokenize : public eonbench::EonBenchmark
+	{
+	public:
+		~Tokenize() override;
+
+	protected:
+		// Repeat the EDF documents of the parser tests to a few MB, and
+		// configure the tokenizer the same way as the parser does
+		void prepare() override;
+
+		// Configure the same way as [eon::parser::Tokenizers]
+		static void _prepTokenizer( Tokenizer& tokenizer );
+		static void _prepReTokenizer( ReTokenizer& retokenizer );
+
+	protected:
+		source::String Corpus;
+		std::string CorpusFile;
+		Tokenizer Tok;
+		ReTokenizer ReTok;
+	};
+}
@@ -0,0 +1,271 @@
+#include "Benchmarks.h"
+#include <eonsource/File.h>
+#include <filesystem>
+#include <fstream>
+#include <cstring>
+#ifndef EON_WINDOWS
+#	include <sys/resource.h>
+#endif
+
+
+namespace eon
+{
+	static const size_t CorpusBytes{ 4 * 1024 * 1024 };
+	static const size_t StreamBytes{ 500 * 1024 * 1024 };
+
+	// Documents from the EDF parser tests
+	static const char* EdfDocuments[]{
+		"name=\"Donald Duck\"\n"
+		"occupation=\"unemployed\"\n"
+		"nephews:\n"
+		"  - \"Hewey Duck\"\n"
+		"  - \"Dewey Duck\"\n"
+		"  - \"Louie Duck\"\n"
+		"uncles=(\"Schrooge McDuck\")\n",
+
+		"- id=alpha\n"
+		"  num=1\n"
+		"- one\n"
+		"- id=beta\n"
+		"  num=2\n"
+		"- two\n",
+
+		"- (1, 2, 3)\n"
+		"- (4, 5)\n"
+		"- (6)\n"
+		"- 7\n",
+
+		"- One:\n"
+		"  - a,\n"
+		"  - b\n"
+		"x=1,\n"
+		"y=2,\n",
+
+		"B\"This bytes value \"\n"
+		"  B\"is split!\"\n",
+
+		"// Configuration of the duck pond\n"
+		"pond:\n"
+		"  depth=2.5\n"
+		"  ducks=T(static(name), optional(age))\n"
+		"  /- Counts are updated nightly -/\n"
+		"  count<=40\n"
+		"  owner's=\"Scrooge\"\n"
+		"  limits=(min=1, max=40, step=#2)\n"
+	};
+
+	// Get peak resident memory of the process, in KiB (0 if unknown)
+	static size_t _peakRss()
+	{
+#ifndef EON_WINDOWS
+		rusage usage;
+		if( getrusage( RUSAGE_SELF, &usage ) == 0 )
+			return static_cast<size_t>( usage.ru_maxrss );
+#endif
+		return 0;
+	}
+
+	Tokenize::~Tokenize()
+	{
+		if( !CorpusFile.empty() )
+		{
+			std::error_code error;
+			std::filesystem::remove( CorpusFile, error );
+		}
+	}
+
+	void Tokenize::prepare()
+	{
+		std::string corpus;
+		corpus.reserve( CorpusBytes + 256 );
+		while( corpus.size() < CorpusBytes )
+		{
+			for( auto document : EdfDocuments )
+				corpus += document;
+		}
+		CorpusFile = ( std::filesystem::temp_directory_path() / "eon_tokenize_corpus.edf" ).string();
+		std::ofstream( CorpusFile, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc ) << corpus;
+		Corpus = source::String( "corpus", string( std::move( corpus ) ) );
+
+		_prepTokenizer( Tok );
+		_prepReTokenizer( ReTok );
+	}
+
+	// With the operator symbols of eon::type spelled out, as the tokenizer
+	// doesn't depend on it
+	void Tokenize::_prepTokenizer( Tokenizer& tokenizer )
+	{
+		tokenizer.registerEonNamesAsTokens();
+		tokenizer.registerSingleCharSequenceAsToken( ' ', name_space );
+		tokenizer.registerSingleCharAsToken( '"', name_doublequote );
+		tokenizer.registerSingleCharAsToken( '\'', name_singlequote );
+		tokenizer.registerCharSequenceAsToken( charcat::number_ascii_digit, name_digits );
+		tokenizer.registerSingleCharAsToken( '_', name_underscore );
+		tokenizer.registerCharSequenceAsToken( charcat::letter_lowercase, name_letters );
+		tokenizer.registerCharSequenceAsToken( charcat::letter_uppercase, name_letters );
+		tokenizer.registerCharSequenceAsToken( charcat::letter_titlecase, name_letters );
+		tokenizer.registerCharSequenceAsToken( charcat::letter_modifier, name_letters );
+		tokenizer.registerCharSequenceAsToken( charcat::letter_other, name_letters );
+		tokenizer.registerSingleCharAsToken( '(', compilerName( "(" ) );
+		tokenizer.registerSingleCharAsToken( ')', compilerName( ")" ) );
+		tokenizer.registerSingleCharAsToken( '@', name_at );
+		tokenizer.registerSingleCharAsToken( '\\', name_backslash );
+		tokenizer.registerSingleCharAsToken( '=', compilerName( "=" ) );
+		tokenizer.registerSingleCharAsToken( '-', compilerName( "-" ) );
+		tokenizer.registerSingleCharSequenceAsToken( '.', compilerName( "." ) );
+		tokenizer.registerSingleCharSequenceAsToken( ':', compilerName( ":" ) );
+		tokenizer.registerSingleCharAsToken( ',', compilerName( "," ) );
+		tokenizer.registerCharSequenceAsToken( "//", name( "line_comment" ) );
+		tokenizer.registerCharSequenceAsToken( "/-", name( "comment_start" ) );
+		tokenizer.registerCharSequenceAsToken( "-/", name( "comment_end" ) );
+		tokenizer.registerSingleCharAsToken( '/', compilerName( "/" ) );
+		tokenizer.registerSingleCharAsToken( ';', compilerName( ";" ) );
+		tokenizer.registerAnySingleCharAsToken( "+*~&|^<>[]", name_operator );
+		tokenizer.registerCharSequenceAsToken( "==", compilerName( "==" ) );
+		tokenizer.registerCharSequenceAsToken( "!=", compilerName( "!=" ) );
+		tokenizer.registerCharSequenceAsToken( ">=", compilerName( ">=" ) );
+		tokenizer.registerCharSequenceAsToken( "<=", compilerName( "<=" ) );
+		tokenizer.registerCharSequenceAsToken( "+=", compilerName( "+=" ) );
+		tokenizer.registerCharSequenceAsToken( "-=", compilerName( "-=" ) );
+		tokenizer.registerCharSequenceAsToken( "*=", compilerName( "*=" ) );
+		tokenizer.registerCharSequenceAsToken( "/=", compilerName( "/=" ) );
+		tokenizer.registerCharSequenceAsToken( "'s", compilerName( "'s" ) );
+		tokenizer.registerCharSequenceAsToken( "<<", compilerName( "<<" ) );
+		tokenizer.registerCharSequenceAsToken( ">>", compilerName( ">>" ) );
+		tokenizer.registerCharSequenceAsToken( "<=>", compilerName( "<=>" ) );
+		tokenizer.registerCharSequenceAsToken( "T(", name_typetuple );
+		tokenizer.registerCharSequenceAsToken( "static(", name_static );
+		tokenizer.registerCharSequenceAsToken( "optional(", name_optional );
+		tokenizer.registerCharSequenceAsToken( "dynamic(", name_dynamic );
+		tokenizer.registerCharSequenceAsToken( "data(", name_data );
+		tokenizer.registerCharSequenceAsToken( "ex(", name_expression );
+		tokenizer.registerSingleCharAsToken( '#', name_hash );
+	}
+
+	void Tokenize::_prepReTokenizer( ReTokenizer& retokenizer )
+	{
+		retokenizer.addRule( std::make_shared<ReTokenizer::EncloseRule>( name_string, name_doublequote, name_backslash ) );
+		retokenizer.addRule(
+			std::make_shared<ReTokenizer::PrefixEncloseRule>( name_bytes, "B", name_doublequote, name_backslash ) );
+		retokenizer.addRule(
+			std::make_shared<ReTokenizer::PrefixEncloseRule>( name_path, "p", name_doublequote, name_backslash ) );
+		retokenizer.addRule( std::make_shared<ReTokenizer::EncloseRule>( name_char, name_singlequote, name_backslash ) );
+		retokenizer.addRule(
+			std::make_shared<ReTokenizer::PrefixEncloseRule>( name_byte, "B", name_singlequote, name_backslash ) );
+		retokenizer.addRule(
+			std::make_shared<ReTokenizer::PrefixEncloseRule>( name_regex, "r", name_doublequote, name_backslash ) );
+		retokenizer.addRule( std::make_shared<ReTokenizer::LinestartRule>( name_indentation, name_space ) );
+		retokenizer.addRule(
+			std::make_shared<ReTokenizer::LiteralNameRule>( name_bool, std::set<string>{ "true", "false" } ) );
+		retokenizer.addRule( std::make_shared<ReTokenizer::SequenceRule>(
+			name_float, std::vector<name_t>{ name_digits, compilerName( "." ), name_digits } ) );
+		retokenizer.addRule(
+			std::make_shared<ReTokenizer::SequenceRule>( name_literal, std::vector<name_t>{ name_hash, name_name } ) );
+		retokenizer.addRule( std::make_shared<ReTokenizer::PrefixAlternatingRule>(
+			name_namepath, "@", name_name, compilerName( "/" ) ) );
+		retokenizer.addRule(
+			std::make_shared<ReTokenizer::EncloseRule>( name_comment, name( "linecomment" ), name_newline ) );
+		retokenizer.addRule(
+			std::make_shared<ReTokenizer::EncloseRule>( name_comment, name( "commentstart" ), name( "commentend" ) ) );
+		retokenizer.addRule( std::make_shared<ReTokenizer::RemoveRule>( std::set<name_t>{ name_space } ) );
+	}
+
+	BENCHMARK( Tokenize, edf )
+	{
+		index_t num_tokens{ 0 };
+		measure( "Tokenizer, source::String (direct)", Corpus.numBytesInSource(), [&]() {
+			eonbench::keep( num_tokens = Tok( Corpus ).size() ); } );
+		source::File file{ string( CorpusFile ) };
+		measure( "Tokenizer, source::File (virtual)", file.numBytesInSource(), [&]() {
+			eonbench::keep( Tok( file ).size() ); } );
+		report( "Tokens", string( num_tokens ) );
+	}
+
+	BENCHMARK( Tokenize, retokenize )
+	{
+		// Re-tokenizing only, with the rules of the parser
+		auto tokens = Tok( Corpus );
+		auto num_raw = tokens.size();
+		index_t num_tokens{ 0 };
+		measure( "ReTokenizer, parser rules", Corpus.numBytesInSource(), [&]() {
+			TokenParser raw( std::move( tokens ) );
+			eonbench::keep( num_tokens = ReTok( raw ).size() );
+			tokens = raw.reclaim(); } );
+		report( "Raw tokens", string( num_raw ) );
+		report( "Re-tokenized tokens", string( num_tokens ) );
+	}
+
+	BENCHMARK( Tokenize, tiny_documents )
+	{
+		// Each of the documents as a source of its own, as when parsing many
+		// small documents
+		size_t bytes{ 0 };
+		for( auto document : EdfDocuments )
+			bytes += std::strlen( document );
+		measure( "Configure for each document (before)", bytes, [&]() {
+			for( auto document : EdfDocuments )
+			{
+				Tokenizer tokenizer;
+				_prepTokenizer( tokenizer );
+				ReTokenizer retokenizer;
+				_prepReTokenizer( retokenizer );
+				source::String source( "string", string( document ) );
+				TokenParser raw( tokenizer( source ) );
+				eonbench::keep( retokenizer( raw ).size() );
+			} } );
+		measure( "Shared configuration", bytes, [&]() {
+			for( auto document : EdfDocuments )
+			{
+				source::String source( "string", string( document ) );
+				TokenParser raw( Tok( source ) );
+				eonbench::keep( ReTok( raw ).size() );
+			} } );
+		report( "Documents per run", string( sizeof( EdfDocuments ) / sizeof( EdfDocuments[ 0 ] ) ) );
+	}
+
+	BENCHMARK( Tokenize, streaming )
+	{
+		// Count the tokens of the Tokenizer -> ReTokenizer pipeline, pulling
+		// them through a window
+		auto stream = [&]( const source::Ref& source ) {
+			auto parser = ReTok.stream( Tok, source );
+			index_t num_tokens{ 0 };
+			for( ; !parser.atEnd(); parser.forward() )
+				++num_tokens;
+			return num_tokens; };
+
+		// Streaming first, while the peak memory use of the process is
+		// still low
+		index_t num_tokens{ 0 };
+		auto peak = _peakRss();
+		measure( "Stream " + string( CorpusBytes / ( 1024 * 1024 ) ) + " MiB", Corpus.numBytesInSource(), [&]() {
+			eonbench::keep( num_tokens = stream( source::Ref( Corpus ) ) ); } );
+		report( "Stream " + string( CorpusBytes / ( 1024 * 1024 ) ) + " MiB, peak RSS growth KiB",
+			string( _peakRss() - peak ) );
+
+		peak = _peakRss();
+		measure( "Tokenize all, then retokenize " + string( CorpusBytes / ( 1024 * 1024 ) ) + " MiB (before)",
+			Corpus.numBytesInSource(), [&]() {
+				TokenParser raw( Tok( Corpus ) );
+				eonbench::keep( ReTok( raw ).size() ); } );
+		report( "Tokenize all " + string( CorpusBytes / ( 1024 * 1024 ) ) + " MiB, peak RSS growth KiB",
+			string( _peakRss() - peak ) );
+		report( "Tokens per " + string( CorpusBytes / ( 1024 * 1024 ) ) + " MiB", string( num_tokens ) );
+
+		// A large document, generated in memory (reading it from a
+		// source::File would time the virtual reads more than the pipeline)
+		std::string text;
+		text.reserve( StreamBytes + 256 );
+		while( text.size() < StreamBytes )
+		{
+			for( auto document : EdfDocuments )
+				text += document;
+		}
+		source::String large( "large", string( std::move( text ) ) );
+		peak = _peakRss();
+		measure( "Stream " + string( StreamBytes / ( 1024 * 1024 ) ) + " MiB", large.numBytesInSource(), [&]() {
+			eonbench::keep( stream( source::Ref( large ) ) ); } );
+		report( "Stream " + string( StreamBytes / ( 1024 * 1024 ) ) + " MiB, peak RSS growth KiB",
+			string( _peakRss() - peak ) );
+	}
+}
@@ -241,4 +241,26 @@ namespace eon
 		string actual = fullJoin( tokens );
 		WANT_EQ( expected, actual );
 	}
+	TEST( ReTokenizerTest, rule_order )
+	{
+		// Rules dispatched on the first character and on the token type
+		// must still be tried in the order added
+		string raw{ R"(B"one" Bob two)" };
+		source::String src( "test", std::move( raw ) );
+		auto tokens = Tok( src );
+		TokenParser parser( std::move( tokens ) );
+
+		ReTokenizer retok;
+		retok.addRule(
+			std::make_shared<ReTokenizer::PrefixEncloseRule>( name_bytes, "B", name_doublequote, name_backslash ) );
+		retok.addRule( std::make_shared<ReTokenizer::ComboRule>( name( "word" ), std::set<eon::name_t>{ name_letters } ) );
+		retok.addRule( std::make_shared<ReTokenizer::PrefixComboRule>(
+			name( "prefixed" ), "B", std::set<eon::name_t>{ name_letters } ) );
+		retok.addRule( std::make_shared<ReTokenizer::RemoveRule>( std::set<eon::name_t>{ name_space } ) );
+		tokens = retok( parser );
+
+		string expected{ "bytes=one|word=Bob|word=two" };
+		string actual = fullJoin( tokens );
+		WANT_EQ( expected, actual );
+	}
 }
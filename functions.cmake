@@ -27,3 +27,20 @@ function(eon_add_library)
 		FILE_SET HEADERS
 	)
 endfunction()
+
+
+function(eon_add_benchmarks)
+	if(NOT EON_BENCHMARKS)
+		return()
+	endif()
+
+	file(GLOB cpp benchmarks/*.cpp)
+	file(GLOB hpp benchmarks/*.h)
+	if(cpp)
+		message(STATUS " --> ${PROJECT_NAME}Benchmarks")
+		add_executable(${PROJECT_NAME}Benchmarks)
+		target_sources(${PROJECT_NAME}Benchmarks PRIVATE ${cpp} ${hpp} )
+		target_link_libraries(${PROJECT_NAME}Benchmarks PRIVATE ${PROJECT_NAME} EonBenchmark)
+		set_target_properties(${PROJECT_NAME}Benchmarks PROPERTIES FOLDER "Eon/${PROJECT_NAME}")
+	endif()
+endfunction()
@@ -2,6 +2,9 @@ add_subdirectory(eontest)
 if(EON_INLINE_TESTS)
 	add_subdirectory(eoninlinetest)
 endif()
+if(EON_BENCHMARKS)
+	add_subdirectory(eonbenchmark)
+endif()
 
 add_subdirectory(eonterminal)
 add_subdirectory(eoncontainers)